@@ -74,7 +74,7 @@ public:
     static void shutdown();
     [[nodiscard]] static bool isInitialized() noexcept;
 
-    // Memory utilities
+    // Memory utilities: totals over all MemoryTracker categories
     [[nodiscard]] static std::size_t getMemoryUsage();
     [[nodiscard]] static std::size_t getPeakMemoryUsage();
     static void resetPeakMemoryUsage();
@@ -177,8 +177,6 @@ private:
 
     // Internal state
     static bool s_initialized;
-    static std::size_t s_memoryUsage;
-    static std::size_t s_peakMemoryUsage;
     static std::chrono::high_resolution_clock::time_point s_initTime;
 };
 
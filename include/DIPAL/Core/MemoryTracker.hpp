@@ -0,0 +1,173 @@
+// include/DIPAL/Core/MemoryTracker.hpp
+#ifndef DIPAL_MEMORY_TRACKER_HPP
+#define DIPAL_MEMORY_TRACKER_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace DIPAL {
+
+/**
+ * @brief Subsystems whose memory is accounted separately
+ */
+enum class MemoryCategory {
+    Images,             ///< Pixel buffers of images handed to the caller
+    FilterTemporaries,  ///< Intermediate images and scratch buffers inside filters and processors
+    IOBuffers,          ///< Row and staging buffers of the image codecs
+    PoolCache           ///< Idle buffers kept by pooling allocators
+};
+
+/**
+ * @brief Process-wide, thread-safe accounting of the library's memory
+ *
+ * Every pixel buffer an image obtains from an ImageAllocator (including
+ * copy-on-write detaches) is recorded under the category that is current on
+ * the allocating thread, Images unless a Scope says otherwise. Filters mark
+ * their intermediate images and scratch vectors as FilterTemporaries, the
+ * codecs their row buffers as IOBuffers, and PooledImageAllocator reports its
+ * idle buffers as PoolCache. Buffers adopted from outside (e.g. memory-mapped
+ * files) are not counted.
+ *
+ * Counters are lock-free atomics. Each category keeps its current bytes and a
+ * high-water mark; the total keeps its own high-water mark, which is the peak
+ * of the sum rather than the sum of the peaks.
+ */
+class MemoryTracker {
+public:
+    static constexpr std::size_t kCategoryCount = 4;
+
+    /**
+     * @brief Counters of one category
+     */
+    struct Usage {
+        std::size_t current = 0;      ///< Bytes currently held
+        std::size_t peak = 0;         ///< Highest value of current since the last reset
+        std::size_t allocations = 0;  ///< Number of allocations recorded since startup
+    };
+
+    /**
+     * @brief Record that memory was obtained
+     * @param category Subsystem that owns the memory
+     * @param bytes Size in bytes
+     */
+    static void recordAllocation(MemoryCategory category, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Record that memory was released
+     * @param category Subsystem the memory was recorded under
+     * @param bytes Size in bytes
+     */
+    static void recordDeallocation(MemoryCategory category, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Get the counters of one category
+     * @param category Subsystem
+     * @return Snapshot of the counters
+     */
+    [[nodiscard]] static Usage getUsage(MemoryCategory category) noexcept;
+
+    /**
+     * @brief Get the bytes currently held by all categories together
+     */
+    [[nodiscard]] static std::size_t getTotalUsage() noexcept;
+
+    /**
+     * @brief Get the high-water mark of the total since the last reset
+     */
+    [[nodiscard]] static std::size_t getTotalPeakUsage() noexcept;
+
+    /**
+     * @brief Restart every high-water mark from the current usage
+     */
+    static void resetPeaks() noexcept;
+
+    /**
+     * @brief Get the category new image buffers are recorded under on this thread
+     */
+    [[nodiscard]] static MemoryCategory currentCategory() noexcept;
+
+    /**
+     * @brief Get a readable name for a category
+     */
+    [[nodiscard]] static std::string_view categoryName(MemoryCategory category) noexcept;
+
+    /**
+     * @brief Attributes image buffers allocated by this thread to a category
+     *
+     * Scopes nest; the previous category is restored on destruction.
+     *
+     * @code
+     * {
+     *     MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+     *     auto temp = ImageFactory::create(...);  // counted as a temporary
+     * }
+     * @endcode
+     */
+    class Scope {
+    public:
+        explicit Scope(MemoryCategory category) noexcept;
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        MemoryCategory m_previous;
+    };
+
+private:
+    MemoryTracker() = delete;
+};
+
+/**
+ * @brief Standard allocator that records its memory under a fixed category
+ *
+ * @tparam T Element type
+ * @tparam Category Subsystem the memory is accounted to
+ */
+template <typename T, MemoryCategory Category>
+class TrackedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = TrackedAllocator<U, Category>;
+    };
+
+    TrackedAllocator() noexcept = default;
+
+    template <typename U>
+    TrackedAllocator(const TrackedAllocator<U, Category>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t count) {
+        T* ptr = std::allocator<T>().allocate(count);
+        MemoryTracker::recordAllocation(Category, count * sizeof(T));
+        return ptr;
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept {
+        MemoryTracker::recordDeallocation(Category, count * sizeof(T));
+        std::allocator<T>().deallocate(ptr, count);
+    }
+
+    template <typename U>
+    bool operator==(const TrackedAllocator<U, Category>&) const noexcept {
+        return true;
+    }
+};
+
+/// Scratch vector of a filter, accounted as MemoryCategory::FilterTemporaries
+template <typename T>
+using TemporaryBuffer = std::vector<T, TrackedAllocator<T, MemoryCategory::FilterTemporaries>>;
+
+/// Staging vector of a codec, accounted as MemoryCategory::IOBuffers
+template <typename T>
+using IOBuffer = std::vector<T, TrackedAllocator<T, MemoryCategory::IOBuffers>>;
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_MEMORY_TRACKER_HPP
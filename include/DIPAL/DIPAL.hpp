@@ -6,6 +6,7 @@
 #include "Core/Concepts.hpp"
 #include "Core/Core.hpp"
 #include "Core/Error.hpp"
+#include "Core/MemoryTracker.hpp"
 #include "Core/Result.hpp"
 #include "Core/Types.hpp"
 
@@ -14,20 +15,35 @@
 #include "Image/ColorImage.hpp"
 #include "Image/GrayscaleImage.hpp"
 #include "Image/Image.hpp"
+#include "Image/ImageAllocator.hpp"
 #include "Image/ImageFactory.hpp"
 #include "Image/ImageView.hpp"
+#include "Image/IntegralImage.hpp"
+#include "Image/PixelAccessor.hpp"
+#include "Image/PixelBuffer.hpp"
 #include "Image/PixelIterator.hpp"
+#include "Image/PlanarImage.hpp"
+#include "Image/RLEBinaryImage.hpp"
+#include "Image/TypedImage.hpp"
 
 // Filter includes
+#include "Filters/BoxBlurFilter.hpp"
+#include "Filters/ConvolutionFilter.hpp"
+#include "Filters/FFT.hpp"
+#include "Filters/FilterPipeline.hpp"
 #include "Filters/FilterStrategy.hpp"
 #include "Filters/GaussianBlurFilter.hpp"
+#include "Filters/LocalStatistics.hpp"
 #include "Filters/MedianFilter.hpp"
+#include "Filters/RecursiveGaussian.hpp"
+#include "Filters/SeparableConvolution.hpp"
 #include "Filters/SobelFilter.hpp"
 #include "Filters/UnsharpMaskFilter.hpp"
 
 // I/O Includes
 #include "IO/BMPImageIO.hpp"
 #include "IO/ImageIO.hpp"
+#include "IO/MappedImageIO.hpp"
 #include "IO/PPMImageIO.hpp"
 
 // Processing includes
@@ -36,6 +52,11 @@
 #include "ImageProcessor/ParallelProcessor.hpp"
 #include "ImageProcessor/ProcessingCommand.hpp"
 
+// Morphology includes
+#include "Morphology/ConnectedComponents.hpp"
+#include "Morphology/DistanceTransform.hpp"
+#include "Morphology/Morphology.hpp"
+#include "Morphology/StructuringElement.hpp"
 // Observer includes
 #include "Observer/ProcessingObserver.hpp"
 #include "Observer/ProgressObserver.hpp"
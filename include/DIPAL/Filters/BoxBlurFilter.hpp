@@ -0,0 +1,89 @@
+// include/DIPAL/Filters/BoxBlurFilter.hpp
+#ifndef DIPAL_BOX_BLUR_FILTER_HPP
+#define DIPAL_BOX_BLUR_FILTER_HPP
+
+#include "FilterStrategy.hpp"
+
+namespace DIPAL {
+
+/**
+ * @brief Mean over a square window, at a cost independent of the radius
+ *
+ * Every output pixel is four lookups in an IntegralImage of the source.
+ * Windows are clipped at the image borders and average the pixels they
+ * still cover. Integer results are rounded to nearest, float results are
+ * stored unchanged.
+ */
+class BoxBlurFilter : public FilterStrategy {
+public:
+    using FilterStrategy::apply;
+
+    /**
+     * @brief Create a box blur
+     * @param radius Window radius; the window is 2 * radius + 1 pixels wide
+     * @throws std::invalid_argument if the radius is negative
+     */
+    explicit BoxBlurFilter(int radius = 1);
+
+    /**
+     * @brief Apply the box blur to an image
+     * @param image The image to process
+     * @return Result containing the blurred image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
+
+    /**
+     * @brief Blur a view directly into another view
+     * @param source The pixels to process
+     * @param destination Where to write the result; may be the source view itself
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTo(const ImageView& source,
+                                     const MutableImageView& destination) const override;
+
+    /**
+     * @brief Blur one tile from a source view that includes its halo
+     * @param source The tile and its halo
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTile(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const override;
+
+    /**
+     * @brief Get the neighbourhood read around each pixel
+     * @return The radius on every side
+     */
+    [[nodiscard]] FilterFootprint getFootprint() const override;
+
+    /**
+     * @brief Get the name of the filter
+     * @return "BoxBlur"
+     */
+    [[nodiscard]] std::string_view getName() const override;
+
+    /**
+     * @brief Clone the filter
+     * @return A new box blur with the same radius
+     */
+    [[nodiscard]] std::unique_ptr<FilterStrategy> clone() const override;
+
+    /**
+     * @brief Get the window radius
+     * @return Radius in pixels
+     */
+    [[nodiscard]] int getRadius() const noexcept;
+
+private:
+    [[nodiscard]] VoidResult blur(const ImageView& source,
+                                  const Rect& tile,
+                                  const MutableImageView& destination) const;
+
+    int m_radius;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_BOX_BLUR_FILTER_HPP
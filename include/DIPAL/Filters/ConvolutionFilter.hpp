@@ -0,0 +1,160 @@
+// include/DIPAL/Filters/ConvolutionFilter.hpp
+#ifndef DIPAL_CONVOLUTION_FILTER_HPP
+#define DIPAL_CONVOLUTION_FILTER_HPP
+
+#include "FilterStrategy.hpp"
+#include "SeparableConvolution.hpp"
+
+#include <complex>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace DIPAL {
+
+/**
+ * @brief Filter with an arbitrary 2D kernel
+ *
+ * Kernels are applied as given, without flipping: the output at (x, y) is
+ * the sum of kernel(i, j) * source(x + i - radiusX, y + j - radiusY), like
+ * SeparableConvolution. Borders are replicated; integer results are rounded
+ * to nearest and saturated, float results are stored unchanged. Grayscale,
+ * RGB and RGBA images of every depth are supported, alpha being filtered
+ * like the other channels.
+ *
+ * Three executions compute the same result:
+ * - Direct: every output sample sums all kernel taps, streaming the image
+ *   through a ring of kernelHeight float rows.
+ * - Separable: kernels of rank 1 (an outer product of a column and a row
+ *   kernel, detected at construction) run through SeparableConvolution,
+ *   at kernelWidth + kernelHeight taps per sample.
+ * - FFT: every channel is padded to a fast FFTPlan size, multiplied with
+ *   the kernel's spectrum and transformed back, at a cost that does not
+ *   depend on the kernel size. Kernel spectra are computed once per padded
+ *   size and kept for later images.
+ *
+ * Method::Auto picks separable for rank-1 kernels and otherwise compares
+ * the direct and FFT operation counts for the image size.
+ */
+class ConvolutionFilter : public FilterStrategy {
+public:
+    using FilterStrategy::apply;
+
+    /**
+     * @brief How the convolution is computed
+     */
+    enum class Method {
+        Auto,       ///< Choose per image
+        Direct,     ///< Sum every tap
+        Separable,  ///< Row and column passes; rank-1 kernels only
+        FFT         ///< Multiply spectra
+    };
+
+    /**
+     * @brief Create a convolution filter
+     * @param kernel kernelWidth * kernelHeight weights, row-major
+     * @param kernelWidth Odd kernel width
+     * @param kernelHeight Odd kernel height
+     * @param method Execution; Auto chooses per image
+     * @throws std::invalid_argument if a size is not odd and positive, the
+     *         kernel has the wrong number of weights, or Separable is
+     *         requested for a kernel of higher rank
+     */
+    ConvolutionFilter(std::vector<float> kernel,
+                      int kernelWidth,
+                      int kernelHeight,
+                      Method method = Method::Auto);
+
+    /**
+     * @brief Apply the convolution to an image
+     * @param image The image to process
+     * @return Result containing the filtered image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
+
+    /**
+     * @brief Filter a view directly into another view
+     * @param source The pixels to process
+     * @param destination Where to write the result; may be the source view itself
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTo(const ImageView& source,
+                                     const MutableImageView& destination) const override;
+
+    /**
+     * @brief Filter one tile from a source view that includes its halo
+     *
+     * The execution is chosen for the source size. Direct and separable
+     * convolutions only compute the tile; the FFT transforms the whole
+     * source and stores the tile.
+     *
+     * @param source The tile and its halo
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTile(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const override;
+
+    /**
+     * @brief Get the neighbourhood read around each pixel
+     * @return Half the kernel width left and right, half its height above and below
+     */
+    [[nodiscard]] FilterFootprint getFootprint() const override;
+
+    /**
+     * @brief Get the name of the filter
+     * @return "Convolution"
+     */
+    [[nodiscard]] std::string_view getName() const override;
+
+    /**
+     * @brief Clone the filter
+     * @return A new convolution filter with the same kernel and method
+     */
+    [[nodiscard]] std::unique_ptr<FilterStrategy> clone() const override;
+
+    /**
+     * @brief Get the execution used for images of a size
+     * @param width Image width
+     * @param height Image height
+     * @return Direct, Separable or FFT; never Auto
+     */
+    [[nodiscard]] Method getMethodFor(int width, int height) const noexcept;
+
+    /**
+     * @brief Check whether the kernel is an outer product of two 1D kernels
+     * @return true if the kernel has rank 1
+     */
+    [[nodiscard]] bool isSeparable() const noexcept { return m_separable.has_value(); }
+
+    [[nodiscard]] std::span<const float> getKernel() const noexcept { return m_kernel; }
+    [[nodiscard]] int getKernelWidth() const noexcept { return m_kernelWidth; }
+    [[nodiscard]] int getKernelHeight() const noexcept { return m_kernelHeight; }
+    [[nodiscard]] Method getMethod() const noexcept { return m_method; }
+
+private:
+    using Spectrum = std::vector<std::complex<float>>;
+
+    [[nodiscard]] std::shared_ptr<const Spectrum> kernelSpectrum(int width, int height) const;
+    [[nodiscard]] VoidResult convolve(const ImageView& source,
+                                      const Rect& tile,
+                                      const MutableImageView& destination) const;
+
+    std::vector<float> m_kernel;
+    int m_kernelWidth;
+    int m_kernelHeight;
+    Method m_method;
+    std::optional<SeparableConvolution> m_separable;  ///< Set for rank-1 kernels
+
+    mutable std::mutex m_spectraMutex;
+    mutable std::map<std::pair<int, int>, std::shared_ptr<const Spectrum>> m_spectra;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_CONVOLUTION_FILTER_HPP
@@ -0,0 +1,115 @@
+// include/DIPAL/Filters/FFT.hpp
+#ifndef DIPAL_FFT_HPP
+#define DIPAL_FFT_HPP
+
+#include "../Core/Error.hpp"
+
+#include <complex>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace DIPAL {
+
+class ThreadPool;
+
+/**
+ * @brief Plan for 2D discrete Fourier transforms of real images of one size
+ *
+ * A real width x height image (row-major floats) transforms into its
+ * non-redundant half spectrum: height rows of width / 2 + 1 complex bins,
+ * the rest following from conjugate symmetry. The forward transform is
+ * unnormalized; the inverse divides by width * height, so the two round
+ * trip.
+ *
+ * Rows go through a complex FFT of half their length, packing even and
+ * odd samples into one complex sequence (width must be even for this;
+ * odd widths use a full-length complex FFT). Columns are transformed in
+ * blocks gathered into contiguous memory, so the strided accesses stay
+ * within a few cache lines. Rows and column blocks are split among the
+ * workers of a pool.
+ *
+ * The 1D transforms are mixed-radix Stockham FFTs: lengths factor into
+ * radix-4, 2, 3 and 5 stages with dedicated butterflies, plus generic
+ * stages for any other prime, so every length is supported but
+ * goodSize() lengths are the fast ones. Twiddle factors are computed once
+ * per plan; plans are cached per size by get().
+ */
+class FFTPlan {
+public:
+    using Complex = std::complex<float>;
+
+    ~FFTPlan();
+    FFTPlan(const FFTPlan&) = delete;
+    FFTPlan& operator=(const FFTPlan&) = delete;
+
+    /**
+     * @brief Get the plan for a size, creating it on first use
+     *
+     * Plans are immutable and shared: every call for the same size returns
+     * the same plan, from any thread.
+     *
+     * @param width Image width, at least 1
+     * @param height Image height, at least 1
+     * @return Shared plan
+     * @throws std::invalid_argument if a dimension is not positive
+     */
+    [[nodiscard]] static std::shared_ptr<const FFTPlan> get(int width, int height);
+
+    /**
+     * @brief Smallest fast transform length of at least n
+     * @param n Required length, at least 1
+     * @return The smallest even number of the form 2^a * 3^b * 5^c that is >= n
+     */
+    [[nodiscard]] static int goodSize(int n);
+
+    /**
+     * @brief Transform a real image into its half spectrum
+     * @param image width * height samples, row-major
+     * @param spectrum height * getSpectrumWidth() bins, row-major
+     * @param pool Workers; nullptr runs on the calling thread
+     * @return VoidResult, an error if a span has the wrong size
+     */
+    [[nodiscard]] VoidResult forward(std::span<const float> image,
+                                     std::span<Complex> spectrum,
+                                     ThreadPool* pool = nullptr) const;
+
+    /**
+     * @brief Transform a half spectrum back into a real image
+     * @param spectrum height * getSpectrumWidth() bins; overwritten as scratch
+     * @param image width * height samples, row-major
+     * @param pool Workers; nullptr runs on the calling thread
+     * @return VoidResult, an error if a span has the wrong size
+     */
+    [[nodiscard]] VoidResult inverse(std::span<Complex> spectrum,
+                                     std::span<float> image,
+                                     ThreadPool* pool = nullptr) const;
+
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+
+    /**
+     * @brief Get the number of bins per spectrum row
+     * @return width / 2 + 1
+     */
+    [[nodiscard]] int getSpectrumWidth() const noexcept { return m_width / 2 + 1; }
+
+private:
+    struct Transform;
+
+    FFTPlan(int width, int height);
+
+    void forwardRows(std::span<const float> image, std::span<Complex> spectrum, int y0, int y1) const;
+    void inverseRows(std::span<const Complex> spectrum, std::span<float> image, int y0, int y1) const;
+    void columns(std::span<Complex> spectrum, bool inverse, int block0, int block1) const;
+
+    int m_width;
+    int m_height;
+    std::unique_ptr<const Transform> m_rows;     ///< Length width / 2, or width if odd
+    std::unique_ptr<const Transform> m_columns;  ///< Length height
+    std::vector<Complex> m_realTwiddles;         ///< exp(-2 pi i k / width), k <= width / 2
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_FFT_HPP
@@ -0,0 +1,144 @@
+// include/DIPAL/Filters/FilterPipeline.hpp
+#ifndef DIPAL_FILTER_PIPELINE_HPP
+#define DIPAL_FILTER_PIPELINE_HPP
+
+#include "FilterStrategy.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace DIPAL {
+
+/**
+ * @brief Chain of filters executed tile by tile
+ *
+ * Applying the stages one after another materializes a full-size
+ * intermediate image between every two of them, so a chain of n filters
+ * streams the image through memory 2n times. The pipeline instead splits
+ * the output into tiles and runs the whole chain on one tile before moving
+ * to the next: every stage filters a region grown by the footprints of the
+ * stages after it, so the intermediates are a few hundred kilobytes and
+ * stay in the core's L2 cache. Each stage computes its region with
+ * applyTile() from the one before, into scratch images every worker reuses
+ * from tile to tile, and the last stage writes straight into the output.
+ * Regions are clipped at the image borders,
+ * where each stage replicates borders as it would on the whole image, and
+ * the result matches running the stages one by one.
+ *
+ * Runs of local stages are fused this way; a stage whose footprint is not
+ * local (e.g. a normalized Sobel) splits the chain and runs on the whole
+ * intermediate image. Tiles are shared among the workers of the shared
+ * pool (see sharedPoolFor()) when the image is large.
+ */
+class FilterPipeline : public FilterStrategy {
+public:
+    using FilterStrategy::apply;
+
+    /// Bytes of one stage's haloed tile the automatic tile size aims for
+    static constexpr std::size_t kTileBytes = std::size_t{128} << 10;
+
+    /**
+     * @brief Create an empty pipeline; it passes images through unchanged
+     */
+    FilterPipeline() = default;
+
+    /**
+     * @brief Create a pipeline from a chain of filters
+     * @param stages Filters, applied first to last
+     * @throws std::invalid_argument if a stage is null
+     */
+    explicit FilterPipeline(std::vector<std::unique_ptr<FilterStrategy>> stages);
+
+    /**
+     * @brief Append a filter to the chain
+     * @param stage Filter applied after the current last stage
+     * @return This pipeline
+     * @throws std::invalid_argument if the stage is null
+     */
+    FilterPipeline& addStage(std::unique_ptr<FilterStrategy> stage);
+
+    /**
+     * @brief Run the chain on an image
+     * @param image The image to process
+     * @return Result containing the output of the last stage or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
+
+    /**
+     * @brief Run the chain on a view; tiles read the view without copying it
+     * @param view The pixels to process
+     * @return Result containing the output of the last stage or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const ImageView& view) const override;
+
+    /**
+     * @brief Run the chain on one tile from a source view that includes its halo
+     * @param source The tile and the halo of the whole chain
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile, of the last stage's output type
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTile(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const override;
+
+    /**
+     * @brief Get the neighbourhood the whole chain reads around each pixel
+     * @return Sum of the stage footprints; local only if every stage is
+     */
+    [[nodiscard]] FilterFootprint getFootprint() const override;
+
+    /**
+     * @brief Get the format of the last stage's output for an input format
+     * @param type Pixel type of the input
+     * @param depth Sample depth of the input
+     * @return The input format passed through every stage in turn
+     */
+    [[nodiscard]] ImageFormat getOutputFormat(Image::Type type, Image::Depth depth) const override;
+
+    /**
+     * @brief Get the name of the filter
+     * @return "FilterPipeline"
+     */
+    [[nodiscard]] std::string_view getName() const override;
+
+    /**
+     * @brief Clone the pipeline
+     * @return A new pipeline with clones of every stage
+     */
+    [[nodiscard]] std::unique_ptr<FilterStrategy> clone() const override;
+
+    /**
+     * @brief Set the size of the output tiles
+     *
+     * Smaller tiles keep the intermediates in faster caches but recompute
+     * more halo pixels. 0 picks a size from kTileBytes and the footprints.
+     *
+     * @param width Tile width, or 0 for automatic
+     * @param height Tile height, or 0 for automatic
+     * @throws std::invalid_argument if a size is negative
+     */
+    void setTileSize(int width, int height);
+
+    [[nodiscard]] int getTileWidth() const noexcept { return m_tileWidth; }
+    [[nodiscard]] int getTileHeight() const noexcept { return m_tileHeight; }
+    [[nodiscard]] std::size_t getStageCount() const noexcept { return m_stages.size(); }
+
+    /**
+     * @brief Get a stage of the chain
+     * @param index Position of the stage, 0 being applied first
+     * @return The stage
+     * @throws std::out_of_range if there is no such stage
+     */
+    [[nodiscard]] const FilterStrategy& getStage(std::size_t index) const;
+
+private:
+    std::vector<std::unique_ptr<FilterStrategy>> m_stages;
+    int m_tileWidth = 0;
+    int m_tileHeight = 0;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_FILTER_PIPELINE_HPP
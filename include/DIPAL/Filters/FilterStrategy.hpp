@@ -7,10 +7,38 @@
 #include <string_view>
 
 #include "../Image/Image.hpp"
+#include "../Image/ImageView.hpp"
 #include "../Core/Error.hpp"
 
 namespace DIPAL {
 
+/**
+ * @brief How far a filter reads around each output pixel, per side
+ *
+ * An output pixel depends on the source pixels from x - left to x + right
+ * and from y - top to y + bottom. Executors that split an image use it to
+ * give every piece the neighbouring pixels it needs. Filters whose output
+ * also depends on the image as a whole (e.g. normalizing by the strongest
+ * response) are not local and must see the whole image at once.
+ */
+struct FilterFootprint {
+    int left = 0;
+    int top = 0;
+    int right = 0;
+    int bottom = 0;
+    bool local = true;  ///< false if pieces cannot be filtered independently
+};
+
+/**
+ * @brief Pixel type and sample depth of an image a filter reads or writes
+ */
+struct ImageFormat {
+    Image::Type type = Image::Type::Grayscale;
+    Image::Depth depth = Image::Depth::UInt8;
+
+    bool operator==(const ImageFormat&) const = default;
+};
+
 /**
  * @brief Abstract strategy for image filters
  *
@@ -27,6 +55,76 @@ public:
      */
     [[nodiscard]] virtual Result<std::unique_ptr<Image>> apply(const Image& image) const = 0;
 
+    /**
+     * @brief Apply the filter to a view, e.g. a region of interest or a tile
+     *
+     * The default implementation copies the viewed rows into a temporary image
+     * and forwards to apply(const Image&).
+     *
+     * @param view The pixels to process
+     * @return Result containing the filtered image (same size as the view) or error
+     */
+    [[nodiscard]] virtual Result<std::unique_ptr<Image>> apply(const ImageView& view) const;
+
+    /**
+     * @brief Apply the filter to a view and write the result into another view
+     *
+     * Lets callers filter a region of an image in place. The destination must
+     * have the same size and type as the source and may alias it.
+     *
+     * @param source The pixels to process
+     * @param destination Where to write the filtered pixels
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] virtual VoidResult applyTo(const ImageView& source,
+                                             const MutableImageView& destination) const;
+
+    /**
+     * @brief Get the neighbourhood the filter reads around each pixel
+     *
+     * The default is an empty footprint: each output pixel depends only on
+     * the source pixel at the same position.
+     *
+     * @return Radius per side
+     */
+    [[nodiscard]] virtual FilterFootprint getFootprint() const;
+
+    /**
+     * @brief Get the format of the filter's output for an input format
+     *
+     * Lets executors allocate the output before any pixel is filtered. The
+     * default is the input format; filters that change it (Sobel turns color
+     * into grayscale) override this.
+     *
+     * @param type Pixel type of the input
+     * @param depth Sample depth of the input
+     * @return Pixel type and depth of the output
+     */
+    [[nodiscard]] virtual ImageFormat getOutputFormat(Image::Type type, Image::Depth depth) const;
+
+    /**
+     * @brief Filter one tile from a source view that includes its halo
+     *
+     * The source holds the tile and, as far as the image extends, the
+     * pixels around it that getFootprint() says the filter reads; its edges
+     * are treated as the image borders. Only the tile is computed, straight
+     * into the destination, so tiles filtered in parallel out of one image
+     * join without seams and without copying regions out and back.
+     * Filters that are not local see the source as the whole image.
+     *
+     * The default implementation filters the whole source with apply() and
+     * copies the tile out of the result.
+     *
+     * @param source The tile and its halo
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile: tile-sized, of the filter's
+     *                    output type, and not overlapping the source
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] virtual VoidResult applyTile(const ImageView& source,
+                                               const Rect& tile,
+                                               const MutableImageView& destination) const;
+
     /**
      * @brief Get the name of the filter
      * @return Filter name
@@ -38,8 +136,36 @@ public:
      * @return A new filter that is a copy of this one
      */
     [[nodiscard]] virtual std::unique_ptr<FilterStrategy> clone() const = 0;
+
+protected:
+    /**
+     * @brief Check that a tile lies in the source and matches the destination size
+     * @return VoidResult, an InvalidParameter error if not
+     */
+    [[nodiscard]] static VoidResult validateTile(const ImageView& source,
+                                                 const Rect& tile,
+                                                 const MutableImageView& destination);
 };
 
+/**
+ * @brief Create an image to receive a filter's output, e.g. from applyTile()
+ *
+ * The output type and depth are those getOutputFormat() gives for the
+ * source's.
+ *
+ * @param filter The filter that will write the image
+ * @param source Pixels the filter will read
+ * @param width Width of the output
+ * @param height Height of the output
+ * @param layout Row storage layout of the output
+ * @return Result containing the (uninitialized) output image or error
+ */
+[[nodiscard]] Result<std::unique_ptr<Image>> createFilterOutput(const FilterStrategy& filter,
+                                                                const ImageView& source,
+                                                                int width,
+                                                                int height,
+                                                                Image::RowLayout layout);
+
 } // namespace DIPAL
 
 #endif // DIPAL_FILTER_STRATEGY_HPP
@@ -2,22 +2,55 @@
 #ifndef DIPAL_GAUSSIAN_BLUR_FILTER_HPP
 #define DIPAL_GAUSSIAN_BLUR_FILTER_HPP
 
+#include <optional>
 #include <vector>
 #include "FilterStrategy.hpp"
+#include "RecursiveGaussian.hpp"
+#include "SeparableConvolution.hpp"
 
 namespace DIPAL {
 
 /**
  * @brief Gaussian blur filter implementation
+ *
+ * Runs on SeparableConvolution with the same kernel along rows and columns,
+ * or, for large sigma, on RecursiveGaussian, whose cost does not grow with
+ * the kernel. See RecursiveGaussian for how far the two may differ.
  */
 class GaussianBlurFilter : public FilterStrategy {
 public:
+    using FilterStrategy::apply;
+
+    /**
+     * @brief How the blur is computed
+     */
+    enum class Method {
+        Auto,      ///< Recursive from kRecursiveSigma up if the kernel covers +-3 sigma, else FIR
+        FIR,       ///< Convolution with the truncated kernel
+        Recursive  ///< Recursive filter approximating the untruncated Gaussian
+    };
+
+    /// Sigma from which Method::Auto switches to the recursive filter
+    static constexpr float kRecursiveSigma = 4.0f;
+
     /**
      * @brief Create a Gaussian blur filter
      * @param sigma Standard deviation of the Gaussian kernel
      * @param kernelSize Size of the kernel (must be odd)
+     * @param method How to compute the blur
+     * @throws std::invalid_argument for an invalid kernel, or Method::Recursive
+     *         with sigma below RecursiveGaussian::kMinSigma
      */
-    GaussianBlurFilter(float sigma = 1.0f, int kernelSize = 3);
+    GaussianBlurFilter(float sigma = 1.0f, int kernelSize = 3, Method method = Method::Auto);
+
+    /**
+     * @brief Compute a normalized 1D Gaussian kernel
+     * @param sigma Standard deviation
+     * @param kernelSize Number of taps (must be odd)
+     * @return Kernel weights summing to 1
+     * @throws std::invalid_argument if sigma is not positive or the size is not positive and odd
+     */
+    [[nodiscard]] static std::vector<float> createKernel(float sigma, int kernelSize);
 
     /**
      * @brief Apply Gaussian blur to an image
@@ -26,6 +59,42 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Blur a view directly into another view, without intermediate copies
+     * @param source The pixels to process
+     * @param destination Where to write the result; may be the source view itself
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTo(const ImageView& source,
+                                     const MutableImageView& destination) const override;
+
+    /**
+     * @brief Blur one tile from a source view that includes its halo
+     *
+     * The recursive filter runs its rows over the whole source, then its
+     * columns over the tile's columns only, and writes the tile straight
+     * into the destination.
+     *
+     * @param source The tile and its halo
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTile(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const override;
+
+    /**
+     * @brief Get the neighbourhood read around each pixel
+     *
+     * The recursive filter reads the whole image; its footprint is reported
+     * as RecursiveGaussian::getRadius(), past which its impulse response
+     * changes no integer sample.
+     *
+     * @return The kernel radius, or the recursive radius, on every side
+     */
+    [[nodiscard]] FilterFootprint getFootprint() const override;
+
     /**
      * @brief Get the name of the filter
      * @return "GaussianBlur"
@@ -56,15 +125,25 @@ public:
      */
     [[nodiscard]] std::span<const float> getKernel() const noexcept;
 
+    /**
+     * @brief Get the method requested at construction
+     * @return Method, possibly Auto
+     */
+    [[nodiscard]] Method getMethod() const noexcept;
+
+    /**
+     * @brief Check whether the recursive filter is used
+     * @return True if the blur runs on RecursiveGaussian
+     */
+    [[nodiscard]] bool isRecursive() const noexcept;
+
 private:
     float m_sigma;
     int m_kernelSize;
+    Method m_method;
     std::vector<float> m_kernel;
-
-    /**
-     * @brief Generate the Gaussian kernel
-     */
-    void generateKernel();
+    SeparableConvolution m_convolution;
+    std::optional<RecursiveGaussian> m_recursive;
 };
 
 } // namespace DIPAL
@@ -0,0 +1,78 @@
+// include/DIPAL/Filters/LocalStatistics.hpp
+#ifndef DIPAL_LOCAL_STATISTICS_HPP
+#define DIPAL_LOCAL_STATISTICS_HPP
+
+#include "../Core/Error.hpp"
+#include "../Image/Image.hpp"
+#include "../Image/ImageView.hpp"
+
+#include <memory>
+
+namespace DIPAL {
+
+class ThreadPool;
+
+/**
+ * @brief Mean and variance of every pixel's neighbourhood
+ *
+ * The building blocks of adaptive thresholds and local contrast
+ * normalization. Each statistic is computed from an IntegralImage of the
+ * samples and of their squares, so the cost per pixel does not depend on
+ * the radius.
+ *
+ * Windows are squares of 2 * radius + 1 pixels clipped at the image
+ * borders. Results are float images of the source's type (Grayscale, RGB or
+ * RGBA, channels computed independently) in the units of the source
+ * samples: the mean of an 8-bit image lies in [0, 255], so it can be
+ * compared with the source pixels directly.
+ */
+class LocalStatistics {
+public:
+    /**
+     * @brief Both statistics from one pass
+     */
+    struct Moments {
+        std::unique_ptr<Image> mean;      ///< Window means
+        std::unique_ptr<Image> variance;  ///< Population variances of the windows
+    };
+
+    /**
+     * @brief Compute the window mean of every pixel
+     * @param view Grayscale, RGB or RGBA pixels of any depth
+     * @param radius Window radius, at least 0
+     * @param pool Workers; nullptr uses the shared pool for large images
+     * @return Result containing a float image of means or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> mean(const ImageView& view,
+                                                             int radius,
+                                                             ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Compute the window variance of every pixel
+     * @param view Grayscale, RGB or RGBA pixels of any depth
+     * @param radius Window radius, at least 0
+     * @param pool Workers; nullptr uses the shared pool for large images
+     * @return Result containing a float image of variances or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> variance(const ImageView& view,
+                                                                 int radius,
+                                                                 ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Compute the window mean and variance of every pixel
+     * @param view Grayscale, RGB or RGBA pixels of any depth
+     * @param radius Window radius, at least 0
+     * @param pool Workers; nullptr uses the shared pool for large images
+     * @return Result containing both float images or error
+     */
+    [[nodiscard]] static Result<Moments> meanAndVariance(const ImageView& view,
+                                                         int radius,
+                                                         ThreadPool* pool = nullptr);
+
+private:
+    LocalStatistics() = delete;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_LOCAL_STATISTICS_HPP
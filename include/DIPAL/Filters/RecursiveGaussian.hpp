@@ -0,0 +1,113 @@
+// include/DIPAL/Filters/RecursiveGaussian.hpp
+#ifndef DIPAL_RECURSIVE_GAUSSIAN_HPP
+#define DIPAL_RECURSIVE_GAUSSIAN_HPP
+
+#include "../Core/Error.hpp"
+#include "../Image/Image.hpp"
+#include "../Image/ImageView.hpp"
+
+#include <array>
+#include <memory>
+
+namespace DIPAL {
+
+class ThreadPool;
+
+/**
+ * @brief Gaussian blur by recursive (IIR) filtering, at a cost independent of sigma
+ *
+ * Young and van Vliet's third-order recursive approximation: a causal and
+ * an anti-causal pass along every row, then along every column, about 16
+ * multiply-adds per sample whatever the sigma. Borders are replicated with
+ * Triggs and Sdika's initial conditions, so the result matches a Gaussian
+ * applied to the image extended by its edge pixels.
+ *
+ * Accuracy, against the FIR blur with a kernel of +-4 sigma: the largest
+ * difference is within 1.5% of the full sample range (3 levels on 8-bit
+ * images) for sigma from 4 up, and within 1% from sigma 6 up, shrinking
+ * further as sigma grows. The worst case is white noise, whose highest
+ * frequencies the third-order filter attenuates least accurately; smooth
+ * content agrees far more closely. Below sigma 4 the error grows quickly
+ * (about 6% at sigma 1), and the FIR blur is both exact and cheap there.
+ *
+ * Rows are filtered in parallel strips and columns in parallel bands of a
+ * float working image; the recursions carry their state in double precision.
+ */
+class RecursiveGaussian {
+public:
+    /// Smallest sigma for which the filter coefficients are defined
+    static constexpr float kMinSigma = 0.5f;
+
+    /**
+     * @brief Create a recursive Gaussian
+     * @param sigma Standard deviation in pixels
+     * @throws std::invalid_argument if sigma is below kMinSigma
+     */
+    explicit RecursiveGaussian(float sigma);
+
+    /**
+     * @brief Blur a view into another view
+     *
+     * Grayscale, RGB and RGBA images of every depth are supported; alpha is
+     * filtered like the other channels. The destination may be the source
+     * view itself.
+     *
+     * @param source The pixels to filter
+     * @param destination Where to write the result; same size, type and depth
+     * @param pool Workers for the passes; nullptr uses the shared pool for
+     *             large images and runs small ones on the calling thread
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult apply(const ImageView& source,
+                                   const MutableImageView& destination,
+                                   ThreadPool* pool = nullptr) const;
+
+    /**
+     * @brief Blur one tile of a view, reading the rest of the view as context
+     *
+     * Only the tile's columns are filtered vertically and only its rows are
+     * stored. With getRadius() pixels of context on every side that the
+     * image has, the tile matches the same pixels of a whole-image blur.
+     *
+     * @param source The tile and the pixels around it
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile; tile-sized, same type and depth
+     * @param pool Workers for the passes, as above
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult apply(const ImageView& source,
+                                   const Rect& tile,
+                                   const MutableImageView& destination,
+                                   ThreadPool* pool = nullptr) const;
+
+    /**
+     * @brief Blur an image into a new image of the same type and layout
+     * @param image The image to filter
+     * @param pool Workers for the passes, as above
+     * @return Result containing the blurred image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image,
+                                                       ThreadPool* pool = nullptr) const;
+
+    [[nodiscard]] float getSigma() const noexcept { return m_sigma; }
+
+    /**
+     * @brief Distance past which pixels no longer change the result
+     *
+     * A full-range 16-bit step beyond it moves a sample by less than half
+     * the float LSB at 0.5, so a tile with that much context computes the
+     * same samples as the whole image. About 20 to 24 sigma.
+     */
+    [[nodiscard]] int getRadius() const noexcept { return m_radius; }
+
+private:
+    float m_sigma;
+    double m_gain;                    // B: weight of the input sample
+    std::array<double, 3> m_feedback; // a1..a3: weights of the previous outputs
+    std::array<double, 9> m_boundary; // Triggs-Sdika matrix, row-major
+    int m_radius;                     // see getRadius()
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_RECURSIVE_GAUSSIAN_HPP
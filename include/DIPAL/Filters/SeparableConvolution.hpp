@@ -0,0 +1,139 @@
+// include/DIPAL/Filters/SeparableConvolution.hpp
+#ifndef DIPAL_SEPARABLE_CONVOLUTION_HPP
+#define DIPAL_SEPARABLE_CONVOLUTION_HPP
+
+#include "../Core/Error.hpp"
+#include "../Image/Image.hpp"
+#include "../Image/ImageView.hpp"
+
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace DIPAL {
+
+/**
+ * @brief Convolution with a kernel that factors into a row and a column kernel
+ *
+ * The engine streams the image top to bottom: each source row is converted
+ * to float once, padded by replicating its border pixels, and filtered
+ * horizontally into a ring buffer that holds as many rows as the vertical
+ * kernel has taps. Every output row is then a weighted sum of ring rows, so
+ * both passes read memory sequentially and the working set is a few rows
+ * instead of a full intermediate image.
+ *
+ * Both passes run over the interleaved samples of a row as one flat array
+ * (channel c of pixel x at x * channels + c), which lets the same AVX2/SSE2
+ * loops serve 1 to 4 channels. Rows are padded to whole SIMD blocks, so
+ * every sample goes through the same arithmetic regardless of its position
+ * or the channel count. Borders are replicated; integer results are rounded
+ * to nearest and saturated, float results are stored unchanged.
+ */
+class SeparableConvolution {
+public:
+    /**
+     * @brief Receives one finished output row
+     *
+     * Called with the row index and its interleaved samples as floats,
+     * before rounding or saturation. The samples are only valid during the
+     * call.
+     */
+    using RowSink = std::function<void(int y, std::span<const float> samples)>;
+
+    /**
+     * @brief Create an engine for different row and column kernels
+     * @param horizontal Row kernel, odd length, centred
+     * @param vertical Column kernel, odd length, centred
+     * @throws std::invalid_argument if a kernel is empty or of even length
+     */
+    SeparableConvolution(std::vector<float> horizontal, std::vector<float> vertical);
+
+    /**
+     * @brief Create an engine applying the same kernel along rows and columns
+     * @param kernel Odd-length, centred kernel
+     * @throws std::invalid_argument if the kernel is empty or of even length
+     */
+    explicit SeparableConvolution(std::vector<float> kernel);
+
+    /**
+     * @brief Convolve a view into another view
+     *
+     * Grayscale, RGB and RGBA images of every depth are supported; alpha is
+     * filtered like the other channels. The destination may be the source
+     * view itself (in-place filtering), but must not partially overlap it.
+     *
+     * @param source The pixels to filter
+     * @param destination Where to write the result; same size, type and depth
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult apply(const ImageView& source,
+                                   const MutableImageView& destination) const;
+
+    /**
+     * @brief Convolve one tile of a view into a tile-sized view
+     *
+     * Only the source rows the tile depends on are filtered, and only the
+     * tile's columns are stored; the source edges are treated as the image
+     * borders. The destination must not overlap the source.
+     *
+     * @param source The tile and the pixels around it
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile; tile-sized, of the source type and depth
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult apply(const ImageView& source,
+                                   const Rect& tile,
+                                   const MutableImageView& destination) const;
+
+    /**
+     * @brief Convolve a range of rows and hand each one to a callback
+     *
+     * Lets a caller consume the filtered rows as they are produced, e.g. to
+     * combine them with the source, without storing a filtered image. Rows
+     * are delivered in order; only the source rows they depend on are read,
+     * so disjoint ranges of the same image may be streamed concurrently.
+     *
+     * @param source The pixels to filter
+     * @param firstRow First output row
+     * @param lastRow One past the last output row
+     * @param sink Called once per output row
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult stream(const ImageView& source,
+                                    int firstRow,
+                                    int lastRow,
+                                    const RowSink& sink) const;
+
+    /**
+     * @brief Convolve an image into a new image of the same type and layout
+     * @param image The image to filter
+     * @return Result containing the filtered image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const;
+
+    [[nodiscard]] std::span<const float> getHorizontalKernel() const noexcept {
+        return m_horizontal;
+    }
+    [[nodiscard]] std::span<const float> getVerticalKernel() const noexcept { return m_vertical; }
+
+    /**
+     * @brief Get the number of pixels read left and right of each output pixel
+     */
+    [[nodiscard]] int getRadiusX() const noexcept {
+        return static_cast<int>(m_horizontal.size()) / 2;
+    }
+
+    /**
+     * @brief Get the number of rows read above and below each output row
+     */
+    [[nodiscard]] int getRadiusY() const noexcept { return static_cast<int>(m_vertical.size()) / 2; }
+
+private:
+    std::vector<float> m_horizontal;
+    std::vector<float> m_vertical;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_SEPARABLE_CONVOLUTION_HPP
@@ -8,16 +8,60 @@ namespace DIPAL {
 
 /**
  * @brief Sobel edge detection filter
- * 
- * Detects edges using Sobel operators in horizontal and vertical directions
+ *
+ * Detects edges using Sobel operators in horizontal and vertical directions.
+ * The output is a grayscale image of the input's sample depth; color input
+ * is converted to luminance first.
+ *
+ * Every source row is read once: its luminance goes into a ring of three
+ * float rows, from which both derivatives, the magnitude and, on request,
+ * the quantized orientation are computed in a single SIMD pass. The
+ * Scharr and Prewitt operators are compiled variants of the same pass.
+ * Large images are filtered in parallel horizontal strips.
  */
 class SobelFilter : public FilterStrategy {
 public:
+    using FilterStrategy::apply;
+
+    /**
+     * @brief 3x3 derivative operator
+     *
+     * Each weighs the centre row (or column) of its smoothing direction
+     * against the outer two: 2:1 for Sobel, 10:3 for Scharr (closer to
+     * rotation invariant), 1:1 for Prewitt.
+     */
+    enum class Operator {
+        Sobel,
+        Scharr,
+        Prewitt
+    };
+
+    /**
+     * @brief How the two derivatives combine into the magnitude
+     */
+    enum class Norm {
+        L1,  ///< |gx| + |gy|, cheaper
+        L2   ///< sqrt(gx^2 + gy^2)
+    };
+
+    /// Most orientation bins computeGradient accepts
+    static constexpr int kMaxOrientationBins = 64;
+
+    /**
+     * @brief Magnitude and orientation of the gradient
+     */
+    struct Gradient {
+        std::unique_ptr<Image> magnitude;    ///< Same as the output of apply()
+        std::unique_ptr<Image> orientation;  ///< 8-bit bin indices, or null if not requested
+    };
+
     /**
      * @brief Create a Sobel filter
-     * @param normalize If true, normalize the output to 0-255 range
+     * @param normalize If true, scale the output so the strongest edge is the maximum sample value
+     * @param op Derivative operator
+     * @param norm Magnitude norm
      */
-    explicit SobelFilter(bool normalize = true);
+    explicit SobelFilter(bool normalize = true, Operator op = Operator::Sobel, Norm norm = Norm::L2);
 
     /**
      * @brief Apply Sobel filter to an image
@@ -26,6 +70,48 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Compute the gradient magnitude and quantized orientation together
+     *
+     * Orientations are those of the gradient modulo 180 degrees, split into
+     * orientationBins equal bins centred on 0, 180 / bins, ... degrees: with
+     * 4 bins, 0 is a horizontal gradient (a vertical edge) and 2 a vertical
+     * one, as non-maximum suppression expects. Angles grow from +x towards
+     * +y, which points down the image. Flat pixels are in bin 0.
+     *
+     * @param image The image to process
+     * @param orientationBins Number of bins, 1 to kMaxOrientationBins, or 0 for no orientation
+     * @return Result containing the gradient images or error
+     */
+    [[nodiscard]] Result<Gradient> computeGradient(const Image& image, int orientationBins) const;
+
+    /**
+     * @brief Filter one tile from a source view that includes its halo
+     *
+     * A normalizing filter scales by the strongest edge of the tile, so
+     * its tiles only match apply() when the tile is the whole source.
+     *
+     * @param source The tile and its halo
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile: grayscale, of the source depth
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTile(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const override;
+
+    /**
+     * @brief Get the neighbourhood read around each pixel
+     * @return One pixel on every side; not local when normalizing
+     */
+    [[nodiscard]] FilterFootprint getFootprint() const override;
+
+    /**
+     * @brief Get the format of the gradient magnitude
+     * @return Grayscale of the input depth
+     */
+    [[nodiscard]] ImageFormat getOutputFormat(Image::Type type, Image::Depth depth) const override;
+
     /**
      * @brief Get the name of the filter
      * @return "SobelFilter"
@@ -44,8 +130,28 @@ public:
      */
     [[nodiscard]] bool isNormalized() const noexcept;
 
+    /**
+     * @brief Get the derivative operator
+     * @return Operator
+     */
+    [[nodiscard]] Operator getOperator() const noexcept;
+
+    /**
+     * @brief Get the magnitude norm
+     * @return Norm
+     */
+    [[nodiscard]] Norm getNorm() const noexcept;
+
 private:
+    [[nodiscard]] VoidResult computeInto(const ImageView& source,
+                                         const Rect& tile,
+                                         const MutableImageView& magnitude,
+                                         const MutableImageView& orientation,
+                                         int orientationBins) const;
+
     bool m_normalize;
+    Operator m_operator;
+    Norm m_norm;
 };
 
 } // namespace DIPAL
@@ -3,6 +3,7 @@
 #define DIPAL_UNSHARP_MASK_FILTER_HPP
 
 #include "FilterStrategy.hpp"
+#include "SeparableConvolution.hpp"
 
 namespace DIPAL {
 
@@ -11,14 +12,24 @@ namespace DIPAL {
  *
  * Enhances edges by subtracting a blurred version of the image from the original.
  * The formula is: result = original + amount * (original - blurred)
+ *
+ * The blur is a SeparableConvolution with a Gaussian kernel of
+ * sigma = radius, built once at construction. Its rows are streamed: each
+ * blurred row is sharpened against the source as soon as it is complete
+ * and written straight to the output, so besides the result only a few
+ * rows per thread are held. Large images are processed in parallel
+ * horizontal strips.
  */
 class UnsharpMaskFilter : public FilterStrategy {
 public:
+    using FilterStrategy::apply;
+
     /**
      * @brief Create an unsharp mask filter
      * @param amount Strength of the sharpening effect (typically 0.5-2.0)
      * @param radius Blur radius for the mask
-     * @param threshold Minimum brightness difference to apply sharpening
+     * @param threshold Minimum brightness difference to apply sharpening (on the 8-bit scale;
+     *                  rescaled for 16-bit and float images)
      */
     UnsharpMaskFilter(float amount = 1.0f, float radius = 1.0f, uint8_t threshold = 0);
 
@@ -29,6 +40,26 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Sharpen one tile from a source view that includes its halo
+     *
+     * Only the source rows and columns around the tile are blurred.
+     *
+     * @param source The tile and its halo
+     * @param tile Position of the tile in the source
+     * @param destination Where to write the tile
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult applyTile(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const override;
+
+    /**
+     * @brief Get the neighbourhood read around each pixel
+     * @return The kernel radius on every side
+     */
+    [[nodiscard]] FilterFootprint getFootprint() const override;
+
     /**
      * @brief Get the name of the filter
      * @return "UnsharpMaskFilter"
@@ -60,9 +91,14 @@ public:
     [[nodiscard]] uint8_t getThreshold() const noexcept;
 
 private:
+    [[nodiscard]] VoidResult sharpen(const ImageView& source,
+                                     const Rect& tile,
+                                     const MutableImageView& destination) const;
+
     float m_amount;       ///< Strength of the sharpening effect
     float m_radius;       ///< Blur radius for the mask
     uint8_t m_threshold;  ///< Minimum brightness difference to apply sharpening
+    SeparableConvolution m_blur;  ///< Gaussian blur producing the mask
 };
 
 }  // namespace DIPAL
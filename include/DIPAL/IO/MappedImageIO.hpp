@@ -0,0 +1,112 @@
+// include/DIPAL/IO/MappedImageIO.hpp
+#ifndef DIPAL_MAPPED_IMAGE_IO_HPP
+#define DIPAL_MAPPED_IMAGE_IO_HPP
+
+#include "../Core/Error.hpp"
+#include "../Image/Image.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace DIPAL {
+
+/**
+ * @brief Images whose pixels are a memory mapping of a file
+ *
+ * Mapping lets images larger than physical memory be processed: the kernel
+ * pages rows in as they are read and writes them back (or drops them) under
+ * memory pressure. The returned images are ordinary Image objects (TypedImage
+ * instances, so 8-bit ones are GrayscaleImage or ColorImage) and work with
+ * getData()/getRow(), views, filters and transforms.
+ *
+ * Files are mapped in place when their pixel rows already have the in-memory
+ * layout:
+ * - binary PGM/PPM (P5/P6) with a maximum value of 255, as written by
+ *   PPMImageIO, maps to a packed 8-bit grayscale or RGB image;
+ * - the native raw format (see saveRaw()) maps any grayscale/RGB/RGBA image
+ *   of any depth and row layout.
+ *
+ * BMP files cannot be mapped: they store rows bottom-up, in BGR order and
+ * padded to four bytes. Load them with BMPImageIO instead.
+ *
+ * Copies of a read-only mapped image share the mapping copy-on-write:
+ * whichever of them is written first takes a private copy in allocator
+ * memory. A read-write mapping is exclusive (see PixelBuffer::setExclusive()):
+ * copying or cloning the image copies its pixels at once, so the mapped image
+ * always writes to the file and its copies never do.
+ */
+class MappedImageIO {
+public:
+    /**
+     * @brief How the pixels of a mapped file may be changed
+     */
+    enum class Access {
+        ReadOnly,   ///< The file is never modified; writes stay private to the process
+        ReadWrite   ///< Writes to the image go to the file
+    };
+
+    /// Size of the native raw header; pixel data always starts at this page-aligned
+    /// offset, and map() rejects raw files that claim another
+    static constexpr std::size_t kRawHeaderSize = 4096;
+
+    /**
+     * @brief Map an existing PGM/PPM or native raw file
+     * @param filename Path to the file
+     * @param access Whether writes reach the file
+     * @return Result containing the mapped image or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> map(std::string_view filename,
+                                                            Access access = Access::ReadOnly);
+
+    /**
+     * @brief Create a zero-filled native raw file and map it for writing
+     *
+     * The file is sized up front (sparse where the file system supports it),
+     * so an output image larger than memory can be filled row by row.
+     *
+     * @param filename Path to the file; an existing file is replaced
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param type Grayscale, RGB or RGBA
+     * @param depth Sample depth
+     * @param layout Row storage layout
+     * @return Result containing the mapped image or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> create(
+        std::string_view filename,
+        int width,
+        int height,
+        Image::Type type,
+        Image::Depth depth = Image::Depth::UInt8,
+        Image::RowLayout layout = Image::RowLayout::Packed);
+
+    /**
+     * @brief Save an image in the native raw format
+     *
+     * The file is a kRawHeaderSize-byte header followed by the rows exactly as
+     * they are laid out in memory (stride bytes each, native byte order), so
+     * map() can use it without conversion.
+     *
+     * @param image Grayscale, RGB or RGBA image of any depth
+     * @param filename Path to the destination file
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] static VoidResult saveRaw(const Image& image, std::string_view filename);
+
+    /**
+     * @brief Write the modified pages of a read-write mapped image to its file
+     *
+     * Dirty pages are written back eventually anyway; flush() waits for it.
+     *
+     * @param image The mapped image
+     * @return VoidResult indicating success, or an InvalidParameter error if
+     *         the pixels are not a read-write file mapping (heap memory, a
+     *         read-only mapping or a copy of a mapped image)
+     */
+    [[nodiscard]] static VoidResult flush(const Image& image);
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_MAPPED_IMAGE_IO_HPP
@@ -5,6 +5,11 @@
 #include "Image.hpp"
 #include "../Core/Error.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
 namespace DIPAL {
 
 class GrayscaleImage;  // Forward declaration
@@ -13,7 +18,13 @@ class GrayscaleImage;  // Forward declaration
  * @brief Specialized class for binary (black and white) images
  * 
  * Binary images store each pixel as a single bit (0 for black, 1 for white).
- * They are stored efficiently with 8 pixels per byte.
+ * They are stored efficiently with 8 pixels per byte; pixel x of a row is bit
+ * x % 8 of byte x / 8, so on little-endian machines a 64-bit load of a row
+ * holds 64 consecutive pixels in bit order.
+ *
+ * Thresholding, inversion, filling and counting work on whole 64-bit words
+ * (SIMD compares packed with movemask for thresholding). Bits past the
+ * image width in the last byte of a row are always kept at zero.
  */
 class BinaryImage : public Image {
 public:
@@ -21,8 +32,9 @@ public:
      * @brief Create a new empty binary image
      * @param width Image width in pixels
      * @param height Image height in pixels
+     * @param layout Row storage layout
      */
-    BinaryImage(int width, int height);
+    BinaryImage(int width, int height, RowLayout layout = RowLayout::Packed);
 
     /**
      * @brief Get pixel value at specific coordinates
@@ -47,23 +59,12 @@ public:
      */
     [[nodiscard]] std::unique_ptr<Image> clone() const override;
 
-    /**
-     * @brief Get a span of a specific row in bit-packed format
-     * @param y Row index
-     * @return Span containing the row data (8 pixels per byte) or empty span if invalid
-     */
-    [[nodiscard]] std::span<const uint8_t> getRow(int y) const;
-    
-    /**
-     * @brief Get a modifiable span of a specific row in bit-packed format
-     * @param y Row index
-     * @return Span containing the row data (8 pixels per byte) or empty span if invalid
-     */
-    [[nodiscard]] std::span<uint8_t> getRow(int y);
-
     /**
      * @brief Get the number of bytes per row
-     * @return Bytes per row
+     *
+     * Rows returned by getRow() are in bit-packed format (8 pixels per byte).
+     *
+     * @return Bytes per row, excluding padding
      */
     [[nodiscard]] int getBytesPerRow() const;
 
@@ -99,6 +100,43 @@ public:
         bool invert = false
     );
 
+    /**
+     * @brief Threshold one row of 8-bit samples into bit-packed form
+     *
+     * Writes exactly (width + 7) / 8 bytes; bits past width in the last byte
+     * are zero.
+     *
+     * @param src Source samples
+     * @param dst Destination bytes
+     * @param width Number of pixels
+     * @param threshold Samples at or above it become white
+     * @param invert Swap white and black
+     */
+    static void thresholdRow(const uint8_t* src, uint8_t* dst, std::size_t width,
+                             uint8_t threshold, bool invert) noexcept;
+
+    /**
+     * @brief Count the white pixels of one bit-packed row
+     * @param row Row bytes
+     * @param width Number of pixels; bits past it are ignored
+     * @return Number of set bits among the first width bits
+     */
+    [[nodiscard]] static std::size_t countRow(const uint8_t* row, std::size_t width) noexcept;
+
+    /**
+     * @brief Visit the runs of white pixels of one bit-packed row
+     *
+     * The row is scanned 64 pixels at a time and run boundaries are found
+     * with count-trailing-zeros, so long runs and long gaps cost one step
+     * per word rather than per pixel.
+     *
+     * @param row Row bytes
+     * @param width Number of pixels; bits past it are ignored
+     * @param fn Called as fn(start, end) for every maximal run [start, end), left to right
+     */
+    template <typename Fn>
+    static void forEachRun(const uint8_t* row, std::size_t width, Fn&& fn);
+
 private:
     // Helper methods to work with bit-packed data
     [[nodiscard]] int getBitIndex(int x, int y) const;
@@ -106,6 +144,52 @@ private:
     [[nodiscard]] uint8_t getBitMask(int x) const;
 };
 
+template <typename Fn>
+void BinaryImage::forEachRun(const uint8_t* row, std::size_t width, Fn&& fn) {
+    constexpr std::size_t kWordBits = 64;
+    const std::size_t rowBytes = (width + 7) / 8;
+    const std::size_t words = (width + kWordBits - 1) / kWordBits;
+
+    bool inRun = false;
+    std::size_t start = 0;
+    for (std::size_t w = 0; w < words; ++w) {
+        // Pixels [64w, 64w + 64) in bit order, bits past the width cleared
+        uint64_t bits = 0;
+        const std::size_t offset = w * 8;
+        const std::size_t bytes = std::min<std::size_t>(8, rowBytes - offset);
+        if (std::endian::native == std::endian::little && bytes == 8) {
+            std::memcpy(&bits, row + offset, 8);
+        } else {
+            for (std::size_t i = 0; i < bytes; ++i) {
+                bits |= static_cast<uint64_t>(row[offset + i]) << (8 * i);
+            }
+        }
+        const std::size_t used = width - w * kWordBits;
+        if (used < kWordBits) {
+            bits &= ~uint64_t{0} >> (kWordBits - used);
+        }
+
+        std::size_t pos = 0;
+        while (pos < kWordBits) {
+            // Next set bit while outside a run, next clear bit inside one
+            const uint64_t rest = (inRun ? ~bits : bits) >> pos;
+            if (rest == 0) {
+                break;
+            }
+            pos += static_cast<std::size_t>(std::countr_zero(rest));
+            if (inRun) {
+                fn(start, w * kWordBits + pos);
+            } else {
+                start = w * kWordBits + pos;
+            }
+            inRun = !inRun;
+        }
+    }
+    if (inRun) {
+        fn(start, width);
+    }
+}
+
 } // namespace DIPAL
 
 #endif // DIPAL_BINARY_IMAGE_HPP
@@ -17,8 +17,19 @@ public:
      * @param width Image width in pixels
      * @param height Image height in pixels
      * @param hasAlpha Whether the image has an alpha channel
+     * @param layout Row storage layout
      */
-    ColorImage(int width, int height, bool hasAlpha = false);
+    ColorImage(int width, int height, bool hasAlpha = false, RowLayout layout = RowLayout::Packed);
+
+    /**
+     * @brief Create a color image over existing pixel memory
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param hasAlpha Whether the image has an alpha channel
+     * @param layout Row storage layout
+     * @param buffer Pixel memory of at least stride * height bytes
+     */
+    ColorImage(int width, int height, bool hasAlpha, RowLayout layout, PixelBuffer buffer);
 
     /**
      * @brief Get RGB pixel value at specific coordinates
@@ -57,6 +68,18 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<class GrayscaleImage>> getChannel(int channel) const;
 
+    /**
+     * @brief Copy the pixels into separate channel planes
+     *
+     * Per-channel processing on the planes reuses the grayscale code paths;
+     * PlanarImage::toColorImage() restores the interleaved layout.
+     *
+     * @param layout Row layout of the planes
+     * @return Result containing the planar image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<class PlanarImage>> toPlanar(
+        RowLayout layout = RowLayout::Aligned) const;
+
     /**
      * @brief Clone the color image
      * @return A new color image that is a deep copy of this image
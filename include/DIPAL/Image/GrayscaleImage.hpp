@@ -16,8 +16,18 @@ public:
      * @brief Create a new empty grayscale image
      * @param width Image width in pixels
      * @param height Image height in pixels
+     * @param layout Row storage layout
      */
-    GrayscaleImage(int width, int height);
+    GrayscaleImage(int width, int height, RowLayout layout = RowLayout::Packed);
+
+    /**
+     * @brief Create a grayscale image over existing pixel memory
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param layout Row storage layout
+     * @param buffer Pixel memory of at least stride * height bytes
+     */
+    GrayscaleImage(int width, int height, RowLayout layout, PixelBuffer buffer);
 
     /**
      * @brief Get pixel value at specific coordinates
@@ -41,20 +51,6 @@ public:
      * @return A new grayscale image that is a deep copy of this image
      */
     [[nodiscard]] std::unique_ptr<Image> clone() const override;
-
-    /**
-     * @brief Get a span of a specific row
-     * @param y Row index
-     * @return Span containing the row data or empty span if invalid
-     */
-    [[nodiscard]] std::span<const uint8_t> getRow(int y) const;
-    
-    /**
-     * @brief Get a modifiable span of a specific row
-     * @param y Row index
-     * @return Span containing the row data or empty span if invalid
-     */
-    [[nodiscard]] std::span<uint8_t> getRow(int y);
 };
 
 } // namespace DIPAL
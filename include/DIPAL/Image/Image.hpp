@@ -1,15 +1,20 @@
 #ifndef DIPAL_IMAGE_HPP
 #define DIPAL_IMAGE_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include <span>
 
+#include "PixelBuffer.hpp"
+
 namespace DIPAL {
 // Forward declarations
 class ImageData;
+class ImageView;
+class MutableImageView;
 /*
  * @brief Base class for all image types in DIPAL
  *
@@ -23,6 +28,26 @@ public:
     // Image types
     enum class Type { Binary, Grayscale, RGB, RGBA };
 
+    /**
+     * @brief Row storage layout
+     *
+     * Packed rows follow each other without gaps. Aligned rows start on a
+     * kRowAlignment byte boundary; the gap at the end of each row is padding
+     * and is not part of the image.
+     */
+    enum class RowLayout { Packed, Aligned };
+
+    /**
+     * @brief Storage type of one channel sample
+     *
+     * UInt8 is the depth of BinaryImage, GrayscaleImage and ColorImage; the
+     * wider depths are provided by TypedImage.
+     */
+    enum class Depth { UInt8, UInt16, Float32 };
+
+    /// Alignment of the pixel buffer and, for aligned layouts, of every row
+    static constexpr std::size_t kRowAlignment = PixelBuffer::kAlignment;
+
     // Rule of five (virtual destructor and default others)
     virtual ~Image() = default;
     Image(const Image&);
@@ -35,9 +60,40 @@ public:
      * @param width Image width in pixels
      * @param height Image height in pixels
      * @param type Image type
+     * @param layout Row storage layout
      */
 
-    Image(int width, int height, Type type);
+    Image(int width, int height, Type type, RowLayout layout = RowLayout::Packed);
+
+    /**
+     * @brief Create a new empty image with the given sample depth
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param type Image type (Binary images must be UInt8)
+     * @param depth Sample depth
+     * @param layout Row storage layout
+     */
+    Image(int width, int height, Type type, Depth depth, RowLayout layout = RowLayout::Packed);
+
+    /**
+     * @brief Create an image over existing pixel memory
+     *
+     * The image adopts @p buffer instead of allocating, which lets pixels live
+     * in memory the library does not own, such as a memory-mapped file. Rows
+     * start every getStride() bytes as for an allocated image of the same
+     * geometry; copies share the buffer and detach into allocator memory on
+     * their first write.
+     *
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param type Image type (Binary images must be UInt8)
+     * @param depth Sample depth
+     * @param layout Row storage layout
+     * @param buffer Pixel memory of at least stride * height bytes
+     * @throws std::invalid_argument if the buffer is too small
+     * @throws std::overflow_error if stride * height does not fit in size_t
+     */
+    Image(int width, int height, Type type, Depth depth, RowLayout layout, PixelBuffer buffer);
 
     /*
      * @brief Get the width of the image
@@ -59,6 +115,34 @@ public:
 
     [[nodiscard]] Type getType() const;
 
+    /**
+     * @brief Get the sample depth of the image
+     * @return Depth of one channel sample
+     */
+    [[nodiscard]] Depth getDepth() const noexcept;
+
+    /**
+     * @brief Get the number of bytes of one channel sample
+     * @return 1 for UInt8, 2 for UInt16, 4 for Float32
+     */
+    [[nodiscard]] int getBytesPerSample() const noexcept;
+
+    /**
+     * @brief Get the number of bytes of one sample of a given depth
+     * @param depth Sample depth
+     * @return Bytes per sample
+     */
+    [[nodiscard]] static constexpr int bytesPerSample(Depth depth) noexcept {
+        switch (depth) {
+            case Depth::UInt16:
+                return 2;
+            case Depth::Float32:
+                return 4;
+            default:
+                return 1;
+        }
+    }
+
     /**
      * @brief Check if the image is empty
      * @return true if the image is empty, false otherwise
@@ -74,6 +158,11 @@ public:
     [[nodiscard]] const uint8_t* getData() const;
     /*
      * @brief Get a modifiable pointer to the image data
+     *
+     * If the pixel buffer is shared with a clone, the image first takes a
+     * private copy (copy-on-write). The pointer is invalidated by copying
+     * or cloning the image.
+     *
      * return Raw pointer to the beginning of the image
      */
 
@@ -94,14 +183,73 @@ public:
 
     /**
      * @brief Get the total size of the image data in bytes
-     * @return Size in bytes
+     * @return Size in bytes, including row padding
      */
 
     [[nodiscard]] size_t getDataSize() const;
 
+    /**
+     * @brief Get the distance in bytes between the starts of two consecutive rows
+     * @return Row stride in bytes
+     */
+    [[nodiscard]] std::size_t getStride() const noexcept;
+
+    /**
+     * @brief Get the number of bytes of pixel data in one row, excluding padding
+     * @return Row size in bytes
+     */
+    [[nodiscard]] std::size_t getRowBytes() const noexcept;
+
+    /**
+     * @brief Get the row storage layout
+     * @return Row layout
+     */
+    [[nodiscard]] RowLayout getRowLayout() const noexcept;
+
+    /**
+     * @brief Check whether rows are stored without padding
+     * @return true if the stride equals the row size
+     */
+    [[nodiscard]] bool isContiguous() const noexcept;
+
+    /**
+     * @brief Get a span of a specific row
+     * @param y Row index
+     * @return Span containing the row data (without padding) or empty span if invalid
+     */
+    [[nodiscard]] std::span<const uint8_t> getRow(int y) const;
+
+    /**
+     * @brief Get a modifiable span of a specific row
+     * @param y Row index
+     * @return Span containing the row data (without padding) or empty span if invalid
+     */
+    [[nodiscard]] std::span<uint8_t> getRow(int y);
+
+    /**
+     * @brief Get a read-only view covering the whole image
+     * @return Non-owning view of the pixel data
+     */
+    [[nodiscard]] ImageView view() const;
+
+    /**
+     * @brief Get a writable view covering the whole image
+     *
+     * Detaches a shared pixel buffer first, like getData().
+     *
+     * @return Non-owning view of the pixel data
+     */
+    [[nodiscard]] MutableImageView mutableView();
+
     /**
      * @brief Clone the image
-     * @return A new image that is a deep copy of this image
+     *
+     * The clone shares the pixel buffer with this image; the bytes are only
+     * copied when one of the two is written to. An exclusive buffer (a
+     * writable file mapping, see PixelBuffer::setExclusive()) is copied at
+     * once instead, so this image keeps writing to it and the clone does not.
+     *
+     * @return A new image with the same contents as this image
      */
 
     virtual std::unique_ptr<Image> clone() const;
@@ -113,6 +261,25 @@ public:
      * @return true if the coordinate is valid, false otherwise
      */
     [[nodiscard]] bool isValidCoordinate(int x, int y) const ;
+
+    /**
+     * @brief Check whether the pixel buffer is shared with another image
+     * @return true if writing to this image would copy the pixels first
+     */
+    [[nodiscard]] bool isShared() const noexcept;
+
+    /**
+     * @brief Check whether two images share the same pixel buffer
+     * @param other Image to compare with
+     * @return true if both images refer to the same pixel memory
+     */
+    [[nodiscard]] bool sharesDataWith(const Image& other) const noexcept;
+
+    /**
+     * @brief Check whether the pixels live in an exclusive buffer
+     * @return true if writes go to memory copies never share, e.g. a writable file mapping
+     */
+    [[nodiscard]] bool hasExclusiveData() const noexcept;
     
     [[nodiscard]] std::span<const std::uint8_t> getDataSpan() const noexcept;
     
@@ -125,11 +292,38 @@ protected:
     int m_width;
     int m_height;
     Type m_type;
+    Depth m_depth = Depth::UInt8;
     int m_channels;
     int m_bytesPerPixel;
-    std::vector<uint8_t> m_data;
+    RowLayout m_rowLayout;
+    std::size_t m_stride;
+    PixelBuffer m_data;  // Shared between copies until the first write
     // Protected constructor for derived classes
     Image();
+
+    // Write access to the pixel bytes; detaches a shared buffer first (copy-on-write)
+    [[nodiscard]] uint8_t* mutablePixels() {
+        if (m_data.isShared()) {
+            detachData();
+        }
+        return m_data.mutableData();
+    }
+
+    // The non-const overload detaches a shared buffer first (copy-on-write)
+    [[nodiscard]] uint8_t* rowPtr(int y) {
+        return mutablePixels() + static_cast<std::size_t>(y) * m_stride;
+    }
+    [[nodiscard]] const uint8_t* rowPtr(int y) const noexcept {
+        return m_data.data() + static_cast<std::size_t>(y) * m_stride;
+    }
+
+private:
+    // Derive channels, bytes per pixel and stride from the type, depth and layout
+    void initGeometry(Type type, Depth depth, RowLayout layout);
+
+    // Give this image a private copy of a shared or exclusive buffer, taken
+    // from the default ImageAllocator
+    void detachData();
 };
 }  // namespace DIPAL
 
@@ -0,0 +1,265 @@
+// include/DIPAL/Image/ImageAllocator.hpp
+#ifndef DIPAL_IMAGE_ALLOCATOR_HPP
+#define DIPAL_IMAGE_ALLOCATOR_HPP
+
+#include "Image.hpp"
+#include "PixelBuffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace DIPAL {
+
+class ThreadPool;
+
+/**
+ * @brief Describes the pixel buffer an image needs
+ *
+ * Pools use the geometry fields to decide which idle buffers can be reused;
+ * bytes is the size the buffer must have.
+ */
+struct ImageBufferKey {
+    int width = 0;
+    int height = 0;
+    Image::Type type = Image::Type::Grayscale;
+    Image::RowLayout layout = Image::RowLayout::Packed;
+    std::size_t bytes = 0;
+    Image::Depth depth = Image::Depth::UInt8;
+
+    constexpr bool operator==(const ImageBufferKey& other) const noexcept = default;
+};
+
+/**
+ * @brief Source of pixel buffers for every image in the library
+ *
+ * All Image constructors (and therefore ImageFactory and the filters) obtain
+ * their storage from the allocator returned by getDefault(). Install a
+ * different allocator with setDefault() to change how pixel memory is
+ * obtained, e.g. a PooledImageAllocator for batch processing.
+ */
+class ImageAllocator {
+public:
+    virtual ~ImageAllocator() = default;
+
+    /**
+     * @brief Allocate a pixel buffer
+     * @param key Geometry and size of the buffer
+     * @param zeroFill Whether the bytes must be zero (false when the caller overwrites them all)
+     * @return Buffer of key.bytes bytes, aligned to PixelBuffer::kAlignment
+     * @throws std::bad_alloc if the memory cannot be obtained
+     */
+    [[nodiscard]] virtual PixelBuffer allocate(const ImageBufferKey& key, bool zeroFill = true) = 0;
+
+    /**
+     * @brief Get the name of the allocator
+     * @return Allocator name
+     */
+    [[nodiscard]] virtual std::string_view getName() const = 0;
+
+    /**
+     * @brief Get the allocator used for new images
+     * @return The process-wide allocator (never null)
+     */
+    [[nodiscard]] static std::shared_ptr<ImageAllocator> getDefault();
+
+    /**
+     * @brief Replace the allocator used for new images
+     *
+     * Buffers that are already allocated keep returning their memory to the
+     * allocator they came from.
+     *
+     * @param allocator The new allocator, or nullptr to restore the heap allocator
+     */
+    static void setDefault(std::shared_ptr<ImageAllocator> allocator);
+};
+
+/**
+ * @brief Allocator that takes every buffer straight from the heap
+ */
+class HeapImageAllocator : public ImageAllocator {
+public:
+    [[nodiscard]] PixelBuffer allocate(const ImageBufferKey& key, bool zeroFill = true) override;
+    [[nodiscard]] std::string_view getName() const override;
+};
+
+/**
+ * @brief Allocator that backs large buffers with temporary files
+ *
+ * Buffers of at least the threshold size are memory mappings of unlinked
+ * files in a scratch directory. The kernel can then write idle pages out and
+ * drop them instead of needing RAM (or swap) for every image, which keeps
+ * filter outputs and temporaries of very large images workable. Smaller
+ * buffers come from the heap. The files disappear when the buffers are freed.
+ *
+ * On platforms without mmap every buffer comes from the heap.
+ */
+class MappedImageAllocator : public ImageAllocator {
+public:
+    /**
+     * @brief Create a file-backed allocator
+     * @param directory Directory for the scratch files (empty: the system temporary directory)
+     * @param threshold Smallest buffer, in bytes, that is backed by a file
+     */
+    explicit MappedImageAllocator(std::filesystem::path directory = {},
+                                  std::size_t threshold = 64u << 20);
+
+    [[nodiscard]] PixelBuffer allocate(const ImageBufferKey& key, bool zeroFill = true) override;
+    [[nodiscard]] std::string_view getName() const override;
+
+    /**
+     * @brief Get the scratch directory
+     * @return Directory that holds the backing files
+     */
+    [[nodiscard]] const std::filesystem::path& getDirectory() const noexcept;
+
+    /**
+     * @brief Get the size from which buffers are file-backed
+     * @return Threshold in bytes
+     */
+    [[nodiscard]] std::size_t getThreshold() const noexcept;
+
+private:
+    std::filesystem::path m_directory;
+    std::size_t m_threshold;
+};
+
+/**
+ * @brief Allocator for very large images on NUMA machines
+ *
+ * Buffers of at least the threshold size are anonymous memory mappings
+ * aligned to 2 MiB and marked for transparent huge pages (madvise
+ * MADV_HUGEPAGE), which cuts the TLB misses of walking 100 MB+ frames.
+ *
+ * With a first-touch pool, each buffer is then touched strip by strip on the
+ * pool's workers before it is returned: rows are split with partitionRange()
+ * exactly like ParallelProcessor splits an image, and strip i is written by
+ * worker i. Linux places a page on the node of the thread that first touches
+ * it, so when the same pool (ideally created with a ThreadBinding) runs a
+ * ParallelProcessor, every worker processes rows in memory local to its node.
+ * Without a pool, pages are placed by whichever thread writes them first.
+ *
+ * Smaller buffers, and every buffer on platforms without mmap, come from the
+ * heap. Buffers requested by a worker of the first-touch pool itself are not
+ * pre-touched (the requesting worker is usually the one that fills them), so
+ * allocating inside a strip never waits on the other workers.
+ */
+class LargePageImageAllocator : public ImageAllocator {
+public:
+    /**
+     * @brief Allocation policy
+     */
+    struct Config {
+        std::size_t threshold = 16u << 20;          ///< Smallest buffer, in bytes, that gets the large-page treatment
+        bool hugePages = true;                      ///< Advise the kernel to back buffers with huge pages
+        std::shared_ptr<ThreadPool> firstTouchPool; ///< Workers that touch the strips of new buffers (null: none)
+    };
+
+    /// Alignment and granularity of large buffers (the x86-64 huge page size)
+    static constexpr std::size_t kHugePageSize = 2u << 20;
+
+    /**
+     * @brief Create a large-page allocator
+     * @param config Allocation policy
+     */
+    LargePageImageAllocator();
+    explicit LargePageImageAllocator(Config config);
+
+    [[nodiscard]] PixelBuffer allocate(const ImageBufferKey& key, bool zeroFill = true) override;
+    [[nodiscard]] std::string_view getName() const override;
+
+    /**
+     * @brief Get the allocation policy
+     * @return Configuration given at construction
+     */
+    [[nodiscard]] const Config& getConfig() const noexcept;
+
+private:
+    Config m_config;
+};
+
+/**
+ * @brief Allocator that recycles pixel buffers of the same geometry
+ *
+ * Released buffers are parked, keyed by (width, height, type, layout), and
+ * handed out again to the next image of the same shape, which removes the
+ * malloc/page-fault cost from steady-state pipelines. Each thread first
+ * looks in a small private cache, then in the shared pool.
+ *
+ * The memory cap bounds the bytes held idle (shared pool plus thread
+ * caches); buffers released beyond it go back to the system. Buffers in
+ * use never count against the cap.
+ */
+class PooledImageAllocator : public ImageAllocator {
+public:
+    /**
+     * @brief Pool configuration
+     */
+    struct Config {
+        std::size_t memoryCap = 256u << 20;           ///< Maximum idle bytes kept in total
+        std::size_t threadCacheBytes = 32u << 20;     ///< Maximum idle bytes per thread cache
+        std::size_t threadCacheEntries = 8;           ///< Maximum idle buffers per thread cache
+    };
+
+    /**
+     * @brief Allocation counters
+     */
+    struct Statistics {
+        std::size_t threadCacheHits = 0;  ///< Requests served from the calling thread's cache
+        std::size_t poolHits = 0;         ///< Requests served from the shared pool
+        std::size_t misses = 0;           ///< Requests that needed fresh memory
+        std::size_t cachedBytes = 0;      ///< Bytes currently held idle
+        std::size_t releasedBytes = 0;    ///< Bytes returned to the system because of the cap
+    };
+
+    /**
+     * @brief Create a pooled allocator
+     * @param config Pool configuration
+     */
+    PooledImageAllocator();
+    explicit PooledImageAllocator(Config config);
+    ~PooledImageAllocator() override;
+
+    PooledImageAllocator(const PooledImageAllocator&) = delete;
+    PooledImageAllocator& operator=(const PooledImageAllocator&) = delete;
+
+    [[nodiscard]] PixelBuffer allocate(const ImageBufferKey& key, bool zeroFill = true) override;
+    [[nodiscard]] std::string_view getName() const override;
+
+    /**
+     * @brief Get the allocation counters
+     * @return Snapshot of the statistics
+     */
+    [[nodiscard]] Statistics getStatistics() const;
+
+    /**
+     * @brief Change the idle memory cap
+     *
+     * Lowering the cap trims the shared pool immediately; thread caches
+     * shrink as their threads release buffers.
+     *
+     * @param bytes New cap in bytes
+     */
+    void setMemoryCap(std::size_t bytes);
+
+    /**
+     * @brief Get the idle memory cap
+     * @return Cap in bytes
+     */
+    [[nodiscard]] std::size_t getMemoryCap() const noexcept;
+
+    /**
+     * @brief Return every idle buffer in the shared pool and in the calling thread's cache to the system
+     */
+    void trim();
+
+private:
+    struct State;
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_IMAGE_ALLOCATOR_HPP
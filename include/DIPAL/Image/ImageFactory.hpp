@@ -3,7 +3,9 @@
 #define DIPAL_IMAGE_FACTORY_HPP
 #include "../Core/Error.hpp"
 #include "Image.hpp"
+#include "TypedImage.hpp"
 
+#include <format>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -25,39 +27,95 @@ public:
      * @param width Image width in pixels
      * @param height Image height in pixels
      * @param type Image type
+     * @param layout Row storage layout (Aligned pads every row to a 64-byte boundary)
      * @return Result containing the created image or error
      */
-    [[nodiscard]] static Result<std::unique_ptr<Image>> create(int width,
-                                                               int height,
-                                                               Image::Type type);
+    [[nodiscard]] static Result<std::unique_ptr<Image>> create(
+        int width, int height, Image::Type type,
+        Image::RowLayout layout = Image::RowLayout::Packed);
+
+    /**
+     * @brief Create a new image of the specified type and sample depth
+     *
+     * UInt8 images are the usual BinaryImage, GrayscaleImage and ColorImage
+     * classes; the wider depths are TypedImage instances.
+     *
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param type Image type (Binary requires UInt8)
+     * @param depth Sample depth
+     * @param layout Row storage layout
+     * @return Result containing the created image or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> create(
+        int width, int height, Image::Type type, Image::Depth depth,
+        Image::RowLayout layout = Image::RowLayout::Packed);
+
+    /**
+     * @brief Create an image over existing pixel memory
+     *
+     * Like create(), but the image adopts @p buffer instead of allocating;
+     * used for memory-mapped files. Rows are laid out as for an allocated
+     * image of the same geometry. The returned object is a TypedImage of the
+     * requested depth and channel count (the 8-bit ones are GrayscaleImage or
+     * ColorImage instances).
+     *
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param type Grayscale, RGB or RGBA
+     * @param depth Sample depth
+     * @param layout Row storage layout
+     * @param buffer Pixel memory of at least stride * height bytes
+     * @return Result containing the image or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> wrap(
+        int width, int height, Image::Type type, Image::Depth depth,
+        Image::RowLayout layout, PixelBuffer buffer);
+
+    /**
+     * @brief Create a new typed image
+     * @tparam PixelT Sample type (uint8_t, uint16_t or float)
+     * @tparam Channels Samples per pixel (1, 3 or 4)
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param layout Row storage layout
+     * @return Result containing the created image or error
+     */
+    template <SampleType PixelT, int Channels>
+    [[nodiscard]] static Result<std::unique_ptr<TypedImage<PixelT, Channels>>> createTyped(
+        int width, int height, Image::RowLayout layout = Image::RowLayout::Packed);
 
     /**
      * @brief Create a new binary image
      * @param width Image width in pixels
      * @param height Image height in pixels
+     * @param layout Row storage layout
      * @return Result containing the created binary image or error
      */
-    [[nodiscard]] static Result<std::unique_ptr<BinaryImage>> createBinary(int width, int height);
+    [[nodiscard]] static Result<std::unique_ptr<BinaryImage>> createBinary(
+        int width, int height, Image::RowLayout layout = Image::RowLayout::Packed);
 
     /**
      * @brief Create a new grayscale image
      * @param width Image width in pixels
      * @param height Image height in pixels
+     * @param layout Row storage layout
      * @return Result containing the created grayscale image or error
      */
-    [[nodiscard]] static Result<std::unique_ptr<GrayscaleImage>> createGrayscale(int width,
-                                                                                 int height);
+    [[nodiscard]] static Result<std::unique_ptr<GrayscaleImage>> createGrayscale(
+        int width, int height, Image::RowLayout layout = Image::RowLayout::Packed);
 
     /**
      * @brief Create a new color image
      * @param width Image width in pixels
      * @param height Image height in pixels
      * @param hasAlpha Whether to include an alpha channel
+     * @param layout Row storage layout
      * @return Result containing the created color image or error
      */
-    [[nodiscard]] static Result<std::unique_ptr<ColorImage>> createColor(int width,
-                                                                         int height,
-                                                                         bool hasAlpha = false);
+    [[nodiscard]] static Result<std::unique_ptr<ColorImage>> createColor(
+        int width, int height, bool hasAlpha = false,
+        Image::RowLayout layout = Image::RowLayout::Packed);
 
     /**
      * @brief Convert a color image to grayscale
@@ -97,6 +155,19 @@ public:
     [[nodiscard]] static Result<std::unique_ptr<GrayscaleImage>>
     fromBinary(const BinaryImage& image, uint8_t whiteValue = 255, uint8_t blackValue = 0);
 
+    /**
+     * @brief Convert an image to another sample depth
+     *
+     * Samples are rescaled between the nominal ranges (255, 65535, 1.0) and
+     * rounded; the type and row layout are kept.
+     *
+     * @param image The grayscale or color image to convert
+     * @param depth Target sample depth
+     * @return Result containing the converted image or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Image>> convertDepth(const Image& image,
+                                                                     Image::Depth depth);
+
     /**
      * @brief Load an image from a file
      * @param filename Path to the image file
@@ -124,6 +195,24 @@ public:
                                               int quality);
 };
 
+template <SampleType PixelT, int Channels>
+Result<std::unique_ptr<TypedImage<PixelT, Channels>>> ImageFactory::createTyped(
+    int width, int height, Image::RowLayout layout) {
+    using ImageT = TypedImage<PixelT, Channels>;
+
+    if (width <= 0 || height <= 0) {
+        return makeErrorResult<std::unique_ptr<ImageT>>(
+            ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
+    }
+
+    try {
+        return makeSuccessResult(std::make_unique<ImageT>(width, height, layout));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<ImageT>>(
+            ErrorCode::InternalError, std::format("Failed to create typed image: {}", e.what()));
+    }
+}
+
 }  // namespace DIPAL
 
 #endif  // DIPAL_IMAGE_FACTORY_HPP
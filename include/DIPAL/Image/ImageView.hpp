@@ -2,7 +2,232 @@
 #ifndef DIPAL_IMAGE_VIEW_HPP
 #define DIPAL_IMAGE_VIEW_HPP
 
+#include "../Core/Error.hpp"
+#include "../Core/Types.hpp"
+#include "Image.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
 
+namespace DIPAL {
+
+/**
+ * @brief Non-owning, read-only view of a rectangular block of pixels
+ *
+ * A view is a pointer to the first pixel plus width, height, row stride and
+ * pixel type. It never owns or copies pixel data, so cropping a view to a
+ * region of interest is free. The viewed image must outlive the view.
+ *
+ * Binary views are bit-packed like BinaryImage (LSB first), so they can only
+ * be cropped at x coordinates that are multiples of 8.
+ */
+class ImageView {
+public:
+    /**
+     * @brief Create an empty view
+     */
+    ImageView() = default;
+
+    /**
+     * @brief Create a view over raw pixel memory
+     * @param data Pointer to the first byte of the first row
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param stride Distance in bytes between the starts of two rows
+     * @param type Pixel type
+     * @param depth Sample depth
+     */
+    ImageView(const uint8_t* data,
+              int width,
+              int height,
+              std::size_t stride,
+              Image::Type type,
+              Image::Depth depth = Image::Depth::UInt8);
+
+    /**
+     * @brief Create a view covering a whole image
+     * @param image The image to view
+     */
+    explicit ImageView(const Image& image);
+
+    [[nodiscard]] const uint8_t* getData() const noexcept { return m_data; }
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+    [[nodiscard]] std::size_t getStride() const noexcept { return m_stride; }
+    [[nodiscard]] Image::Type getType() const noexcept { return m_type; }
+    [[nodiscard]] Image::Depth getDepth() const noexcept { return m_depth; }
+
+    /**
+     * @brief Get the number of channels
+     * @return 1 for Binary/Grayscale, 3 for RGB, 4 for RGBA
+     */
+    [[nodiscard]] int getChannels() const noexcept;
+
+    /**
+     * @brief Get the number of bytes per pixel
+     * @return Bytes per pixel (0 for bit-packed binary views)
+     */
+    [[nodiscard]] int getBytesPerPixel() const noexcept;
+
+    /**
+     * @brief Get the number of bytes of pixel data in one row
+     * @return Row size in bytes, excluding padding
+     */
+    [[nodiscard]] std::size_t getRowBytes() const noexcept;
+
+    /**
+     * @brief Check whether the view covers no pixels
+     * @return true if the view is empty
+     */
+    [[nodiscard]] bool isEmpty() const noexcept;
+
+    /**
+     * @brief Get the bounds of the view in its own coordinates
+     * @return Rect(0, 0, width, height)
+     */
+    [[nodiscard]] Rect bounds() const noexcept { return Rect(0, 0, m_width, m_height); }
+
+    /**
+     * @brief Get a row of the view
+     * @param y Row index
+     * @return Span containing the row data or empty span if invalid
+     */
+    [[nodiscard]] std::span<const uint8_t> getRow(int y) const noexcept;
+
+    /**
+     * @brief Get a pointer to a row without bounds checking
+     * @param y Row index, must be in [0, height)
+     * @return Pointer to the first byte of the row
+     */
+    [[nodiscard]] const uint8_t* rowPtr(int y) const noexcept {
+        return m_data + static_cast<std::size_t>(y) * m_stride;
+    }
+
+    /**
+     * @brief Create a view of a sub-region without copying
+     * @param rect Region in view coordinates, must lie inside the view
+     * @return Result containing the cropped view or error
+     */
+    [[nodiscard]] Result<ImageView> crop(const Rect& rect) const;
+
+    /**
+     * @brief Copy the viewed pixels into a new owning image
+     * @param layout Row layout of the new image
+     * @return Result containing the new image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> toImage(
+        Image::RowLayout layout = Image::RowLayout::Packed) const;
+
+private:
+    const uint8_t* m_data = nullptr;
+    int m_width = 0;
+    int m_height = 0;
+    std::size_t m_stride = 0;
+    Image::Type m_type = Image::Type::Grayscale;
+    Image::Depth m_depth = Image::Depth::UInt8;
+};
+
+/**
+ * @brief Non-owning, writable view of a rectangular block of pixels
+ *
+ * Same as ImageView but allows modifying the viewed pixels in place. A
+ * mutable view converts implicitly to a read-only ImageView.
+ */
+class MutableImageView {
+public:
+    /**
+     * @brief Create an empty view
+     */
+    MutableImageView() = default;
+
+    /**
+     * @brief Create a view over raw pixel memory
+     * @param data Pointer to the first byte of the first row
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param stride Distance in bytes between the starts of two rows
+     * @param type Pixel type
+     * @param depth Sample depth
+     */
+    MutableImageView(uint8_t* data,
+                     int width,
+                     int height,
+                     std::size_t stride,
+                     Image::Type type,
+                     Image::Depth depth = Image::Depth::UInt8);
+
+    /**
+     * @brief Create a view covering a whole image
+     * @param image The image to view
+     */
+    explicit MutableImageView(Image& image);
+
+    [[nodiscard]] uint8_t* getData() const noexcept { return m_data; }
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+    [[nodiscard]] std::size_t getStride() const noexcept { return m_stride; }
+    [[nodiscard]] Image::Type getType() const noexcept { return m_type; }
+    [[nodiscard]] Image::Depth getDepth() const noexcept { return m_depth; }
+    [[nodiscard]] int getChannels() const noexcept { return asConst().getChannels(); }
+    [[nodiscard]] int getBytesPerPixel() const noexcept { return asConst().getBytesPerPixel(); }
+    [[nodiscard]] std::size_t getRowBytes() const noexcept { return asConst().getRowBytes(); }
+    [[nodiscard]] bool isEmpty() const noexcept { return asConst().isEmpty(); }
+    [[nodiscard]] Rect bounds() const noexcept { return Rect(0, 0, m_width, m_height); }
+
+    /**
+     * @brief Get a modifiable row of the view
+     * @param y Row index
+     * @return Span containing the row data or empty span if invalid
+     */
+    [[nodiscard]] std::span<uint8_t> getRow(int y) const noexcept;
+
+    /**
+     * @brief Get a pointer to a row without bounds checking
+     * @param y Row index, must be in [0, height)
+     * @return Pointer to the first byte of the row
+     */
+    [[nodiscard]] uint8_t* rowPtr(int y) const noexcept {
+        return m_data + static_cast<std::size_t>(y) * m_stride;
+    }
+
+    /**
+     * @brief Create a writable view of a sub-region without copying
+     * @param rect Region in view coordinates, must lie inside the view
+     * @return Result containing the cropped view or error
+     */
+    [[nodiscard]] Result<MutableImageView> crop(const Rect& rect) const;
+
+    /**
+     * @brief Copy pixels from another view of the same size and type
+     *
+     * For binary views only the bits inside the view are written, so
+     * neighbouring pixels sharing the last byte of a row are preserved.
+     *
+     * @param source The pixels to copy
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult copyFrom(const ImageView& source) const;
+
+    /**
+     * @brief Convert to a read-only view
+     */
+    operator ImageView() const noexcept { return asConst(); }
+
+private:
+    [[nodiscard]] ImageView asConst() const noexcept {
+        return ImageView(m_data, m_width, m_height, m_stride, m_type, m_depth);
+    }
+
+    uint8_t* m_data = nullptr;
+    int m_width = 0;
+    int m_height = 0;
+    std::size_t m_stride = 0;
+    Image::Type m_type = Image::Type::Grayscale;
+    Image::Depth m_depth = Image::Depth::UInt8;
+};
+
+}  // namespace DIPAL
 
 #endif  // DIPAL_IMAGE_VIEW_HPP
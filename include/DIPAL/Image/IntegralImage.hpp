@@ -0,0 +1,162 @@
+// include/DIPAL/Image/IntegralImage.hpp
+#ifndef DIPAL_INTEGRAL_IMAGE_HPP
+#define DIPAL_INTEGRAL_IMAGE_HPP
+
+#include "../Core/Error.hpp"
+#include "../Core/MemoryTracker.hpp"
+#include "../Core/Types.hpp"
+#include "ImageView.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace DIPAL {
+
+class ThreadPool;
+
+/**
+ * @brief Accumulator types of an IntegralImage (uint32_t, uint64_t, double)
+ */
+template <typename T>
+concept IntegralSumType =
+    std::same_as<T, uint32_t> || std::same_as<T, uint64_t> || std::same_as<T, double>;
+
+/**
+ * @brief Summed-area table: the sum of any rectangle of an image in four lookups
+ *
+ * Entry (x, y) of channel c holds the sum of the samples of channel c over
+ * the pixels [0, x) x [0, y), so the table is one row and one column larger
+ * than the image and its first row and column are zero. Optionally a second
+ * table holds the sums of the squared samples, for local variances.
+ *
+ * Integer tables use modular arithmetic: the corner entries may wrap around,
+ * but a rectangle's sum is still exact as long as the sum itself fits the
+ * type. uint32_t therefore serves any window whose sum stays below 2^32 (a
+ * window of up to 16.8 million 8-bit pixels, or 65 thousand for squares),
+ * whatever the size of the image. Integer tables accept 8- and 16-bit
+ * images; float images need a double table.
+ *
+ * The table is built in one pass over the source: each row is prefix-summed
+ * and added to the row above, a dependency-free loop the compiler
+ * vectorizes. Large images are split into strips built in parallel from
+ * zero and then offset by the last row of the strips above. Integer tables
+ * do not depend on the split; double tables of float images may differ in
+ * the last bits.
+ *
+ * @tparam Sum Accumulator type
+ */
+template <IntegralSumType Sum>
+class IntegralImage {
+public:
+    /**
+     * @brief Build the table of an image
+     * @param view Grayscale, RGB or RGBA pixels of any depth (float only with Sum = double)
+     * @param withSquares Also build the table of squared samples
+     * @param pool Workers for the strips; nullptr uses the shared pool for
+     *             large images and builds small ones on the calling thread
+     * @return Result containing the table, or UnsupportedFormat for other images
+     */
+    [[nodiscard]] static Result<IntegralImage> compute(const ImageView& view,
+                                                       bool withSquares = false,
+                                                       ThreadPool* pool = nullptr);
+
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+    [[nodiscard]] int getChannels() const noexcept { return m_channels; }
+    [[nodiscard]] bool hasSquares() const noexcept { return !m_squares.empty(); }
+
+    /**
+     * @brief Sum of one channel over a rectangle
+     * @param rect Pixels to sum; must lie inside the image (unchecked)
+     * @param channel Channel index
+     */
+    [[nodiscard]] Sum sum(const Rect& rect, int channel) const noexcept {
+        return rectangle(m_sums, rect, channel);
+    }
+
+    /**
+     * @brief Sum of the squares of one channel over a rectangle
+     * @param rect Pixels to sum; must lie inside the image (unchecked)
+     * @param channel Channel index
+     * @pre hasSquares()
+     */
+    [[nodiscard]] Sum squaredSum(const Rect& rect, int channel) const noexcept {
+        return rectangle(m_squares, rect, channel);
+    }
+
+    /**
+     * @brief Get one row of the table
+     * @param y Row index, 0 to getHeight() inclusive
+     * @return (getWidth() + 1) * getChannels() interleaved entries
+     */
+    [[nodiscard]] std::span<const Sum> row(int y) const noexcept {
+        return {m_sums.data() + static_cast<std::size_t>(y) * stride(), stride()};
+    }
+
+    /**
+     * @brief Get one row of the table of squares
+     * @param y Row index, 0 to getHeight() inclusive
+     * @pre hasSquares()
+     */
+    [[nodiscard]] std::span<const Sum> squaredRow(int y) const noexcept {
+        return {m_squares.data() + static_cast<std::size_t>(y) * stride(), stride()};
+    }
+
+    /**
+     * @brief Sums of the square windows centred on the pixels of one row
+     *
+     * The window of pixel x covers [x - radius, x + radius] horizontally and
+     * [y - radius, y + radius] vertically, clipped to the image, so border
+     * windows hold fewer pixels; see windowArea().
+     *
+     * @param y Row of the window centres
+     * @param radius Window radius, at least 0
+     * @param sums Receives getWidth() * getChannels() interleaved sums
+     * @param squares Receives the squared sums if not empty; requires hasSquares()
+     */
+    void windowSums(int y, int radius, std::span<Sum> sums, std::span<Sum> squares = {}) const noexcept;
+
+    /**
+     * @brief Number of pixels of a clipped window of windowSums()
+     * @param x Column of the window centre
+     * @param y Row of the window centre
+     * @param radius Window radius
+     */
+    [[nodiscard]] std::size_t windowArea(int x, int y, int radius) const noexcept;
+
+private:
+    using Storage = std::vector<Sum, TrackedAllocator<Sum, MemoryCategory::Images>>;
+
+    IntegralImage(int width, int height, int channels, bool withSquares);
+
+    [[nodiscard]] std::size_t stride() const noexcept {
+        return static_cast<std::size_t>(m_width + 1) * static_cast<std::size_t>(m_channels);
+    }
+
+    [[nodiscard]] Sum rectangle(const Storage& table, const Rect& rect, int channel) const noexcept {
+        const std::size_t s = stride();
+        const Sum* top = table.data() + static_cast<std::size_t>(rect.y) * s;
+        const Sum* bottom = table.data() + static_cast<std::size_t>(rect.y + rect.height) * s;
+        const std::size_t left = static_cast<std::size_t>(rect.x) * m_channels + channel;
+        const std::size_t right =
+            static_cast<std::size_t>(rect.x + rect.width) * m_channels + channel;
+        return bottom[right] - bottom[left] - top[right] + top[left];
+    }
+
+    int m_width;
+    int m_height;
+    int m_channels;
+    Storage m_sums;
+    Storage m_squares;
+};
+
+extern template class IntegralImage<uint32_t>;
+extern template class IntegralImage<uint64_t>;
+extern template class IntegralImage<double>;
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_INTEGRAL_IMAGE_HPP
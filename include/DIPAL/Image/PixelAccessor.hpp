@@ -0,0 +1,199 @@
+// include/DIPAL/Image/PixelAccessor.hpp
+#ifndef DIPAL_PIXEL_ACCESSOR_HPP
+#define DIPAL_PIXEL_ACCESSOR_HPP
+
+#include "Image.hpp"
+#include "ImageView.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace DIPAL {
+
+/**
+ * @brief Unchecked, read-only pixel access for inner loops
+ *
+ * The accessor is validated once when it is created (it takes the geometry of
+ * an image or view) and then compiles down to plain loads: row(), operator()
+ * and the clamped variants perform no error handling. Coordinates are only
+ * checked with assert(), i.e. in debug builds.
+ *
+ * Samples are interleaved: channel c of pixel x in a row is at index
+ * x * channels() + c. Binary (bit-packed) images are not supported.
+ *
+ * @tparam T Sample type matching the image depth (uint8_t, uint16_t or float)
+ */
+template <typename T = uint8_t>
+class PixelAccessor {
+public:
+    /**
+     * @brief Create an accessor for a view
+     * @param view The pixels to read; must outlive the accessor
+     */
+    explicit PixelAccessor(const ImageView& view) noexcept
+        : m_data(view.getData()),
+          m_stride(view.getStride()),
+          m_width(view.getWidth()),
+          m_height(view.getHeight()),
+          m_channels(view.getChannels()) {
+        assert(view.getType() != Image::Type::Binary);
+        assert(Image::bytesPerSample(view.getDepth()) == static_cast<int>(sizeof(T)));
+    }
+
+    /**
+     * @brief Create an accessor for a whole image
+     * @param image The image to read; must outlive the accessor
+     */
+    explicit PixelAccessor(const Image& image) noexcept : PixelAccessor(image.view()) {}
+
+    /**
+     * @brief Create an accessor over raw interleaved samples
+     * @param data Pointer to the first byte of the first row
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param stride Distance in bytes between the starts of two rows
+     * @param channels Samples per pixel
+     */
+    PixelAccessor(const uint8_t* data,
+                  int width,
+                  int height,
+                  std::size_t stride,
+                  int channels) noexcept
+        : m_data(data), m_stride(stride), m_width(width), m_height(height), m_channels(channels) {}
+
+    [[nodiscard]] int width() const noexcept { return m_width; }
+    [[nodiscard]] int height() const noexcept { return m_height; }
+    [[nodiscard]] int channels() const noexcept { return m_channels; }
+
+    /**
+     * @brief Get a pointer to the first sample of a row
+     * @param y Row index in [0, height)
+     */
+    [[nodiscard]] const T* row(int y) const noexcept {
+        assert(y >= 0 && y < m_height);
+        return reinterpret_cast<const T*>(m_data + static_cast<std::size_t>(y) * m_stride);
+    }
+
+    /**
+     * @brief Get a row, replicating the border rows for out-of-range indices
+     * @param y Row index (any value)
+     */
+    [[nodiscard]] const T* clampedRow(int y) const noexcept {
+        return row(std::clamp(y, 0, m_height - 1));
+    }
+
+    /**
+     * @brief Read one sample
+     * @param x Column in [0, width)
+     * @param y Row in [0, height)
+     * @param c Channel in [0, channels)
+     */
+    [[nodiscard]] T operator()(int x, int y, int c = 0) const noexcept {
+        assert(x >= 0 && x < m_width);
+        assert(c >= 0 && c < m_channels);
+        return row(y)[static_cast<std::size_t>(x) * m_channels + c];
+    }
+
+    /**
+     * @brief Read one sample, replicating the border for out-of-range coordinates
+     * @param x Column (any value)
+     * @param y Row (any value)
+     * @param c Channel in [0, channels)
+     */
+    [[nodiscard]] T clamped(int x, int y, int c = 0) const noexcept {
+        return (*this)(std::clamp(x, 0, m_width - 1), std::clamp(y, 0, m_height - 1), c);
+    }
+
+private:
+    const uint8_t* m_data;
+    std::size_t m_stride;
+    int m_width;
+    int m_height;
+    int m_channels;
+};
+
+/**
+ * @brief Unchecked, writable pixel access for inner loops
+ *
+ * Same contract as PixelAccessor. Creating it from an Image detaches a shared
+ * (copy-on-write) buffer once, up front, so the writes themselves are plain
+ * stores.
+ *
+ * @tparam T Sample type matching the image depth (uint8_t, uint16_t or float)
+ */
+template <typename T = uint8_t>
+class MutablePixelAccessor {
+public:
+    /**
+     * @brief Create an accessor for a writable view
+     * @param view The pixels to access; must outlive the accessor
+     */
+    explicit MutablePixelAccessor(const MutableImageView& view) noexcept
+        : m_data(view.getData()),
+          m_stride(view.getStride()),
+          m_width(view.getWidth()),
+          m_height(view.getHeight()),
+          m_channels(view.getChannels()) {
+        assert(view.getType() != Image::Type::Binary);
+        assert(Image::bytesPerSample(view.getDepth()) == static_cast<int>(sizeof(T)));
+    }
+
+    /**
+     * @brief Create an accessor for a whole image
+     * @param image The image to access; must outlive the accessor
+     */
+    explicit MutablePixelAccessor(Image& image) : MutablePixelAccessor(image.mutableView()) {}
+
+    /**
+     * @brief Create an accessor over raw interleaved samples
+     * @param data Pointer to the first byte of the first row
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param stride Distance in bytes between the starts of two rows
+     * @param channels Samples per pixel
+     */
+    MutablePixelAccessor(uint8_t* data,
+                         int width,
+                         int height,
+                         std::size_t stride,
+                         int channels) noexcept
+        : m_data(data), m_stride(stride), m_width(width), m_height(height), m_channels(channels) {}
+
+    [[nodiscard]] int width() const noexcept { return m_width; }
+    [[nodiscard]] int height() const noexcept { return m_height; }
+    [[nodiscard]] int channels() const noexcept { return m_channels; }
+
+    /**
+     * @brief Get a pointer to the first sample of a row
+     * @param y Row index in [0, height)
+     */
+    [[nodiscard]] T* row(int y) const noexcept {
+        assert(y >= 0 && y < m_height);
+        return reinterpret_cast<T*>(m_data + static_cast<std::size_t>(y) * m_stride);
+    }
+
+    /**
+     * @brief Access one sample
+     * @param x Column in [0, width)
+     * @param y Row in [0, height)
+     * @param c Channel in [0, channels)
+     */
+    [[nodiscard]] T& operator()(int x, int y, int c = 0) const noexcept {
+        assert(x >= 0 && x < m_width);
+        assert(c >= 0 && c < m_channels);
+        return row(y)[static_cast<std::size_t>(x) * m_channels + c];
+    }
+
+private:
+    uint8_t* m_data;
+    std::size_t m_stride;
+    int m_width;
+    int m_height;
+    int m_channels;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_PIXEL_ACCESSOR_HPP
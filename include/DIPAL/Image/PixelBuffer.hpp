@@ -0,0 +1,178 @@
+// include/DIPAL/Image/PixelBuffer.hpp
+#ifndef DIPAL_PIXEL_BUFFER_HPP
+#define DIPAL_PIXEL_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace DIPAL {
+
+enum class MemoryCategory;
+
+/**
+ * @brief Reference-counted, copy-on-write block of pixel memory
+ *
+ * Copying a PixelBuffer only bumps a reference count; the bytes are shared
+ * until one of the owners asks for write access through mutableData(), at
+ * which point that owner gets a private copy (detach). Read access through
+ * data() never copies.
+ *
+ * Pointers obtained from mutableData() stay valid as long as the buffer is
+ * not copied; copying a buffer and then writing through an older mutable
+ * pointer would also modify the copy.
+ *
+ * Exclusive buffers (see setExclusive()) opt out of sharing: they hold
+ * memory whose writes must reach it, such as a writable file mapping.
+ *
+ * Detaching is not synchronised. Code that writes to one image from several
+ * threads should take the write pointer (or a MutableImageView) once before
+ * handing work out to the threads.
+ */
+class PixelBuffer {
+public:
+    /// Alignment of every buffer allocated by PixelBuffer
+    static constexpr std::size_t kAlignment = 64;
+
+    /**
+     * @brief Create an empty buffer
+     */
+    PixelBuffer() = default;
+
+    /**
+     * @brief Allocate a zero-filled buffer
+     * @param size Size in bytes
+     * @throws std::bad_alloc if the allocation fails
+     */
+    explicit PixelBuffer(std::size_t size);
+
+    /**
+     * @brief Allocate a buffer without clearing it, for callers that overwrite every byte
+     * @param size Size in bytes
+     * @return Buffer whose bytes are indeterminate
+     * @throws std::bad_alloc if the allocation fails
+     */
+    [[nodiscard]] static PixelBuffer uninitialized(std::size_t size);
+
+    /**
+     * @brief Adopt externally managed storage
+     *
+     * The deleter of @p storage decides how the memory is released, which lets
+     * other allocation schemes hand their memory to images.
+     *
+     * @param storage Shared owner of the memory
+     * @param size Size in bytes
+     */
+    PixelBuffer(std::shared_ptr<uint8_t> storage, std::size_t size) noexcept;
+
+    // Copies share the bytes; moves leave the source empty
+    PixelBuffer(const PixelBuffer&) = default;
+    PixelBuffer& operator=(const PixelBuffer&) = default;
+    PixelBuffer(PixelBuffer&& other) noexcept
+        : m_storage(std::move(other.m_storage)),
+          m_size(std::exchange(other.m_size, 0)),
+          m_exclusive(std::exchange(other.m_exclusive, false)) {}
+    PixelBuffer& operator=(PixelBuffer&& other) noexcept {
+        m_storage = std::move(other.m_storage);
+        m_size = std::exchange(other.m_size, 0);
+        m_exclusive = std::exchange(other.m_exclusive, false);
+        return *this;
+    }
+
+    /**
+     * @brief Get read-only access to the bytes (never copies)
+     * @return Pointer to the first byte, or nullptr if empty
+     */
+    [[nodiscard]] const uint8_t* data() const noexcept { return m_storage.get(); }
+
+    /**
+     * @brief Get write access to the bytes, detaching from other owners first
+     * @return Pointer to the first byte, or nullptr if empty
+     * @throws std::bad_alloc if a private copy cannot be allocated
+     */
+    [[nodiscard]] uint8_t* mutableData() {
+        if (isShared()) {
+            detach();
+        }
+        return m_storage.get();
+    }
+
+    /**
+     * @brief Get the size of the buffer
+     * @return Size in bytes
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    /**
+     * @brief Check whether the buffer holds no memory
+     * @return true if empty
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    /**
+     * @brief Check whether other buffers share these bytes
+     * @return true if a write would trigger a copy
+     */
+    [[nodiscard]] bool isShared() const noexcept { return m_storage.use_count() > 1; }
+
+    /**
+     * @brief Get the number of buffers sharing these bytes
+     * @return Reference count (0 if empty)
+     */
+    [[nodiscard]] long useCount() const noexcept { return m_storage.use_count(); }
+
+    /**
+     * @brief Check whether two buffers share the same bytes
+     * @param other Buffer to compare with
+     * @return true if both refer to the same memory
+     */
+    [[nodiscard]] bool sharesWith(const PixelBuffer& other) const noexcept {
+        return m_storage && m_storage == other.m_storage;
+    }
+
+    /**
+     * @brief Mark the bytes as memory that writes must reach
+     *
+     * Images copy an exclusive buffer when they are copied instead of
+     * sharing it, so the original keeps writing to this memory whichever
+     * image is written first. A private copy made by detach() is ordinary
+     * memory and not exclusive.
+     */
+    void setExclusive() noexcept { m_exclusive = true; }
+
+    /**
+     * @brief Check whether the buffer is exclusive (see setExclusive())
+     * @return true if copies of an image must not share these bytes
+     */
+    [[nodiscard]] bool isExclusive() const noexcept { return m_exclusive; }
+
+    /**
+     * @brief Make this buffer the sole owner of its bytes, copying if needed
+     * @throws std::bad_alloc if the copy cannot be allocated
+     */
+    void detach();
+
+    /**
+     * @brief Release the bytes, leaving an empty buffer
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Account the bytes to a MemoryTracker category until the last owner releases them
+     *
+     * Call once, right after allocation and before the buffer is shared.
+     *
+     * @param category Subsystem that owns the memory
+     */
+    void track(MemoryCategory category);
+
+private:
+    std::shared_ptr<uint8_t> m_storage;
+    std::size_t m_size = 0;
+    bool m_exclusive = false;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_PIXEL_BUFFER_HPP
@@ -0,0 +1,125 @@
+// include/DIPAL/Image/PlanarImage.hpp
+#ifndef DIPAL_PLANAR_IMAGE_HPP
+#define DIPAL_PLANAR_IMAGE_HPP
+
+#include "../Core/Error.hpp"
+#include "GrayscaleImage.hpp"
+#include "Image.hpp"
+#include "ImageView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DIPAL {
+
+class ColorImage;
+
+/**
+ * @brief 8-bit color image stored as separate channel planes (structure of arrays)
+ *
+ * ColorImage interleaves its samples (RGBRGB...), which is what the views,
+ * accessors and codecs expect. Per-channel algorithms, however, run best on
+ * contiguous single-channel rows: a PlanarImage holds one GrayscaleImage per
+ * channel so each plane can go through the grayscale code path unchanged.
+ *
+ * Conversion to and from the interleaved layout uses SIMD shuffles where the
+ * target supports them (SSE2 for RGBA, SSSE3 for RGB) and a scalar loop
+ * otherwise. Planes default to the aligned row layout.
+ */
+class PlanarImage {
+public:
+    /**
+     * @brief Create zero-filled planes
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param hasAlpha Whether a fourth (alpha) plane is stored
+     * @param layout Row layout of every plane
+     * @throws std::invalid_argument if the dimensions are not positive
+     */
+    PlanarImage(int width,
+                int height,
+                bool hasAlpha = false,
+                Image::RowLayout layout = Image::RowLayout::Aligned);
+
+    /**
+     * @brief Split interleaved RGB or RGBA pixels into planes
+     * @param view 8-bit RGB or RGBA pixels
+     * @param layout Row layout of the created planes
+     * @return Result containing the planar image or error
+     */
+    [[nodiscard]] static Result<std::unique_ptr<PlanarImage>> fromInterleaved(
+        const ImageView& view,
+        Image::RowLayout layout = Image::RowLayout::Aligned);
+
+    /**
+     * @brief Write the planes back as interleaved pixels
+     * @param view Destination with the same size and channel count
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult toInterleaved(const MutableImageView& view) const;
+
+    /**
+     * @brief Create an interleaved color image from the planes
+     * @param layout Row layout of the created image
+     * @return Result containing an RGB or RGBA image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<ColorImage>> toColorImage(
+        Image::RowLayout layout = Image::RowLayout::Packed) const;
+
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+    [[nodiscard]] int getChannels() const noexcept { return static_cast<int>(m_planes.size()); }
+    [[nodiscard]] bool hasAlpha() const noexcept { return m_planes.size() == 4; }
+
+    /**
+     * @brief Get the image type the planes interleave to
+     * @return Image::Type::RGB or Image::Type::RGBA
+     */
+    [[nodiscard]] Image::Type getType() const noexcept {
+        return hasAlpha() ? Image::Type::RGBA : Image::Type::RGB;
+    }
+
+    /**
+     * @brief Get one channel plane
+     * @param channel Channel index (0=R, 1=G, 2=B, 3=Alpha if available)
+     * @return The plane as a grayscale image
+     * @throws std::out_of_range if the channel does not exist
+     */
+    [[nodiscard]] GrayscaleImage& getPlane(int channel) { return m_planes.at(channel); }
+    [[nodiscard]] const GrayscaleImage& getPlane(int channel) const { return m_planes.at(channel); }
+
+    /**
+     * @brief Split one row of interleaved samples into planes
+     * @param src Interleaved samples, pixels * channels bytes
+     * @param planes One destination pointer per channel, pixels bytes each
+     * @param channels Samples per pixel (1 to 4)
+     * @param pixels Number of pixels in the row
+     */
+    static void deinterleaveRow(const uint8_t* src,
+                                uint8_t* const* planes,
+                                int channels,
+                                std::size_t pixels) noexcept;
+
+    /**
+     * @brief Merge one row of planes into interleaved samples
+     * @param planes One source pointer per channel, pixels bytes each
+     * @param dst Interleaved destination, pixels * channels bytes
+     * @param channels Samples per pixel (1 to 4)
+     * @param pixels Number of pixels in the row
+     */
+    static void interleaveRow(const uint8_t* const* planes,
+                              uint8_t* dst,
+                              int channels,
+                              std::size_t pixels) noexcept;
+
+private:
+    int m_width;
+    int m_height;
+    std::vector<GrayscaleImage> m_planes;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_PLANAR_IMAGE_HPP
@@ -0,0 +1,161 @@
+// include/DIPAL/Image/RLEBinaryImage.hpp
+#ifndef DIPAL_RLE_BINARY_IMAGE_HPP
+#define DIPAL_RLE_BINARY_IMAGE_HPP
+
+#include "../Core/Error.hpp"
+#include "../Core/MemoryTracker.hpp"
+#include "../Core/Types.hpp"
+#include "BinaryImage.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace DIPAL {
+
+/**
+ * @brief Binary image stored as runs of white pixels per row
+ *
+ * Sparse masks (mostly background) take memory proportional to the number
+ * of runs instead of width * height bits, and the boolean operations, area
+ * and bounding box cost O(runs) rather than O(pixels).
+ *
+ * Runs are kept in one array, row after row, each row's runs sorted, maximal
+ * (never adjacent) and inside [0, width). A per-row offset table locates a
+ * row's runs.
+ */
+class RLEBinaryImage {
+public:
+    /**
+     * @brief A run of white pixels [start, end) in one row
+     */
+    struct Run {
+        int start;
+        int end;
+
+        constexpr bool operator==(const Run& other) const noexcept = default;
+    };
+
+    /**
+     * @brief Create an all-black image
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @throws std::invalid_argument if a dimension is negative
+     */
+    RLEBinaryImage(int width, int height);
+
+    /**
+     * @brief Encode a bit-packed image
+     * @param image Source image
+     * @return Result containing the encoded image or error
+     */
+    [[nodiscard]] static Result<RLEBinaryImage> fromBinaryImage(const BinaryImage& image);
+
+    /**
+     * @brief Decode into a bit-packed image
+     * @param layout Row storage layout of the result
+     * @return Result containing the decoded image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<BinaryImage>> toBinaryImage(
+        Image::RowLayout layout = Image::RowLayout::Packed) const;
+
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+
+    /**
+     * @brief Get the runs of one row
+     * @param y Row index
+     * @return Runs sorted by start
+     * @throws std::out_of_range if the row is outside the image
+     */
+    [[nodiscard]] std::span<const Run> getRow(int y) const;
+
+    /**
+     * @brief Replace the runs of one row
+     *
+     * Rows are stored contiguously, so this moves the runs of the rows below;
+     * build whole images with fromBinaryImage() or the boolean operations.
+     *
+     * @param y Row index
+     * @param runs Sorted, non-overlapping runs inside [0, width); adjacent runs are merged
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] VoidResult setRow(int y, std::span<const Run> runs);
+
+    /**
+     * @brief Get a pixel (binary search in its row)
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Result containing true for white or error
+     */
+    [[nodiscard]] Result<bool> getPixel(int x, int y) const;
+
+    /**
+     * @brief Get the total number of runs
+     */
+    [[nodiscard]] std::size_t getRunCount() const noexcept;
+
+    /**
+     * @brief Get the number of white pixels
+     */
+    [[nodiscard]] std::size_t area() const noexcept;
+
+    /**
+     * @brief Get the smallest rectangle containing every white pixel
+     * @return The rectangle, or std::nullopt for an all-black image
+     */
+    [[nodiscard]] std::optional<Rect> boundingBox() const noexcept;
+
+    /**
+     * @brief Get the bytes used by the runs and the row table
+     */
+    [[nodiscard]] std::size_t getDataSize() const noexcept;
+
+    /**
+     * @brief Pixels white in both images
+     * @return Result containing the intersection, or InvalidParameter for different sizes
+     */
+    [[nodiscard]] static Result<RLEBinaryImage> logicalAnd(const RLEBinaryImage& a,
+                                                           const RLEBinaryImage& b);
+
+    /**
+     * @brief Pixels white in either image
+     */
+    [[nodiscard]] static Result<RLEBinaryImage> logicalOr(const RLEBinaryImage& a,
+                                                          const RLEBinaryImage& b);
+
+    /**
+     * @brief Pixels white in exactly one image
+     */
+    [[nodiscard]] static Result<RLEBinaryImage> logicalXor(const RLEBinaryImage& a,
+                                                           const RLEBinaryImage& b);
+
+    /**
+     * @brief Pixels white in a but not in b
+     */
+    [[nodiscard]] static Result<RLEBinaryImage> difference(const RLEBinaryImage& a,
+                                                           const RLEBinaryImage& b);
+
+    bool operator==(const RLEBinaryImage& other) const noexcept;
+
+private:
+    using RunStorage = std::vector<Run, TrackedAllocator<Run, MemoryCategory::Images>>;
+    using OffsetStorage = std::vector<uint32_t, TrackedAllocator<uint32_t, MemoryCategory::Images>>;
+
+    template <typename Op>
+    static Result<RLEBinaryImage> combine(const RLEBinaryImage& a,
+                                          const RLEBinaryImage& b,
+                                          const char* name);
+
+    int m_width;
+    int m_height;
+    RunStorage m_runs;
+    OffsetStorage m_rowOffsets;  // height + 1 entries; row y owns [m_rowOffsets[y], m_rowOffsets[y + 1])
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_RLE_BINARY_IMAGE_HPP
@@ -0,0 +1,330 @@
+// include/DIPAL/Image/TypedImage.hpp
+#ifndef DIPAL_TYPED_IMAGE_HPP
+#define DIPAL_TYPED_IMAGE_HPP
+
+#include "../Core/Error.hpp"
+#include "ColorImage.hpp"
+#include "GrayscaleImage.hpp"
+#include "Image.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace DIPAL {
+
+/**
+ * @brief Compile-time description of a channel sample type
+ *
+ * maxValue is the nominal white level: 255 and 65535 for the integer depths
+ * and 1.0 for float samples. Float images may hold values outside [0, 1];
+ * filters keep them instead of clamping so that chained stages lose nothing.
+ */
+template <typename T>
+struct SampleTraits;
+
+template <>
+struct SampleTraits<uint8_t> {
+    static constexpr Image::Depth depth = Image::Depth::UInt8;
+    static constexpr uint8_t maxValue = 255;
+};
+
+template <>
+struct SampleTraits<uint16_t> {
+    static constexpr Image::Depth depth = Image::Depth::UInt16;
+    static constexpr uint16_t maxValue = 65535;
+};
+
+template <>
+struct SampleTraits<float> {
+    static constexpr Image::Depth depth = Image::Depth::Float32;
+    static constexpr float maxValue = 1.0f;
+};
+
+/**
+ * @brief Sample types supported by the image classes (uint8_t, uint16_t, float)
+ */
+template <typename T>
+concept SampleType = requires {
+    { SampleTraits<T>::depth } -> std::convertible_to<Image::Depth>;
+};
+
+/**
+ * @brief Store a computed value as a sample
+ *
+ * Integer samples are rounded and saturated to [0, maxValue]; float samples
+ * are stored unchanged.
+ */
+template <SampleType T>
+[[nodiscard]] inline T saturateSample(float value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return value;
+    } else {
+        return static_cast<T>(
+            std::clamp(std::round(value), 0.0f, static_cast<float>(SampleTraits<T>::maxValue)));
+    }
+}
+
+/**
+ * @brief Store a filter result as a sample, rounding ties to even
+ *
+ * Like saturateSample(), but integer samples are rounded to nearest with ties
+ * to even, as the SIMD float-to-int conversions do, so scalar loops and their
+ * vector counterparts store the same values. Adding and removing 2^23 leaves
+ * the nearest integer of any float in [0, 2^23) without a library call.
+ */
+template <SampleType T>
+[[nodiscard]] inline T roundToSample(float value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return value;
+    } else {
+        constexpr float kRound = 8388608.0f;
+        const float clamped =
+            std::min(std::max(value, 0.0f), static_cast<float>(SampleTraits<T>::maxValue));
+        return static_cast<T>((clamped + kRound) - kRound);
+    }
+}
+
+/**
+ * @brief Convert a sample between depths, rescaling the nominal range
+ *
+ * 8-bit 255 maps to 16-bit 65535 and to float 1.0, and back.
+ */
+template <SampleType To, SampleType From>
+[[nodiscard]] inline To convertSample(From value) noexcept {
+    if constexpr (std::is_same_v<To, From>) {
+        return value;
+    } else {
+        const float scale = static_cast<float>(SampleTraits<To>::maxValue) /
+                            static_cast<float>(SampleTraits<From>::maxValue);
+        return saturateSample<To>(static_cast<float>(value) * scale);
+    }
+}
+
+/**
+ * @brief Call a generic function with the sample type of a depth
+ *
+ * @p func is invoked with std::type_identity<T>{} for T = uint8_t, uint16_t
+ * or float, which lets run-time depths select template instantiations:
+ *
+ * @code
+ * visitSampleType(image.getDepth(), [&]<typename T>(std::type_identity<T>) {
+ *     PixelAccessor<T> pixels(image);
+ *     ...
+ * });
+ * @endcode
+ */
+template <typename Func>
+decltype(auto) visitSampleType(Image::Depth depth, Func&& func) {
+    switch (depth) {
+        case Image::Depth::UInt16:
+            return std::forward<Func>(func)(std::type_identity<uint16_t>{});
+        case Image::Depth::Float32:
+            return std::forward<Func>(func)(std::type_identity<float>{});
+        default:
+            return std::forward<Func>(func)(std::type_identity<uint8_t>{});
+    }
+}
+
+// 8-bit typed images derive from the classic classes, so code that
+// dispatches on getType() and downcasts keeps working for them
+template <typename PixelT, int Channels>
+struct TypedImageBase {
+    using type = Image;
+};
+
+template <>
+struct TypedImageBase<uint8_t, 1> {
+    using type = GrayscaleImage;
+};
+
+template <>
+struct TypedImageBase<uint8_t, 3> {
+    using type = ColorImage;
+};
+
+template <>
+struct TypedImageBase<uint8_t, 4> {
+    using type = ColorImage;
+};
+
+/**
+ * @brief Image with a compile-time sample type and channel count
+ *
+ * Samples are interleaved like in the 8-bit classes: channel c of pixel x is
+ * row(y)[x * Channels + c]. The image type follows from the channel count
+ * (1 = Grayscale, 3 = RGB, 4 = RGBA) and getDepth() from the sample type, so
+ * filters and transforms can dispatch on the base class.
+ *
+ * TypedImage<uint8_t, 1> is a GrayscaleImage and TypedImage<uint8_t, 3/4> a
+ * ColorImage; the 16-bit and float variants derive from Image directly.
+ *
+ * @tparam PixelT Sample type: uint8_t, uint16_t or float
+ * @tparam Channels Samples per pixel: 1, 3 or 4
+ */
+template <SampleType PixelT, int Channels>
+    requires(Channels == 1 || Channels == 3 || Channels == 4)
+class TypedImage : public TypedImageBase<PixelT, Channels>::type {
+    using Base = typename TypedImageBase<PixelT, Channels>::type;
+
+public:
+    using Sample = PixelT;
+    static constexpr int kChannels = Channels;
+    static constexpr Image::Depth kDepth = SampleTraits<PixelT>::depth;
+    static constexpr Image::Type kType = Channels == 1   ? Image::Type::Grayscale
+                                         : Channels == 3 ? Image::Type::RGB
+                                                         : Image::Type::RGBA;
+
+    /**
+     * @brief Create a new zero-filled image
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param layout Row storage layout
+     */
+    TypedImage(int width, int height, Image::RowLayout layout = Image::RowLayout::Packed)
+        requires std::same_as<Base, Image>
+        : Base(width, height, kType, kDepth, layout) {}
+
+    TypedImage(int width, int height, Image::RowLayout layout = Image::RowLayout::Packed)
+        requires std::same_as<Base, GrayscaleImage>
+        : Base(width, height, layout) {}
+
+    TypedImage(int width, int height, Image::RowLayout layout = Image::RowLayout::Packed)
+        requires std::same_as<Base, ColorImage>
+        : Base(width, height, Channels == 4, layout) {}
+
+    /**
+     * @brief Create an image over existing pixel memory
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param layout Row storage layout
+     * @param buffer Pixel memory of at least stride * height bytes
+     */
+    TypedImage(int width, int height, Image::RowLayout layout, PixelBuffer buffer)
+        requires std::same_as<Base, Image>
+        : Base(width, height, kType, kDepth, layout, std::move(buffer)) {}
+
+    TypedImage(int width, int height, Image::RowLayout layout, PixelBuffer buffer)
+        requires std::same_as<Base, GrayscaleImage>
+        : Base(width, height, layout, std::move(buffer)) {}
+
+    TypedImage(int width, int height, Image::RowLayout layout, PixelBuffer buffer)
+        requires std::same_as<Base, ColorImage>
+        : Base(width, height, Channels == 4, layout, std::move(buffer)) {}
+
+    /**
+     * @brief Get the samples of a row without bounds checking
+     * @param y Row index, must be in [0, height)
+     * @return Pointer to the first sample of the row
+     */
+    [[nodiscard]] const PixelT* row(int y) const noexcept {
+        assert(y >= 0 && y < this->m_height);
+        return reinterpret_cast<const PixelT*>(this->rowPtr(y));
+    }
+
+    /**
+     * @brief Get the writable samples of a row without bounds checking
+     *
+     * Detaches a shared pixel buffer first (copy-on-write).
+     *
+     * @param y Row index, must be in [0, height)
+     * @return Pointer to the first sample of the row
+     */
+    [[nodiscard]] PixelT* row(int y) {
+        assert(y >= 0 && y < this->m_height);
+        return reinterpret_cast<PixelT*>(this->rowPtr(y));
+    }
+
+    /**
+     * @brief Read a sample without bounds checking
+     * @param x Column in [0, width)
+     * @param y Row in [0, height)
+     * @param c Channel in [0, Channels)
+     */
+    [[nodiscard]] PixelT at(int x, int y, int c = 0) const noexcept {
+        assert(x >= 0 && x < this->m_width && c >= 0 && c < Channels);
+        return row(y)[static_cast<std::size_t>(x) * Channels + c];
+    }
+
+    /**
+     * @brief Access a sample without bounds checking
+     * @param x Column in [0, width)
+     * @param y Row in [0, height)
+     * @param c Channel in [0, Channels)
+     */
+    [[nodiscard]] PixelT& at(int x, int y, int c = 0) {
+        assert(x >= 0 && x < this->m_width && c >= 0 && c < Channels);
+        return row(y)[static_cast<std::size_t>(x) * Channels + c];
+    }
+
+    /**
+     * @brief Get a sample value at specific coordinates
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param c Channel index
+     * @return Result containing the sample or error
+     */
+    [[nodiscard]] Result<PixelT> getSample(int x, int y, int c = 0) const {
+        if (!this->isValidCoordinate(x, y) || c < 0 || c >= Channels) {
+            return makeErrorResult<PixelT>(
+                ErrorCode::OutOfRange,
+                std::format("Sample ({}, {}, {}) is out of range", x, y, c));
+        }
+        return makeSuccessResult(at(x, y, c));
+    }
+
+    /**
+     * @brief Set a sample value at specific coordinates
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param c Channel index
+     * @param value Sample value
+     * @return VoidResult indicating success or error
+     */
+    [[maybe_unused]] VoidResult setSample(int x, int y, int c, PixelT value) {
+        if (!this->isValidCoordinate(x, y) || c < 0 || c >= Channels) {
+            return makeVoidErrorResult(
+                ErrorCode::OutOfRange,
+                std::format("Sample ({}, {}, {}) is out of range", x, y, c));
+        }
+        at(x, y, c) = value;
+        return makeVoidSuccessResult();
+    }
+
+    /**
+     * @brief Set every sample of every channel to a value
+     * @param value Sample value
+     */
+    void fill(PixelT value) {
+        const std::size_t samples = static_cast<std::size_t>(this->m_width) * Channels;
+        for (int y = 0; y < this->m_height; ++y) {
+            std::fill_n(row(y), samples, value);
+        }
+    }
+
+    /**
+     * @brief Clone the image
+     * @return A new image sharing the pixels until one of the two is written
+     */
+    [[nodiscard]] std::unique_ptr<Image> clone() const override {
+        return std::make_unique<TypedImage>(*this);
+    }
+};
+
+using Gray16Image = TypedImage<uint16_t, 1>;
+using RGB16Image = TypedImage<uint16_t, 3>;
+using RGBA16Image = TypedImage<uint16_t, 4>;
+using GrayFloatImage = TypedImage<float, 1>;
+using RGBFloatImage = TypedImage<float, 3>;
+using RGBAFloatImage = TypedImage<float, 4>;
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_TYPED_IMAGE_HPP
@@ -39,6 +39,12 @@ public:
      */
     bool isUndoable() const override;
 
+    /**
+     * @brief Get the filter the command applies
+     * @return The filter strategy
+     */
+    [[nodiscard]] const FilterStrategy& getFilter() const noexcept;
+
 private:
     std::unique_ptr<FilterStrategy> m_filter;
 };
@@ -53,6 +53,12 @@ public:
 
     /**
      * @brief Process an image with multiple commands in sequence
+     *
+     * Two or more consecutive FilterCommands are fused into one
+     * FilterPipeline, which runs them tile by tile instead of materializing
+     * an intermediate image per filter; observers see the run as a single
+     * "FilterPipeline" operation.
+     *
      * @param image The image to process
      * @param commands Span of commands to apply in order
      * @return Result containing the processed image or error
@@ -5,6 +5,9 @@
 #include "ImageProcessor.hpp"
 #include "../Utils/Concurrency.hpp"
 
+#include <memory>
+#include <stdexcept>
+
 namespace DIPAL {
 
 /**
@@ -19,7 +22,25 @@ public:
       explicit ParallelProcessor(size_t numThreads = 0)
         : ImageProcessor(), m_numThreads(numThreads) {
         // Create the thread pool
-        m_threadPool = std::make_unique<ThreadPool>(numThreads);
+        m_threadPool = std::make_shared<ThreadPool>(numThreads);
+    }
+
+    /**
+     * @brief Create a parallel image processor on an existing thread pool
+     *
+     * Strip i of every image always runs on worker i, so a pool shared with a
+     * LargePageImageAllocator processes each strip on the worker (and NUMA
+     * node) that first touched its memory.
+     *
+     * @param threadPool Pool to run the strips on
+     * @throws std::invalid_argument if threadPool is null
+     */
+    explicit ParallelProcessor(std::shared_ptr<ThreadPool> threadPool)
+        : ImageProcessor(), m_threadPool(std::move(threadPool)), m_numThreads(0) {
+        if (!m_threadPool) {
+            throw std::invalid_argument("ParallelProcessor needs a thread pool");
+        }
+        m_numThreads = m_threadPool->getThreadCount();
     }
      ParallelProcessor(ParallelProcessor&& other) noexcept
         : ImageProcessor(std::move(other)),
@@ -59,9 +80,15 @@ public:
      */
     [[nodiscard]] size_t getThreadCount() const;
 
+    /**
+     * @brief Get the thread pool the strips run on
+     * @return The pool (shared, e.g. with a LargePageImageAllocator)
+     */
+    [[nodiscard]] std::shared_ptr<ThreadPool> getThreadPool() const;
+
 private:
     // Thread pool for parallel processing
-    std::unique_ptr<ThreadPool> m_threadPool; 
+    std::shared_ptr<ThreadPool> m_threadPool; 
     // Lock for thread pool access
     mutable std::mutex m_poolMutex;
     
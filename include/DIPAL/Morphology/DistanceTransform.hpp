@@ -0,0 +1,70 @@
+// include/DIPAL/Morphology/DistanceTransform.hpp
+#ifndef DIPAL_DISTANCE_TRANSFORM_HPP
+#define DIPAL_DISTANCE_TRANSFORM_HPP
+
+#include "../Core/Error.hpp"
+#include "../Image/BinaryImage.hpp"
+#include "../Image/TypedImage.hpp"
+
+#include <memory>
+
+namespace DIPAL {
+
+class ThreadPool;
+
+/**
+ * @brief Which pixels distances are measured to
+ */
+enum class DistanceTarget {
+    Background,  ///< Distance of every pixel to the nearest black pixel (0 on black)
+    Foreground   ///< Distance of every pixel to the nearest white pixel (0 on white)
+};
+
+/**
+ * @brief Static class for the exact Euclidean distance transform
+ *
+ * Meijster's two-pass algorithm: a column pass finds the vertical distance
+ * to the nearest target pixel in each column, then a row pass takes the
+ * lower envelope of the parabolas those distances define. Both passes are
+ * linear in the number of pixels, independent of the distances involved,
+ * and all arithmetic is on exact integer squared distances.
+ *
+ * The column pass is split into vertical bands and the row pass into
+ * horizontal strips, each processed in parallel.
+ */
+class DistanceTransform {
+public:
+    /**
+     * @brief Compute Euclidean distances as floats
+     * @param image Source image
+     * @param target Pixels the distances are measured to
+     * @param pool Workers for the passes; nullptr uses the shared pool for
+     *             large images and runs small ones on the calling thread
+     * @return Result containing the distance image or error; pixels of an
+     *         image without any target pixel are +infinity
+     */
+    [[nodiscard]] static Result<std::unique_ptr<GrayFloatImage>> compute(
+        const BinaryImage& image,
+        DistanceTarget target = DistanceTarget::Background,
+        ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Compute Euclidean distances rounded to 16-bit integers
+     * @param image Source image
+     * @param target Pixels the distances are measured to
+     * @param pool Workers for the passes, as for compute()
+     * @return Result containing the distance image or error; distances are
+     *         saturated at 65535, which also marks an image without any target pixel
+     */
+    [[nodiscard]] static Result<std::unique_ptr<Gray16Image>> compute16(
+        const BinaryImage& image,
+        DistanceTarget target = DistanceTarget::Background,
+        ThreadPool* pool = nullptr);
+
+private:
+    DistanceTransform() = delete;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_DISTANCE_TRANSFORM_HPP
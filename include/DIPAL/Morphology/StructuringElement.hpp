@@ -0,0 +1,111 @@
+// include/DIPAL/Morphology/StructuringElement.hpp
+#ifndef DIPAL_STRUCTURING_ELEMENT_HPP
+#define DIPAL_STRUCTURING_ELEMENT_HPP
+
+#include "../Core/Types.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace DIPAL {
+
+/**
+ * @brief Shape used by the morphological operators
+ *
+ * A width x height grid of member cells with an anchor cell. The operators
+ * place the anchor on each pixel and look at the pixels under the members,
+ * so a member at grid position (i, j) stands for the offset
+ * (i - anchor.x, j - anchor.y).
+ */
+class StructuringElement {
+public:
+    /**
+     * @brief A horizontal run of members, as offsets from the anchor
+     */
+    struct Run {
+        int dy;      ///< Row offset
+        int dx;      ///< Column offset of the first member
+        int length;  ///< Number of consecutive members
+    };
+
+    /**
+     * @brief Create a structuring element from a mask
+     * @param width Grid width
+     * @param height Grid height
+     * @param mask Row-major cells, non-zero for members (width * height entries)
+     * @param anchor Anchor cell (default: the centre, rounding down)
+     * @throws std::invalid_argument if the size, mask or anchor is invalid or no cell is a member
+     */
+    StructuringElement(int width, int height, const std::vector<uint8_t>& mask);
+    StructuringElement(int width, int height, const std::vector<uint8_t>& mask, Point anchor);
+
+    /**
+     * @brief Create a filled rectangle anchored at its centre
+     * @param width Rectangle width
+     * @param height Rectangle height
+     * @return The structuring element
+     * @throws std::invalid_argument if a dimension is not positive
+     */
+    [[nodiscard]] static StructuringElement rectangle(int width, int height);
+
+    /**
+     * @brief Create a plus-shaped element of the given size (odd sizes are symmetric)
+     */
+    [[nodiscard]] static StructuringElement cross(int size);
+
+    /**
+     * @brief Create the ellipse inscribed in a width x height box
+     */
+    [[nodiscard]] static StructuringElement ellipse(int width, int height);
+
+    /**
+     * @brief Create a diamond (city-block disk) of the given radius
+     */
+    [[nodiscard]] static StructuringElement diamond(int radius);
+
+    [[nodiscard]] int getWidth() const noexcept { return m_width; }
+    [[nodiscard]] int getHeight() const noexcept { return m_height; }
+    [[nodiscard]] Point getAnchor() const noexcept { return m_anchor; }
+
+    /**
+     * @brief Check whether a grid cell is a member
+     * @param x Column in the grid
+     * @param y Row in the grid
+     * @return True for members; false for non-members and cells outside the grid
+     */
+    [[nodiscard]] bool contains(int x, int y) const noexcept;
+
+    /**
+     * @brief Get the number of member cells
+     */
+    [[nodiscard]] int getMemberCount() const noexcept;
+
+    /**
+     * @brief Check whether every cell of the grid is a member
+     *
+     * Rectangles are applied as a horizontal and a vertical line, each in a
+     * logarithmic number of steps.
+     */
+    [[nodiscard]] bool isRectangle() const noexcept;
+
+    /**
+     * @brief Get the element mirrored through its anchor
+     * @return Element with member offsets negated
+     */
+    [[nodiscard]] StructuringElement reflected() const;
+
+    /**
+     * @brief Get the members as maximal horizontal runs, ordered by row
+     */
+    [[nodiscard]] std::vector<Run> getRuns() const;
+
+private:
+    int m_width;
+    int m_height;
+    Point m_anchor;
+    std::vector<uint8_t> m_mask;
+};
+
+}  // namespace DIPAL
+
+#endif  // DIPAL_STRUCTURING_ELEMENT_HPP
@@ -26,6 +26,8 @@ namespace DIPAL {
  */
 class AffineTransform : public ImageTransform {
 public:
+    using ImageTransform::apply;
+
     /**
      * @brief Create an affine transformation with a transformation matrix
      * @param matrix Transformation matrix (2x3 array: [a,b,c,d,e,f])
@@ -94,6 +96,16 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Apply the affine transformation to a view, e.g. a region of interest
+     *
+     * Reads the viewed pixels in place, without copying them first.
+     *
+     * @param view Input pixels
+     * @return Result containing the transformed image, with packed rows, or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const ImageView& view) const override;
+
     /**
      * @brief Get the transformation name
      * @return "AffineTransform"
@@ -157,6 +169,15 @@ private:
      */
     [[nodiscard]] std::function<std::pair<float, float>(float, float, int, int, int, int)>
     createMappingFunction() const;
+
+    /**
+     * @brief Transform a view into a result with the given row layout
+     * @param view Input pixels
+     * @param layout Row layout of the result
+     * @return Result containing the transformed image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> transform(const ImageView& view,
+                                                           Image::RowLayout layout) const;
 };
 
 }  // namespace DIPAL
@@ -20,6 +20,8 @@ namespace DIPAL {
  */
 class GeometricTransform : public ImageTransform {
 public:
+    using ImageTransform::apply;
+
     /**
      * @brief Create a geometric transformation
      * @param width Output image width
@@ -110,6 +112,16 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Apply the geometric transformation to a view, e.g. a region of interest
+     *
+     * Reads the viewed pixels in place, without copying them first.
+     *
+     * @param view Input pixels
+     * @return Result containing the transformed image, with packed rows, or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const ImageView& view) const override;
+
     /**
      * @brief Get the transformation name
      * @return "GeometricTransform"
@@ -149,6 +161,15 @@ private:
     [[nodiscard]] std::function<std::pair<float, float>(int, int)> createPixelMapping(
         int srcWidth,
         int srcHeight) const;
+
+    /**
+     * @brief Transform a view into a result with the given row layout
+     * @param view Input pixels
+     * @param layout Row layout of the result
+     * @return Result containing the transformed image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> transform(const ImageView& view,
+                                                           Image::RowLayout layout) const;
 };
 
 }  // namespace DIPAL
@@ -6,6 +6,7 @@
 #include "../Image/ColorImage.hpp"
 #include "../Image/GrayscaleImage.hpp"
 #include "../Image/Image.hpp"
+#include "../Image/ImageView.hpp"
 #include "Transformations.hpp"  // Include for InterpolationMethod enum
 
 #include <array>
@@ -54,6 +55,51 @@ public:
                                        uint8_t& a,
                                        InterpolationMethod method = InterpolationMethod::Bilinear);
 
+    /**
+     * @brief Resample an image of any sample depth through a coordinate mapping
+     *
+     * Works directly on the samples of grayscale and color images of every
+     * depth (uint8, uint16 and float). Destination pixels whose source
+     * position lies outside the image are zero in every channel; neighbours
+     * outside the image count as zero, like in the 8-bit interpolators.
+     *
+     * @param image Source image
+     * @param dstWidth Width of the result
+     * @param dstHeight Height of the result
+     * @param mapping Function mapping destination pixel coordinates to source coordinates
+     * @param method Interpolation method to use
+     * @return Result containing an image of the source type, depth and layout, or error
+     */
+    static Result<std::unique_ptr<Image>> resample(
+        const Image& image,
+        int dstWidth,
+        int dstHeight,
+        const std::function<std::pair<float, float>(int, int)>& mapping,
+        InterpolationMethod method = InterpolationMethod::Bilinear);
+
+    /**
+     * @brief Resample a view, e.g. a region of interest, without copying it
+     *
+     * As above, with coordinates relative to the view's top-left pixel.
+     * Pixels outside the view are never read, even where the view is a
+     * crop of a larger image.
+     *
+     * @param view Source pixels
+     * @param dstWidth Width of the result
+     * @param dstHeight Height of the result
+     * @param mapping Function mapping destination pixel coordinates to source coordinates
+     * @param method Interpolation method to use
+     * @param layout Row layout of the result
+     * @return Result containing an image of the view's type and depth, or error
+     */
+    static Result<std::unique_ptr<Image>> resample(
+        const ImageView& view,
+        int dstWidth,
+        int dstHeight,
+        const std::function<std::pair<float, float>(int, int)>& mapping,
+        InterpolationMethod method = InterpolationMethod::Bilinear,
+        Image::RowLayout layout = Image::RowLayout::Packed);
+
     /**
      * @brief Create a mapping function for coordinate transformation
      * @param srcWidth Source image width
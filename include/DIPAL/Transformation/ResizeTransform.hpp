@@ -16,6 +16,8 @@ namespace DIPAL {
  */
 class ResizeTransform : public ImageTransform {
 public:
+    using ImageTransform::apply;
+
     /**
      * @brief Create a resize transformation
      * @param newWidth New width in pixels
@@ -33,6 +35,16 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Apply the resize transformation to a view, e.g. a region of interest
+     *
+     * Reads the viewed pixels in place, without copying them first.
+     *
+     * @param view Input pixels
+     * @return Result containing the resized image, with packed rows, or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const ImageView& view) const override;
+
     /**
      * @brief Get the transformation name
      * @return "ResizeTransform"
@@ -62,10 +74,23 @@ private:
     int m_newHeight;
     InterpolationMethod m_method;
 
-    // Helper methods for different interpolation methods
-    [[nodiscard]] Result<std::unique_ptr<Image>> resizeNearestNeighbor(const Image& image) const;
-    [[nodiscard]] Result<std::unique_ptr<Image>> resizeBilinear(const Image& image) const;
-    [[nodiscard]] Result<std::unique_ptr<Image>> resizeBicubic(const Image& image) const;
+    /**
+     * @brief Resize a view into a result with the given row layout
+     * @param view Input pixels
+     * @param layout Row layout of the result
+     * @return Result containing the resized image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> transform(const ImageView& view,
+                                                           Image::RowLayout layout) const;
+
+    // Helper methods for different interpolation methods, on 8-bit images
+    [[nodiscard]] Result<std::unique_ptr<Image>> resizeBilinear(const ImageView& view,
+                                                                Image::RowLayout layout) const;
+    [[nodiscard]] Result<std::unique_ptr<Image>> resizeBicubic(const ImageView& view,
+                                                               Image::RowLayout layout) const;
+    // Any depth through Interpolation::resample; also the 8-bit nearest-neighbor path
+    [[nodiscard]] Result<std::unique_ptr<Image>> resizeTyped(const ImageView& view,
+                                                             Image::RowLayout layout) const;
 };
 
 }  // namespace DIPAL
@@ -27,6 +27,8 @@ enum class RotationCenter {
  */
 class RotateTransform : public ImageTransform {
 public:
+    using ImageTransform::apply;
+
     /**
      * @brief Create a rotation transformation
      * @param angle Rotation angle in degrees (positive = counterclockwise)
@@ -60,6 +62,16 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Apply the rotation transformation to a view, e.g. a region of interest
+     *
+     * Reads the viewed pixels in place, without copying them first.
+     *
+     * @param view Input pixels
+     * @return Result containing the rotated image, with packed rows, or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const ImageView& view) const override;
+
     /**
      * @brief Get the transformation name
      * @return "RotateTransform"
@@ -134,6 +146,15 @@ private:
      */
     static std::function<std::pair<float, float>(float, float, int, int, int, int)>
     createRotationMapping(float angle, float centerX, float centerY);
+
+    /**
+     * @brief Transform a view into a result with the given row layout
+     * @param view Input pixels
+     * @param layout Row layout of the result
+     * @return Result containing the rotated image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> transform(const ImageView& view,
+                                                           Image::RowLayout layout) const;
 };
 
 }  // namespace DIPAL
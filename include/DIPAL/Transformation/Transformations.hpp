@@ -4,6 +4,7 @@
 
 #include "../Core/Error.hpp"
 #include "../Image/Image.hpp"
+#include "../Image/ImageView.hpp"
 
 #include <memory>
 #include <string_view>
@@ -33,6 +34,18 @@ public:
      */
     virtual Result<std::unique_ptr<Image>> apply(const Image& image) const = 0;
 
+    /**
+     * @brief Apply the transformation to a view, e.g. a region of interest
+     *
+     * The default implementation copies the viewed rows into a temporary image
+     * and forwards to apply(const Image&). The built-in transforms override it
+     * and read the view in place.
+     *
+     * @param view The pixels to transform
+     * @return Result containing the transformed image or error
+     */
+    virtual Result<std::unique_ptr<Image>> apply(const ImageView& view) const;
+
     /**
      * @brief Get the name of the transformation
      * @return Transformation name
@@ -28,6 +28,8 @@ enum class WarpMethod {
  */
 class WarpTransform : public ImageTransform {
 public:
+    using ImageTransform::apply;
+
     /**
      * @brief Create a warp transformation using control points
      * @param sourcePoints Source control points
@@ -77,6 +79,16 @@ public:
      */
     [[nodiscard]] Result<std::unique_ptr<Image>> apply(const Image& image) const override;
 
+    /**
+     * @brief Apply the warp transformation to a view, e.g. a region of interest
+     *
+     * Reads the viewed pixels in place, without copying them first.
+     *
+     * @param view Input pixels
+     * @return Result containing the warped image, with packed rows, or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> apply(const ImageView& view) const override;
+
     /**
      * @brief Get the transformation name
      * @return "WarpTransform"
@@ -113,28 +125,43 @@ private:
     WarpMethod m_warpMethod;
     InterpolationMethod m_interpolationMethod;
 
+    /**
+     * @brief Warp a view into a result with the given row layout
+     * @param view Input pixels
+     * @param layout Row layout of the result
+     * @return Result containing the warped image or error
+     */
+    [[nodiscard]] Result<std::unique_ptr<Image>> transform(const ImageView& view,
+                                                           Image::RowLayout layout) const;
+
     // Private methods for different warping algorithms
 
     /**
      * @brief Apply thin-plate spline warping
-     * @param image Input image
+     * @param view Input pixels
+     * @param layout Row layout of the result
      * @return Result containing the warped image or error
      */
-    [[nodiscard]] Result<std::unique_ptr<Image>> applyThinPlateSpline(const Image& image) const;
+    [[nodiscard]] Result<std::unique_ptr<Image>> applyThinPlateSpline(
+        const ImageView& view, Image::RowLayout layout) const;
 
     /**
      * @brief Apply mesh-based warping
-     * @param image Input image
+     * @param view Input pixels
+     * @param layout Row layout of the result
      * @return Result containing the warped image or error
      */
-    [[nodiscard]] Result<std::unique_ptr<Image>> applyMeshWarp(const Image& image) const;
+    [[nodiscard]] Result<std::unique_ptr<Image>> applyMeshWarp(const ImageView& view,
+                                                               Image::RowLayout layout) const;
 
     /**
      * @brief Apply triangulation-based warping
-     * @param image Input image
+     * @param view Input pixels
+     * @param layout Row layout of the result
      * @return Result containing the warped image or error
      */
-    [[nodiscard]] Result<std::unique_ptr<Image>> applyTriangulation(const Image& image) const;
+    [[nodiscard]] Result<std::unique_ptr<Image>> applyTriangulation(const ImageView& view,
+                                                                    Image::RowLayout layout) const;
 };
 
 }  // namespace DIPAL
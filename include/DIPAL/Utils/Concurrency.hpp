@@ -11,23 +11,83 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <exception>
 #include <optional>
 #include <type_traits>
+#include <utility>
 
 namespace DIPAL {
 
+/**
+ * @brief NUMA layout of the machine
+ *
+ * Read once from /sys/devices/system/node on Linux. Elsewhere, or when the
+ * information is unavailable, the machine is reported as a single node that
+ * holds every CPU.
+ */
+class NumaTopology {
+public:
+    /**
+     * @brief Get the number of NUMA nodes
+     * @return Node count (at least 1)
+     */
+    [[nodiscard]] static size_t getNodeCount();
+
+    /**
+     * @brief Get the CPUs that belong to a node
+     * @param node Node index in [0, getNodeCount())
+     * @return CPU numbers of the node (empty for an invalid index)
+     */
+    [[nodiscard]] static const std::vector<int>& getNodeCpus(size_t node);
+
+private:
+    NumaTopology() = delete;
+};
+
+/**
+ * @brief How the workers of a ThreadPool are pinned to CPUs
+ */
+enum class ThreadBinding {
+    None,      ///< Workers may run anywhere
+    NumaNode,  ///< Worker i may run on any CPU of node i * nodes / threads
+    Core       ///< Like NumaNode, but each worker is pinned to a single CPU of its node
+};
+
+/**
+ * @brief Split a range into consecutive, nearly equal parts
+ *
+ * This is the row partition used for strip processing; code that prepares
+ * memory for strips uses it too so both agree on which rows a worker owns.
+ *
+ * @param size Length of the range
+ * @param parts Number of parts
+ * @param index Part to compute, in [0, parts)
+ * @return First and one-past-last element of the part (empty parts are possible)
+ */
+[[nodiscard]] constexpr std::pair<size_t, size_t> partitionRange(size_t size, size_t parts,
+                                                                 size_t index) noexcept {
+    return {size * index / parts, size * (index + 1) / parts};
+}
+
 /**
  * @brief Thread pool for parallel image processing
  * 
  * Allows efficient execution of tasks across multiple threads.
+ *
+ * Besides the shared queue, every worker has a private queue fed by
+ * submitTo(). Sending the same part of an image to the same worker in every
+ * step keeps its pages in that worker's caches and, with a ThreadBinding, on
+ * its NUMA node.
  */
 class ThreadPool {
 public:
     /**
      * @brief Create a thread pool
      * @param numThreads Number of worker threads (default: hardware concurrency)
+     * @param binding How workers are pinned to CPUs; pinning is best effort and
+     *                silently skipped where the platform does not support it
      */
-    explicit ThreadPool(size_t numThreads = 0);
+    explicit ThreadPool(size_t numThreads = 0, ThreadBinding binding = ThreadBinding::None);
     
     /**
      * @brief Destructor - stops all threads
@@ -74,6 +134,41 @@ public:
         m_condition.notify_one();
         return future;
     }
+
+    /**
+     * @brief Submit a task to be executed by one particular worker
+     * @tparam F Function type
+     * @tparam Args Argument types
+     * @param worker Worker index; taken modulo getThreadCount()
+     * @param f Function to execute
+     * @param args Arguments to pass to the function
+     * @return Future for the result
+     */
+    template<typename F, typename... Args>
+    auto submitTo(size_t worker, F&& f, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>> {
+        using ReturnType = std::invoke_result_t<F, Args...>;
+
+        auto task = std::make_shared<std::packaged_task<ReturnType()>>(
+            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+        );
+
+        auto future = task->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+
+            if (m_stop) {
+                throw std::runtime_error("Cannot enqueue on stopped ThreadPool");
+            }
+
+            m_workerTasks[worker % m_workerTasks.size()].emplace([task]() { (*task)(); });
+        }
+
+        // Only the target worker can run it, so every waiter has to check
+        m_condition.notify_all();
+        return future;
+    }
     
     /**
      * @brief Get the number of active threads
@@ -92,12 +187,39 @@ public:
      */
     void waitForCompletion();
 
+    /**
+     * @brief Get how the workers are pinned
+     * @return Binding requested at construction
+     */
+    ThreadBinding getBinding() const noexcept;
+
+    /**
+     * @brief Get the NUMA node a worker is bound to
+     * @param worker Worker index
+     * @return Node index, or -1 when the workers are not bound
+     */
+    int getWorkerNode(size_t worker) const noexcept;
+
+    /**
+     * @brief Get the index of the calling thread within this pool
+     * @return Worker index, or std::nullopt when called from another thread
+     */
+    std::optional<size_t> currentWorkerIndex() const noexcept;
+
 private:
+    void workerLoop(size_t index);
+    bool hasPendingTasks() const;
+
     // Worker threads
     std::vector<std::thread> m_workers;
     
     // Task queue
     std::queue<std::function<void()>> m_tasks;
+    std::vector<std::queue<std::function<void()>>> m_workerTasks;
+
+    // Pinning
+    ThreadBinding m_binding;
+    std::vector<int> m_workerNodes;
     
     // Synchronization
     mutable std::mutex m_queueMutex;
@@ -158,6 +280,71 @@ void parallelFor(IndexType start, IndexType end, Func func, size_t numThreads =
     }
 }
 
+/**
+ * @brief Pixels from which an image operation runs on several threads
+ *
+ * Below about 2^18 pixels (a 512 x 512 image), handing parts to the workers
+ * and waiting for them costs as much as a simple filter's work, so smaller
+ * images run on the calling thread. Filters doing much more work per pixel
+ * may pass a lower threshold to sharedPoolFor().
+ */
+inline constexpr size_t kParallelPixels = size_t{1} << 18;
+
+/**
+ * @brief Get the process-wide pool for one large operation whose caller passed none
+ *
+ * Algorithms taking an optional ThreadPool* use this for the nullptr case.
+ * The pool has one worker per hardware thread; it is started on first use
+ * and lives until the process exits, so operations do not pay for creating
+ * and joining threads. No pool is returned for small work, on single-core
+ * machines, or when the calling thread is itself a pool worker: its pool is
+ * busy with sibling tasks, and more threads would only oversubscribe the cores.
+ *
+ * @param work Amount of work, e.g. the number of pixels
+ * @param minimumWork Smallest amount worth using several threads for
+ * @return The shared pool, or nullptr to run on the calling thread
+ */
+[[nodiscard]] ThreadPool* sharedPoolFor(size_t work, size_t minimumWork = kParallelPixels);
+
+/**
+ * @brief Run one task per part, part i on worker i of a pool
+ *
+ * Pinning part i to worker i keeps the same rows on the same worker across
+ * the passes of a multi-pass algorithm. Runs on the calling thread when there
+ * is no pool, a single part, or when called from a worker of the pool (which
+ * would otherwise wait on its own queue). Every part finishes before the
+ * first exception is rethrown, since tasks usually reference the caller's frame.
+ *
+ * @param pool Workers, or nullptr
+ * @param parts Number of parts
+ * @param fn Called as fn(i) for every i in [0, parts)
+ */
+template<typename Fn>
+void forEachPart(ThreadPool* pool, size_t parts, Fn&& fn) {
+    if (!pool || parts == 1 || pool->currentWorkerIndex()) {
+        for (size_t i = 0; i < parts; ++i) {
+            fn(i);
+        }
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve(parts);
+    for (size_t i = 0; i < parts; ++i) {
+        futures.push_back(pool->submitTo(i, [&fn, i]() { fn(i); }));
+    }
+    std::exception_ptr failure;
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            failure = failure ? failure : std::current_exception();
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
 } // namespace DIPAL
 
 #endif // DIPAL_CONCURRENCY_HPP
@@ -3,9 +3,13 @@
 #define DIPAL_MEMORY_UTILS_HPP
 
 #include <memory>
+#include <new>
 #include <vector>
 #include <span>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <stdexcept>
 
@@ -101,6 +105,61 @@ public:
         
         return vec;
     }
+
+    /**
+     * @brief Round a size up to the next multiple of an alignment
+     * @param size Size in bytes
+     * @param alignment Alignment in bytes (must be power of 2)
+     * @return Aligned size
+     */
+    static constexpr size_t alignUp(size_t size, size_t alignment) noexcept {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+};
+
+/**
+ * @brief Standard allocator returning storage aligned to a fixed boundary
+ *
+ * Used for pixel buffers so that the first row (and every row of an image
+ * with an aligned stride) starts on a cache-line boundary.
+ *
+ * @tparam T Element type
+ * @tparam Alignment Alignment in bytes (must be power of 2)
+ */
+template <typename T, size_t Alignment = 64>
+class AlignedAllocator {
+public:
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of 2");
+    static_assert(Alignment >= alignof(void*), "Alignment must be at least pointer alignment");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        void* ptr = MemoryUtils::alignedAlloc(count * sizeof(T), Alignment);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* ptr, [[maybe_unused]] size_t count) noexcept {
+        MemoryUtils::alignedFree(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
 };
 
 } // namespace DIPAL
@@ -1,5 +1,6 @@
 // src/Core/Core.cpp
 #include "../../include/DIPAL/Core/Core.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -27,8 +28,6 @@ namespace DIPAL {
 
 // Static member definitions
 bool Core::s_initialized = false;
-std::size_t Core::s_memoryUsage = 0;
-std::size_t Core::s_peakMemoryUsage = 0;
 std::chrono::high_resolution_clock::time_point Core::s_initTime;
 
 // Version implementation
@@ -90,8 +89,7 @@ VoidResult Core::initialize() {
 
     try {
         s_initTime = now();
-        s_memoryUsage = 0;
-        s_peakMemoryUsage = 0;
+        MemoryTracker::resetPeaks();
 
         // Initialize any global state here
         // For example: thread pools, memory allocators, etc.
@@ -119,15 +117,15 @@ bool Core::isInitialized() noexcept {
 }
 
 std::size_t Core::getMemoryUsage() {
-    return s_memoryUsage;
+    return MemoryTracker::getTotalUsage();
 }
 
 std::size_t Core::getPeakMemoryUsage() {
-    return s_peakMemoryUsage;
+    return MemoryTracker::getTotalPeakUsage();
 }
 
 void Core::resetPeakMemoryUsage() {
-    s_peakMemoryUsage = s_memoryUsage;
+    MemoryTracker::resetPeaks();
 }
 
 std::chrono::high_resolution_clock::time_point Core::now() noexcept {
@@ -264,9 +262,6 @@ int Core::getOptimalThreadCount() noexcept {
 }
 
 void* Core::alignedAlloc(std::size_t size, std::size_t alignment) {
-    s_memoryUsage += size;
-    s_peakMemoryUsage = (std::max)(s_peakMemoryUsage, s_memoryUsage);
-
 #ifdef _WIN32
     return _aligned_malloc(size, alignment);
 #elif defined(__ANDROID__) || defined(ANDROID)
@@ -0,0 +1,107 @@
+// src/Core/MemoryTracker.cpp
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+
+#include <atomic>
+
+namespace DIPAL {
+
+namespace {
+
+// One cache line per category so threads working in different subsystems
+// do not contend on the same counters
+struct alignas(64) Counters {
+    std::atomic<std::size_t> current{0};
+    std::atomic<std::size_t> peak{0};
+    std::atomic<std::size_t> allocations{0};
+};
+
+std::array<Counters, MemoryTracker::kCategoryCount> g_categories;
+alignas(64) Counters g_total;
+
+thread_local MemoryCategory t_category = MemoryCategory::Images;
+
+void raisePeak(std::atomic<std::size_t>& peak, std::size_t value) noexcept {
+    std::size_t observed = peak.load(std::memory_order_relaxed);
+    while (observed < value &&
+           !peak.compare_exchange_weak(observed, value, std::memory_order_relaxed)) {
+    }
+}
+
+void add(Counters& counters, std::size_t bytes) noexcept {
+    const std::size_t current = counters.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    raisePeak(counters.peak, current);
+}
+
+void subtract(Counters& counters, std::size_t bytes) noexcept {
+    counters.current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+Counters& countersOf(MemoryCategory category) noexcept {
+    return g_categories[static_cast<std::size_t>(category)];
+}
+
+}  // namespace
+
+void MemoryTracker::recordAllocation(MemoryCategory category, std::size_t bytes) noexcept {
+    add(countersOf(category), bytes);
+    add(g_total, bytes);
+}
+
+void MemoryTracker::recordDeallocation(MemoryCategory category, std::size_t bytes) noexcept {
+    subtract(countersOf(category), bytes);
+    subtract(g_total, bytes);
+}
+
+MemoryTracker::Usage MemoryTracker::getUsage(MemoryCategory category) noexcept {
+    const Counters& counters = countersOf(category);
+    Usage usage;
+    usage.current = counters.current.load(std::memory_order_relaxed);
+    usage.peak = counters.peak.load(std::memory_order_relaxed);
+    usage.allocations = counters.allocations.load(std::memory_order_relaxed);
+    return usage;
+}
+
+std::size_t MemoryTracker::getTotalUsage() noexcept {
+    return g_total.current.load(std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::getTotalPeakUsage() noexcept {
+    return g_total.peak.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::resetPeaks() noexcept {
+    for (auto& counters : g_categories) {
+        counters.peak.store(counters.current.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+    }
+    g_total.peak.store(g_total.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+MemoryCategory MemoryTracker::currentCategory() noexcept {
+    return t_category;
+}
+
+std::string_view MemoryTracker::categoryName(MemoryCategory category) noexcept {
+    switch (category) {
+        case MemoryCategory::Images:
+            return "Images";
+        case MemoryCategory::FilterTemporaries:
+            return "FilterTemporaries";
+        case MemoryCategory::IOBuffers:
+            return "IOBuffers";
+        case MemoryCategory::PoolCache:
+            return "PoolCache";
+    }
+    return "Unknown";
+}
+
+MemoryTracker::Scope::Scope(MemoryCategory category) noexcept : m_previous(t_category) {
+    t_category = category;
+}
+
+MemoryTracker::Scope::~Scope() {
+    t_category = m_previous;
+}
+
+}  // namespace DIPAL
@@ -0,0 +1,177 @@
+// src/Filters/BoxBlurFilter.cpp
+#include "../../include/DIPAL/Filters/BoxBlurFilter.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/IntegralImage.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace DIPAL {
+
+namespace {
+
+// Blurs the pixels of a tile of the source into a tile-sized destination
+template <typename T, typename Sum>
+void boxBlur(const ImageView& source,
+             const Rect& tile,
+             const MutableImageView& destination,
+             int radius) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    const std::size_t channels = static_cast<std::size_t>(source.getChannels());
+
+    ThreadPool* workers =
+        sharedPoolFor(static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    auto table = IntegralImage<Sum>::compute(source, false, workers);
+    if (!table) {
+        throw std::runtime_error(std::string(table.error().message()));
+    }
+
+    // The table holds the whole source, so the destination may alias it
+    const MutablePixelAccessor<T> dst(destination);
+    const std::size_t parts =
+        std::min(workers ? workers->getThreadCount() : 1, static_cast<std::size_t>(tile.height));
+    forEachPart(workers, parts, [&](std::size_t part) {
+        const auto [first, last] =
+            partitionRange(static_cast<std::size_t>(tile.height), parts, part);
+        TemporaryBuffer<Sum> sums(static_cast<std::size_t>(width) * channels);
+        for (int y = tile.y + static_cast<int>(first); y < tile.y + static_cast<int>(last); ++y) {
+            table.value().windowSums(y, radius, sums);
+            const int rows = std::min(height, y + radius + 1) - std::max(0, y - radius);
+            T* out = dst.row(y - tile.y);
+            for (int i = 0; i < tile.width; ++i) {
+                const int x = tile.x + i;
+                const int columns = std::min(width, x + radius + 1) - std::max(0, x - radius);
+                const auto area = static_cast<Sum>(rows) * static_cast<Sum>(columns);
+                for (std::size_t c = 0; c < channels; ++c) {
+                    const Sum sum = sums[x * channels + c];
+                    if constexpr (std::is_floating_point_v<T>) {
+                        out[i * channels + c] = static_cast<T>(sum / area);
+                    } else {
+                        out[i * channels + c] = static_cast<T>((sum + area / 2) / area);
+                    }
+                }
+            }
+        }
+    });
+}
+
+}  // namespace
+
+BoxBlurFilter::BoxBlurFilter(int radius) : m_radius(radius) {
+    if (radius < 0) {
+        throw std::invalid_argument(std::format("Radius must not be negative, got {}", radius));
+    }
+}
+
+Result<std::unique_ptr<Image>> BoxBlurFilter::apply(const Image& image) const {
+    if (image.getWidth() == 0 || image.getHeight() == 0) {
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
+                                                       "Cannot apply filter to an empty image");
+    }
+
+    auto resultImage = ImageFactory::create(image.getWidth(), image.getHeight(), image.getType(),
+                                            image.getDepth(), image.getRowLayout());
+    if (!resultImage) {
+        return resultImage;
+    }
+    auto result = std::move(resultImage.value());
+
+    auto status = applyTo(image.view(), result->mutableView());
+    if (!status) {
+        return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                       status.error().message());
+    }
+    return makeSuccessResult(std::move(result));
+}
+
+VoidResult BoxBlurFilter::applyTo(const ImageView& source,
+                                  const MutableImageView& destination) const {
+    if (destination.getWidth() != source.getWidth() ||
+        destination.getHeight() != source.getHeight()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Blur destination must match the source size and type");
+    }
+    return blur(source, source.bounds(), destination);
+}
+
+VoidResult BoxBlurFilter::applyTile(const ImageView& source,
+                                    const Rect& tile,
+                                    const MutableImageView& destination) const {
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+    return blur(source, tile, destination);
+}
+
+VoidResult BoxBlurFilter::blur(const ImageView& source,
+                               const Rect& tile,
+                               const MutableImageView& destination) const {
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type: {}", static_cast<int>(source.getType())));
+    }
+    if (destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Blur destination must match the source size and type");
+    }
+    if (source.isEmpty()) {
+        return makeVoidSuccessResult();
+    }
+
+    try {
+        // Windows wider than the image are clipped to it anyway
+        const int radius = std::min(m_radius, std::max(source.getWidth(), source.getHeight()));
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            if constexpr (std::is_floating_point_v<T>) {
+                boxBlur<T, double>(source, tile, destination, radius);
+            } else {
+                // 32-bit sums are exact while a full window, plus the rounding
+                // term, stays below 2^32; the table itself may wrap around
+                const auto side = static_cast<uint64_t>(2 * radius + 1);
+                const uint64_t windowMax =
+                    std::min<uint64_t>(side, source.getWidth()) *
+                    std::min<uint64_t>(side, source.getHeight()) * (SampleTraits<T>::maxValue + 1ull);
+                if (windowMax <= std::numeric_limits<uint32_t>::max()) {
+                    boxBlur<T, uint32_t>(source, tile, destination, radius);
+                } else {
+                    boxBlur<T, uint64_t>(source, tile, destination, radius);
+                }
+            }
+        });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Box blur failed: {}", e.what()));
+    }
+}
+
+FilterFootprint BoxBlurFilter::getFootprint() const {
+    return {m_radius, m_radius, m_radius, m_radius};
+}
+
+std::string_view BoxBlurFilter::getName() const {
+    return "BoxBlur";
+}
+
+std::unique_ptr<FilterStrategy> BoxBlurFilter::clone() const {
+    return std::make_unique<BoxBlurFilter>(m_radius);
+}
+
+int BoxBlurFilter::getRadius() const noexcept {
+    return m_radius;
+}
+
+}  // namespace DIPAL
@@ -0,0 +1,391 @@
+// src/Filters/ConvolutionFilter.cpp
+#include "../../include/DIPAL/Filters/ConvolutionFilter.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Filters/FFT.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+#include <type_traits>
+
+namespace DIPAL {
+
+namespace {
+
+using Complex = FFTPlan::Complex;
+
+// Measured cost of an FFT convolution, per channel, in units of direct
+// multiply-adds per padded pixel and log2 of the padded size
+constexpr double kFFTCost = 2.5;
+
+// Direct sums run over chunks of a row this long, so the accumulators stay in L1
+constexpr std::size_t kChunk = 1024;
+
+// Relative residual below which a kernel counts as an outer product
+constexpr float kRankTolerance = 1e-6f;
+
+// Factors a rank-1 kernel into a column kernel times a row kernel, pivoting
+// on its largest weight
+std::optional<SeparableConvolution> factorKernel(const std::vector<float>& kernel,
+                                                 int width,
+                                                 int height) {
+    const auto pivot = static_cast<int>(
+        std::max_element(kernel.begin(), kernel.end(),
+                         [](float a, float b) { return std::abs(a) < std::abs(b); }) -
+        kernel.begin());
+    const int pivotRow = pivot / width;
+    const int pivotColumn = pivot % width;
+    const float largest = std::abs(kernel[pivot]);
+
+    std::vector<float> column(static_cast<std::size_t>(height));
+    std::vector<float> row(static_cast<std::size_t>(width), 0.0f);
+    for (int j = 0; j < height; ++j) {
+        column[j] = kernel[j * width + pivotColumn];
+    }
+    if (largest > 0.0f) {
+        for (int i = 0; i < width; ++i) {
+            row[i] = kernel[pivotRow * width + i] / kernel[pivot];
+        }
+    }
+
+    for (int j = 0; j < height; ++j) {
+        for (int i = 0; i < width; ++i) {
+            if (std::abs(kernel[j * width + i] - column[j] * row[i]) > kRankTolerance * largest) {
+                return std::nullopt;
+            }
+        }
+    }
+    return SeparableConvolution(std::move(row), std::move(column));
+}
+
+// Streams the tile's rows through a ring of kernelHeight rows, converted to
+// float and padded by replicating the border pixels; row y is stored once
+// the rows below it have been read, so the destination may be the source
+template <typename T>
+void convolveDirect(const ImageView& source,
+                    const Rect& tile,
+                    const MutableImageView& destination,
+                    std::span<const float> kernel,
+                    int kernelWidth,
+                    int kernelHeight) {
+    const PixelAccessor<T> src(source);
+    const MutablePixelAccessor<T> dst(destination);
+    const int height = src.height();
+    const auto channels = static_cast<std::size_t>(src.channels());
+    const std::size_t samples = static_cast<std::size_t>(src.width()) * channels;
+    const std::size_t padding = static_cast<std::size_t>(kernelWidth / 2) * channels;
+    const std::size_t stride = samples + 2 * padding;
+    const int radiusY = kernelHeight / 2;
+    const auto ringRows = static_cast<std::size_t>(kernelHeight);
+
+    const std::size_t firstSample = static_cast<std::size_t>(tile.x) * channels;
+    const std::size_t tileSamples = static_cast<std::size_t>(tile.width) * channels;
+
+    TemporaryBuffer<float> ring(ringRows * stride);
+    TemporaryBuffer<float> sums(std::min(tileSamples, kChunk));
+
+    int next = std::max(0, tile.y - radiusY);  // next source row to load
+    for (int y = tile.y; y < tile.y + tile.height; ++y) {
+        for (const int needed = std::min(y + radiusY, height - 1); next <= needed; ++next) {
+            float* row = ring.data() + static_cast<std::size_t>(next) % ringRows * stride;
+            const T* in = src.row(next);
+            for (std::size_t s = 0; s < samples; ++s) {
+                row[padding + s] = static_cast<float>(in[s]);
+            }
+            for (std::size_t j = 0; j < padding; ++j) {
+                row[j] = row[padding + j % channels];
+                row[padding + samples + j] = row[padding + samples - channels + j % channels];
+            }
+        }
+
+        T* out = dst.row(y - tile.y);
+        for (std::size_t done = 0; done < tileSamples; done += kChunk) {
+            const std::size_t first = firstSample + done;
+            const std::size_t count = std::min(kChunk, tileSamples - done);
+            std::fill_n(sums.data(), count, 0.0f);
+            for (int j = 0; j < kernelHeight; ++j) {
+                const int sourceRow = std::clamp(y + j - radiusY, 0, height - 1);
+                const float* row =
+                    ring.data() + static_cast<std::size_t>(sourceRow) % ringRows * stride + first;
+                for (int i = 0; i < kernelWidth; ++i) {
+                    const float weight = kernel[j * kernelWidth + i];
+                    if (weight == 0.0f) {
+                        continue;
+                    }
+                    const float* in = row + static_cast<std::size_t>(i) * channels;
+                    for (std::size_t s = 0; s < count; ++s) {
+                        sums[s] += weight * in[s];
+                    }
+                }
+            }
+            for (std::size_t s = 0; s < count; ++s) {
+                out[done + s] = roundToSample<T>(sums[s]);
+            }
+        }
+    }
+}
+
+// Convolves each channel as the product of its spectrum with the kernel's.
+// The channel is placed in a zero-padded plane shifted by the kernel radius,
+// with its borders replicated over the radius, so the circular convolution
+// never wraps around into the output. Only the tile's pixels are stored.
+template <typename T>
+void convolveFFT(const ImageView& source,
+                 const Rect& tile,
+                 const MutableImageView& destination,
+                 const FFTPlan& plan,
+                 std::span<const Complex> kernelSpectrum,
+                 int radiusX,
+                 int radiusY) {
+    const PixelAccessor<T> src(source);
+    const MutablePixelAccessor<T> dst(destination);
+    const int width = src.width();
+    const int height = src.height();
+    const int channels = src.channels();
+    const auto planeWidth = static_cast<std::size_t>(plan.getWidth());
+    const auto planeHeight = static_cast<std::size_t>(plan.getHeight());
+
+    ThreadPool* workers = sharedPoolFor(planeWidth * planeHeight);
+    const std::size_t parts = std::min(workers ? workers->getThreadCount() : 1, planeHeight);
+    const auto forEachRows = [&](int rows, auto&& fn) {
+        forEachPart(workers, parts, [&](std::size_t part) {
+            const auto [y0, y1] = partitionRange(static_cast<std::size_t>(rows), parts, part);
+            for (auto y = static_cast<int>(y0); y < static_cast<int>(y1); ++y) {
+                fn(y);
+            }
+        });
+    };
+
+    // Only the image and its replicated border are written into the plane;
+    // the rest is zero
+    TemporaryBuffer<float> plane(planeWidth * planeHeight);
+    TemporaryBuffer<Complex> spectrum(kernelSpectrum.size());
+    const int paddedWidth = width + 2 * radiusX;
+    const int paddedHeight = height + 2 * radiusY;
+
+    for (int c = 0; c < channels; ++c) {
+        forEachRows(paddedHeight, [&](int q) {
+            const T* in = src.row(std::clamp(q - radiusY, 0, height - 1));
+            float* row = plane.data() + static_cast<std::size_t>(q) * planeWidth;
+            for (int p = 0; p < paddedWidth; ++p) {
+                row[p] = static_cast<float>(in[std::clamp(p - radiusX, 0, width - 1) * channels + c]);
+            }
+        });
+
+        auto status = plan.forward(plane, spectrum, workers);
+        if (!status) {
+            throw std::runtime_error(std::string(status.error().message()));
+        }
+        const auto bins = static_cast<std::size_t>(plan.getSpectrumWidth());
+        forEachRows(static_cast<int>(planeHeight), [&](int v) {
+            Complex* row = spectrum.data() + static_cast<std::size_t>(v) * bins;
+            const Complex* weights = kernelSpectrum.data() + static_cast<std::size_t>(v) * bins;
+            for (std::size_t u = 0; u < bins; ++u) {
+                const Complex a = row[u];
+                const Complex k = weights[u];
+                row[u] = {a.real() * k.real() - a.imag() * k.imag(),
+                          a.real() * k.imag() + a.imag() * k.real()};
+            }
+        });
+        status = plan.inverse(spectrum, plane, workers);
+        if (!status) {
+            throw std::runtime_error(std::string(status.error().message()));
+        }
+
+        forEachRows(tile.height, [&](int y) {
+            const float* row =
+                plane.data() + static_cast<std::size_t>(tile.y + y) * planeWidth + tile.x;
+            T* out = dst.row(y);
+            for (int x = 0; x < tile.width; ++x) {
+                out[x * channels + c] = roundToSample<T>(row[x]);
+            }
+        });
+
+        // The inverse wrote the whole plane; clear it for the next channel
+        if (c + 1 < channels) {
+            std::fill(plane.begin(), plane.end(), 0.0f);
+        }
+    }
+}
+
+int paddedSize(int size, int kernelSize) {
+    return FFTPlan::goodSize(size + kernelSize - 1);
+}
+
+}  // namespace
+
+ConvolutionFilter::ConvolutionFilter(std::vector<float> kernel,
+                                     int kernelWidth,
+                                     int kernelHeight,
+                                     Method method)
+    : m_kernel(std::move(kernel)),
+      m_kernelWidth(kernelWidth),
+      m_kernelHeight(kernelHeight),
+      m_method(method) {
+    if (kernelWidth <= 0 || kernelHeight <= 0 || kernelWidth % 2 == 0 || kernelHeight % 2 == 0) {
+        throw std::invalid_argument(std::format("Kernel size must be odd and positive, got {}x{}",
+                                                kernelWidth, kernelHeight));
+    }
+    if (m_kernel.size() != static_cast<std::size_t>(kernelWidth) * kernelHeight) {
+        throw std::invalid_argument(std::format("A {}x{} kernel needs {} weights, got {}",
+                                                kernelWidth, kernelHeight,
+                                                kernelWidth * kernelHeight, m_kernel.size()));
+    }
+
+    m_separable = factorKernel(m_kernel, kernelWidth, kernelHeight);
+    if (method == Method::Separable && !m_separable) {
+        throw std::invalid_argument("Kernel is not separable");
+    }
+}
+
+ConvolutionFilter::Method ConvolutionFilter::getMethodFor(int width, int height) const noexcept {
+    if (m_method != Method::Auto) {
+        return m_method;
+    }
+    if (m_separable) {
+        return Method::Separable;
+    }
+    if (width <= 0 || height <= 0) {
+        return Method::Direct;
+    }
+
+    // Direct costs kernelWidth * kernelHeight multiply-adds per pixel; the
+    // FFT about log2 of the padded size per padded pixel
+    const double padded = static_cast<double>(paddedSize(width, m_kernelWidth)) *
+                          paddedSize(height, m_kernelHeight);
+    const double fftCost = kFFTCost * padded * std::log2(padded) /
+                           (static_cast<double>(width) * height);
+    return static_cast<double>(m_kernelWidth) * m_kernelHeight > fftCost ? Method::FFT
+                                                                          : Method::Direct;
+}
+
+std::shared_ptr<const ConvolutionFilter::Spectrum> ConvolutionFilter::kernelSpectrum(
+    int width, int height) const {
+    const std::scoped_lock lock(m_spectraMutex);
+    auto& spectrum = m_spectra[{width, height}];
+    if (!spectrum) {
+        // kernel(i, j) goes to (-i, -j) modulo the plane size, which turns
+        // the circular convolution into the correlation the filter applies
+        auto plan = FFTPlan::get(width, height);
+        std::vector<float> plane(static_cast<std::size_t>(width) * height, 0.0f);
+        for (int j = 0; j < m_kernelHeight; ++j) {
+            for (int i = 0; i < m_kernelWidth; ++i) {
+                const int x = (width - i) % width;
+                const int y = (height - j) % height;
+                plane[static_cast<std::size_t>(y) * width + x] = m_kernel[j * m_kernelWidth + i];
+            }
+        }
+        auto result = std::make_shared<Spectrum>(
+            static_cast<std::size_t>(plan->getSpectrumWidth()) * height);
+        auto status = plan->forward(plane, *result);
+        if (!status) {
+            throw std::runtime_error(std::string(status.error().message()));
+        }
+        spectrum = std::move(result);
+    }
+    return spectrum;
+}
+
+Result<std::unique_ptr<Image>> ConvolutionFilter::apply(const Image& image) const {
+    auto resultImage = ImageFactory::create(image.getWidth(), image.getHeight(), image.getType(),
+                                            image.getDepth(), image.getRowLayout());
+    if (!resultImage) {
+        return resultImage;
+    }
+    auto result = std::move(resultImage.value());
+
+    auto status = applyTo(image.view(), result->mutableView());
+    if (!status) {
+        return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                       status.error().message());
+    }
+    return makeSuccessResult(std::move(result));
+}
+
+VoidResult ConvolutionFilter::applyTo(const ImageView& source,
+                                      const MutableImageView& destination) const {
+    if (destination.getWidth() != source.getWidth() ||
+        destination.getHeight() != source.getHeight()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Convolution destination must match the source size and type");
+    }
+    return convolve(source, source.bounds(), destination);
+}
+
+VoidResult ConvolutionFilter::applyTile(const ImageView& source,
+                                        const Rect& tile,
+                                        const MutableImageView& destination) const {
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+    return convolve(source, tile, destination);
+}
+
+VoidResult ConvolutionFilter::convolve(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const {
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type for convolution: {}",
+                        static_cast<int>(source.getType())));
+    }
+    if (destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Convolution destination must match the source size and type");
+    }
+    if (source.isEmpty()) {
+        return makeVoidSuccessResult();
+    }
+
+    const Method method = getMethodFor(source.getWidth(), source.getHeight());
+    if (method == Method::Separable) {
+        return m_separable->apply(source, tile, destination);
+    }
+
+    try {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        if (method == Method::FFT) {
+            const int planeWidth = paddedSize(source.getWidth(), m_kernelWidth);
+            const int planeHeight = paddedSize(source.getHeight(), m_kernelHeight);
+            auto plan = FFTPlan::get(planeWidth, planeHeight);
+            auto spectrum = kernelSpectrum(planeWidth, planeHeight);
+            visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+                convolveFFT<T>(source, tile, destination, *plan, *spectrum, m_kernelWidth / 2,
+                               m_kernelHeight / 2);
+            });
+        } else {
+            visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+                convolveDirect<T>(source, tile, destination, m_kernel, m_kernelWidth,
+                                  m_kernelHeight);
+            });
+        }
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Convolution failed: {}", e.what()));
+    }
+}
+
+FilterFootprint ConvolutionFilter::getFootprint() const {
+    const int rx = m_kernelWidth / 2;
+    const int ry = m_kernelHeight / 2;
+    return {rx, ry, rx, ry};
+}
+
+std::string_view ConvolutionFilter::getName() const {
+    return "Convolution";
+}
+
+std::unique_ptr<FilterStrategy> ConvolutionFilter::clone() const {
+    return std::make_unique<ConvolutionFilter>(m_kernel, m_kernelWidth, m_kernelHeight, m_method);
+}
+
+}  // namespace DIPAL
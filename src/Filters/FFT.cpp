@@ -0,0 +1,453 @@
+// src/Filters/FFT.cpp
+#include "../../include/DIPAL/Filters/FFT.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+
+namespace DIPAL {
+
+namespace {
+
+using Complex = FFTPlan::Complex;
+
+// Columns transformed together: 8 complex floats fill one 64-byte line of
+// every spectrum row they are gathered from
+constexpr int kColumnBlock = 8;
+
+// Plain complex product; std::complex's operator* also handles infinities
+// and NaNs, through a library call
+inline Complex mul(Complex a, Complex b) noexcept {
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+
+// v * -i
+inline Complex rotateNegative(Complex v) noexcept {
+    return {v.imag(), -v.real()};
+}
+
+// v * i
+inline Complex rotatePositive(Complex v) noexcept {
+    return {-v.imag(), v.real()};
+}
+
+Complex unitRoot(double turns) {
+    const double angle = -2.0 * std::numbers::pi * turns;
+    return {static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))};
+}
+
+// Forward DFTs of sizes 2 to 5, in place
+inline void butterfly(std::integral_constant<int, 2>, Complex* v) noexcept {
+    const Complex a = v[0];
+    v[0] = a + v[1];
+    v[1] = a - v[1];
+}
+
+inline void butterfly(std::integral_constant<int, 3>, Complex* v) noexcept {
+    constexpr float kSin = 0.86602540378443864676f;  // sin(2 pi / 3)
+    const Complex sum = v[1] + v[2];
+    const Complex difference = rotateNegative((v[1] - v[2]) * kSin);
+    const Complex middle = v[0] - sum * 0.5f;
+    v[0] += sum;
+    v[1] = middle + difference;
+    v[2] = middle - difference;
+}
+
+inline void butterfly(std::integral_constant<int, 4>, Complex* v) noexcept {
+    const Complex t0 = v[0] + v[2];
+    const Complex t1 = v[0] - v[2];
+    const Complex t2 = v[1] + v[3];
+    const Complex t3 = rotateNegative(v[1] - v[3]);
+    v[0] = t0 + t2;
+    v[1] = t1 + t3;
+    v[2] = t0 - t2;
+    v[3] = t1 - t3;
+}
+
+inline void butterfly(std::integral_constant<int, 5>, Complex* v) noexcept {
+    constexpr float kCos1 = 0.30901699437494742410f;   // cos(2 pi / 5)
+    constexpr float kCos2 = -0.80901699437494742410f;  // cos(4 pi / 5)
+    constexpr float kSin1 = 0.95105651629515357212f;   // sin(2 pi / 5)
+    constexpr float kSin2 = 0.58778525229247312917f;   // sin(4 pi / 5)
+    const Complex t1 = v[1] + v[4];
+    const Complex t2 = v[2] + v[3];
+    const Complex t3 = v[1] - v[4];
+    const Complex t4 = v[2] - v[3];
+    const Complex a1 = v[0] + t1 * kCos1 + t2 * kCos2;
+    const Complex a2 = v[0] + t1 * kCos2 + t2 * kCos1;
+    const Complex b1 = rotateNegative(t3 * kSin1 + t4 * kSin2);
+    const Complex b2 = rotateNegative(t3 * kSin2 - t4 * kSin1);
+    v[0] += t1 + t2;
+    v[1] = a1 + b1;
+    v[2] = a2 + b2;
+    v[3] = a2 - b2;
+    v[4] = a1 - b1;
+}
+
+}  // namespace
+
+// One 1D complex FFT length. Stage s of radix R combines R interleaved
+// sub-transforms of length span (the product of the earlier radices) into
+// transforms of length span * R, reading the input at stride n / R and
+// writing the output in natural order (Stockham autosort: no bit reversal).
+struct FFTPlan::Transform {
+    struct Stage {
+        int radix;
+        int span;
+        std::size_t twiddles;  // offset of span * (radix - 1) factors
+        std::size_t roots;     // offset of radix roots of unity, generic stages only
+    };
+
+    int length;
+    std::vector<Stage> stages;
+    std::vector<Complex> twiddles;
+    std::vector<Complex> roots;
+
+    explicit Transform(int n) : length(n) {
+        std::vector<int> radices;
+        int remaining = n;
+        while (remaining % 4 == 0) {
+            radices.push_back(4);
+            remaining /= 4;
+        }
+        for (int p : {2, 3, 5}) {
+            while (remaining % p == 0) {
+                radices.push_back(p);
+                remaining /= p;
+            }
+        }
+        for (int p = 7; p * p <= remaining; p += 2) {
+            while (remaining % p == 0) {
+                radices.push_back(p);
+                remaining /= p;
+            }
+        }
+        if (remaining > 1) {
+            radices.push_back(remaining);
+        }
+
+        int span = 1;
+        for (int radix : radices) {
+            stages.push_back({radix, span, twiddles.size(), roots.size()});
+            for (int k = 0; k < span; ++k) {
+                for (int r = 1; r < radix; ++r) {
+                    twiddles.push_back(unitRoot(static_cast<double>(r) * k / (span * radix)));
+                }
+            }
+            if (radix > 5) {
+                for (int q = 0; q < radix; ++q) {
+                    roots.push_back(unitRoot(static_cast<double>(q) / radix));
+                }
+            }
+            span *= radix;
+        }
+    }
+
+    // Forward transform of data[0, length); scratch holds length bins
+    void run(Complex* data, Complex* scratch) const {
+        Complex* in = data;
+        Complex* out = scratch;
+        for (const Stage& stage : stages) {
+            switch (stage.radix) {
+                case 2:
+                    pass<2>(stage, in, out);
+                    break;
+                case 3:
+                    pass<3>(stage, in, out);
+                    break;
+                case 4:
+                    pass<4>(stage, in, out);
+                    break;
+                case 5:
+                    pass<5>(stage, in, out);
+                    break;
+                default:
+                    genericPass(stage, in, out);
+                    break;
+            }
+            std::swap(in, out);
+        }
+        if (in != data) {
+            std::copy_n(in, length, data);
+        }
+    }
+
+    template <int R>
+    void pass(const Stage& stage, const Complex* in, Complex* out) const noexcept {
+        const int stride = length / R;
+        const int span = stage.span;
+        const Complex* factors = twiddles.data() + stage.twiddles;
+        for (int j0 = 0; j0 < stride; j0 += span) {
+            Complex* dst = out + static_cast<std::size_t>(j0) * R;
+            for (int k = 0; k < span; ++k) {
+                const Complex* src = in + j0 + k;
+                Complex v[R];
+                v[0] = src[0];
+                for (int r = 1; r < R; ++r) {
+                    v[r] = mul(src[r * stride], factors[k * (R - 1) + r - 1]);
+                }
+                butterfly(std::integral_constant<int, R>{}, v);
+                for (int r = 0; r < R; ++r) {
+                    dst[k + r * span] = v[r];
+                }
+            }
+        }
+    }
+
+    // Direct DFT of size R after the twiddles, for prime radices above 5
+    void genericPass(const Stage& stage, const Complex* in, Complex* out) const {
+        const int radix = stage.radix;
+        const int stride = length / radix;
+        const int span = stage.span;
+        const Complex* factors = twiddles.data() + stage.twiddles;
+        const Complex* unit = roots.data() + stage.roots;
+        std::vector<Complex> v(radix);
+        for (int j0 = 0; j0 < stride; j0 += span) {
+            Complex* dst = out + static_cast<std::size_t>(j0) * radix;
+            for (int k = 0; k < span; ++k) {
+                const Complex* src = in + j0 + k;
+                v[0] = src[0];
+                for (int r = 1; r < radix; ++r) {
+                    v[r] = mul(src[r * stride], factors[k * (radix - 1) + r - 1]);
+                }
+                for (int q = 0; q < radix; ++q) {
+                    Complex sum = v[0];
+                    for (int r = 1; r < radix; ++r) {
+                        sum += mul(v[r], unit[static_cast<std::size_t>(r) * q % radix]);
+                    }
+                    dst[k + q * span] = sum;
+                }
+            }
+        }
+    }
+};
+
+FFTPlan::FFTPlan(int width, int height)
+    : m_width(width),
+      m_height(height),
+      m_rows(std::make_unique<const Transform>(width % 2 == 0 ? width / 2 : width)),
+      m_columns(std::make_unique<const Transform>(height)) {
+    m_realTwiddles.resize(static_cast<std::size_t>(width / 2 + 1));
+    for (int k = 0; k <= width / 2; ++k) {
+        m_realTwiddles[k] = unitRoot(static_cast<double>(k) / width);
+    }
+}
+
+FFTPlan::~FFTPlan() = default;
+
+std::shared_ptr<const FFTPlan> FFTPlan::get(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument(
+            std::format("FFT size must be positive, got {}x{}", width, height));
+    }
+
+    static std::mutex mutex;
+    static std::map<std::pair<int, int>, std::shared_ptr<const FFTPlan>> plans;
+    const std::scoped_lock lock(mutex);
+    auto& plan = plans[{width, height}];
+    if (!plan) {
+        plan = std::shared_ptr<const FFTPlan>(new FFTPlan(width, height));
+    }
+    return plan;
+}
+
+int FFTPlan::goodSize(int n) {
+    for (int size = std::max(n, 2);; ++size) {
+        if (size % 2 != 0) {
+            continue;
+        }
+        int remaining = size;
+        for (int p : {2, 3, 5}) {
+            while (remaining % p == 0) {
+                remaining /= p;
+            }
+        }
+        if (remaining == 1) {
+            return size;
+        }
+    }
+}
+
+void FFTPlan::forwardRows(std::span<const float> image, std::span<Complex> spectrum, int y0,
+                          int y1) const {
+    const auto width = static_cast<std::size_t>(m_width);
+    const auto bins = static_cast<std::size_t>(getSpectrumWidth());
+    TemporaryBuffer<Complex> work(static_cast<std::size_t>(m_rows->length));
+    TemporaryBuffer<Complex> scratch(work.size());
+
+    for (int y = y0; y < y1; ++y) {
+        const float* x = image.data() + static_cast<std::size_t>(y) * width;
+        Complex* out = spectrum.data() + static_cast<std::size_t>(y) * bins;
+
+        if (m_width % 2 != 0) {
+            for (std::size_t k = 0; k < width; ++k) {
+                work[k] = {x[k], 0.0f};
+            }
+            m_rows->run(work.data(), scratch.data());
+            std::copy_n(work.data(), bins, out);
+            continue;
+        }
+
+        // Even samples as the real part, odd samples as the imaginary part.
+        // With Z the half-length transform, the even and odd halves are
+        // E = (Z[k] + conj(Z[n - k])) / 2 and O = (Z[k] - conj(Z[n - k])) / 2i,
+        // and the full spectrum is X[k] = E + exp(-2 pi i k / width) O.
+        const std::size_t n = width / 2;
+        for (std::size_t k = 0; k < n; ++k) {
+            work[k] = {x[2 * k], x[2 * k + 1]};
+        }
+        m_rows->run(work.data(), scratch.data());
+
+        out[0] = {work[0].real() + work[0].imag(), 0.0f};
+        out[n] = {work[0].real() - work[0].imag(), 0.0f};
+        for (std::size_t k = 1; k <= n / 2; ++k) {
+            const Complex z = work[k];
+            const Complex mirror = std::conj(work[n - k]);
+            const Complex even = (z + mirror) * 0.5f;
+            const Complex odd = rotateNegative((z - mirror) * 0.5f);
+            out[k] = even + mul(m_realTwiddles[k], odd);
+            out[n - k] = std::conj(even) + mul(m_realTwiddles[n - k], std::conj(odd));
+        }
+    }
+}
+
+void FFTPlan::inverseRows(std::span<const Complex> spectrum, std::span<float> image, int y0,
+                          int y1) const {
+    const auto width = static_cast<std::size_t>(m_width);
+    const auto bins = static_cast<std::size_t>(getSpectrumWidth());
+    const float scale = 1.0f / (static_cast<float>(m_width) * static_cast<float>(m_height));
+    TemporaryBuffer<Complex> work(static_cast<std::size_t>(m_rows->length));
+    TemporaryBuffer<Complex> scratch(work.size());
+
+    // The inverse transform is conj(FFT(conj(X)))
+    for (int y = y0; y < y1; ++y) {
+        const Complex* in = spectrum.data() + static_cast<std::size_t>(y) * bins;
+        float* x = image.data() + static_cast<std::size_t>(y) * width;
+
+        if (m_width % 2 != 0) {
+            for (std::size_t k = 0; k < width; ++k) {
+                work[k] = k < bins ? std::conj(in[k]) : in[width - k];
+            }
+            m_rows->run(work.data(), scratch.data());
+            for (std::size_t k = 0; k < width; ++k) {
+                x[k] = work[k].real() * scale;
+            }
+            continue;
+        }
+
+        // Undo the split of forwardRows: Z[k] = E + i O with E and O
+        // recovered from X[k] and conj(X[n - k]); both are doubled here,
+        // which the half-length inverse turns into the full-length scale
+        const std::size_t n = width / 2;
+        for (std::size_t k = 0; k < n; ++k) {
+            const Complex mirror = std::conj(in[n - k]);
+            const Complex even = in[k] + mirror;
+            const Complex odd = mul(in[k] - mirror, std::conj(m_realTwiddles[k]));
+            work[k] = std::conj(even + rotatePositive(odd));
+        }
+        m_rows->run(work.data(), scratch.data());
+        for (std::size_t k = 0; k < n; ++k) {
+            x[2 * k] = work[k].real() * scale;
+            x[2 * k + 1] = -work[k].imag() * scale;
+        }
+    }
+}
+
+void FFTPlan::columns(std::span<Complex> spectrum, bool inverse, int block0, int block1) const {
+    const auto height = static_cast<std::size_t>(m_height);
+    const auto bins = static_cast<std::size_t>(getSpectrumWidth());
+    TemporaryBuffer<Complex> block(height * kColumnBlock);
+    TemporaryBuffer<Complex> scratch(height);
+
+    for (int b = block0; b < block1; ++b) {
+        const std::size_t first = static_cast<std::size_t>(b) * kColumnBlock;
+        const std::size_t count = std::min<std::size_t>(kColumnBlock, bins - first);
+
+        for (std::size_t y = 0; y < height; ++y) {
+            const Complex* row = spectrum.data() + y * bins + first;
+            for (std::size_t c = 0; c < count; ++c) {
+                block[c * height + y] = inverse ? std::conj(row[c]) : row[c];
+            }
+        }
+        for (std::size_t c = 0; c < count; ++c) {
+            m_columns->run(block.data() + c * height, scratch.data());
+        }
+        for (std::size_t y = 0; y < height; ++y) {
+            Complex* row = spectrum.data() + y * bins + first;
+            for (std::size_t c = 0; c < count; ++c) {
+                row[c] = inverse ? std::conj(block[c * height + y]) : block[c * height + y];
+            }
+        }
+    }
+}
+
+namespace {
+
+// Splits count items among the pool's workers
+template <typename Fn>
+void forEachRange(ThreadPool* pool, int count, Fn&& fn) {
+    const std::size_t parts =
+        std::min(pool ? pool->getThreadCount() : 1, static_cast<std::size_t>(count));
+    forEachPart(pool, parts, [&](std::size_t part) {
+        const auto [first, last] = partitionRange(static_cast<std::size_t>(count), parts, part);
+        fn(static_cast<int>(first), static_cast<int>(last));
+    });
+}
+
+}  // namespace
+
+VoidResult FFTPlan::forward(std::span<const float> image, std::span<Complex> spectrum,
+                            ThreadPool* pool) const {
+    const auto pixels = static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_height);
+    const auto bins = static_cast<std::size_t>(getSpectrumWidth()) * static_cast<std::size_t>(m_height);
+    if (image.size() != pixels || spectrum.size() != bins) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("FFT of {}x{} needs {} samples and {} bins, got {} and {}", m_width,
+                        m_height, pixels, bins, image.size(), spectrum.size()));
+    }
+
+    try {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        forEachRange(pool, m_height, [&](int y0, int y1) { forwardRows(image, spectrum, y0, y1); });
+        const int blocks = (getSpectrumWidth() + kColumnBlock - 1) / kColumnBlock;
+        forEachRange(pool, blocks, [&](int b0, int b1) { columns(spectrum, false, b0, b1); });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Forward FFT failed: {}", e.what()));
+    }
+}
+
+VoidResult FFTPlan::inverse(std::span<Complex> spectrum, std::span<float> image,
+                            ThreadPool* pool) const {
+    const auto pixels = static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_height);
+    const auto bins = static_cast<std::size_t>(getSpectrumWidth()) * static_cast<std::size_t>(m_height);
+    if (image.size() != pixels || spectrum.size() != bins) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("FFT of {}x{} needs {} samples and {} bins, got {} and {}", m_width,
+                        m_height, pixels, bins, image.size(), spectrum.size()));
+    }
+
+    try {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        const int blocks = (getSpectrumWidth() + kColumnBlock - 1) / kColumnBlock;
+        forEachRange(pool, blocks, [&](int b0, int b1) { columns(spectrum, true, b0, b1); });
+        forEachRange(pool, m_height, [&](int y0, int y1) { inverseRows(spectrum, image, y0, y1); });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Inverse FFT failed: {}", e.what()));
+    }
+}
+
+}  // namespace DIPAL
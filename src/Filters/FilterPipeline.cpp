@@ -0,0 +1,320 @@
+// src/Filters/FilterPipeline.cpp
+#include "../../include/DIPAL/Filters/FilterPipeline.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <format>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+
+namespace DIPAL {
+
+namespace {
+
+using Stages = std::span<const std::unique_ptr<FilterStrategy>>;
+
+// Automatic tiles are never smaller than this, however large the halo
+constexpr int kMinTileSide = 32;
+
+FilterFootprint combine(const FilterFootprint& a, const FilterFootprint& b) {
+    return {a.left + b.left, a.top + b.top, a.right + b.right, a.bottom + b.bottom,
+            a.local && b.local};
+}
+
+// The rect grown by a footprint, clipped to a width x height image
+Rect grow(const Rect& rect, const FilterFootprint& footprint, int width, int height) {
+    const int x0 = std::max(rect.x - footprint.left, 0);
+    const int y0 = std::max(rect.y - footprint.top, 0);
+    const int x1 = std::min(rect.x + rect.width + footprint.right, width);
+    const int y1 = std::min(rect.y + rect.height + footprint.bottom, height);
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+// Output format of every stage, which a stage may change (Sobel turns
+// color into grayscale)
+std::vector<ImageFormat> stageFormats(Stages stages, const ImageView& source) {
+    std::vector<ImageFormat> formats;
+    formats.reserve(stages.size());
+    ImageFormat format{source.getType(), source.getDepth()};
+    for (const auto& stage : stages) {
+        format = stage->getOutputFormat(format.type, format.depth);
+        formats.push_back(format);
+    }
+    return formats;
+}
+
+// Runs the stages on one output tile, writing it into destination. Stage i
+// reads region i, which is the tile grown by the footprints of stages i to
+// n - 1, and computes region i + 1 with applyTile(); the intermediate
+// regions go into the scratch images, which are grown as needed and reused
+// from tile to tile.
+VoidResult filterTile(Stages stages,
+                      const ImageView& source,
+                      const Rect& tile,
+                      std::span<const ImageFormat> formats,
+                      std::vector<std::unique_ptr<Image>>& scratch,
+                      const MutableImageView& destination) {
+    std::vector<Rect> regions(stages.size() + 1);
+    regions.back() = tile;
+    for (std::size_t i = stages.size(); i-- > 0;) {
+        regions[i] = grow(regions[i + 1], stages[i]->getFootprint(), source.getWidth(),
+                          source.getHeight());
+    }
+    scratch.resize(stages.size() - 1);
+
+    auto first = source.crop(regions.front());
+    if (!first) {
+        return makeVoidErrorResult(first.error().code(), first.error().message());
+    }
+    ImageView input = first.value();
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        const Rect& next = regions[i + 1];
+        const Rect interior(next.x - regions[i].x, next.y - regions[i].y, next.width, next.height);
+
+        MutableImageView output = destination;
+        if (i + 1 < stages.size()) {
+            auto& image = scratch[i];
+            if (!image || image->getWidth() < next.width || image->getHeight() < next.height) {
+                const int width = std::max(next.width, image ? image->getWidth() : 0);
+                const int height = std::max(next.height, image ? image->getHeight() : 0);
+                auto created =
+                    ImageFactory::create(width, height, formats[i].type, formats[i].depth);
+                if (!created) {
+                    return makeVoidErrorResult(created.error().code(), created.error().message());
+                }
+                image = std::move(created.value());
+            }
+            auto region = image->mutableView().crop(Rect(0, 0, next.width, next.height));
+            if (!region) {
+                return makeVoidErrorResult(region.error().code(), region.error().message());
+            }
+            output = region.value();
+        }
+
+        if (auto status = stages[i]->applyTile(input, interior, output); !status) {
+            return makeVoidErrorResult(
+                status.error().code(),
+                std::format("Stage '{}' failed: {}", stages[i]->getName(), status.error().message()));
+        }
+        input = output;
+    }
+    return makeVoidSuccessResult();
+}
+
+// Side of a square tile whose haloed region holds about kTileBytes
+int autoTileSide(int bytesPerPixel, const FilterFootprint& footprint) {
+    const double pixels = static_cast<double>(FilterPipeline::kTileBytes) / bytesPerPixel;
+    const int halo = std::max(footprint.left + footprint.right, footprint.top + footprint.bottom);
+    return std::max(static_cast<int>(std::sqrt(pixels)) - halo, kMinTileSide);
+}
+
+// Runs a chain of local stages tile by tile
+Result<std::unique_ptr<Image>> runFused(Stages stages,
+                                        const ImageView& source,
+                                        int tileWidth,
+                                        int tileHeight) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    if (tileWidth == 0 || tileHeight == 0) {
+        FilterFootprint footprint;
+        for (const auto& stage : stages) {
+            footprint = combine(footprint, stage->getFootprint());
+        }
+        const int side = autoTileSide(source.getBytesPerPixel(), footprint);
+        tileWidth = tileWidth == 0 ? side : tileWidth;
+        tileHeight = tileHeight == 0 ? side : tileHeight;
+    }
+    tileWidth = std::min(tileWidth, width);
+    tileHeight = std::min(tileHeight, height);
+
+    const int columns = (width + tileWidth - 1) / tileWidth;
+    const auto count = static_cast<std::size_t>(columns) *
+                       static_cast<std::size_t>((height + tileHeight - 1) / tileHeight);
+    const auto tileAt = [&](std::size_t index) {
+        const int x = static_cast<int>(index % columns) * tileWidth;
+        const int y = static_cast<int>(index / columns) * tileHeight;
+        return Rect(x, y, std::min(tileWidth, width - x), std::min(tileHeight, height - y));
+    };
+
+    const std::vector<ImageFormat> formats = stageFormats(stages, source);
+    auto created = ImageFactory::create(width, height, formats.back().type, formats.back().depth);
+    if (!created) {
+        return created;
+    }
+    auto result = std::move(created.value());
+    const MutableImageView destination = result->mutableView();
+
+    std::mutex failureMutex;
+    VoidResult failure = makeVoidSuccessResult();
+    std::atomic<bool> failed{false};
+    const auto fail = [&](VoidResult status) {
+        const std::scoped_lock lock(failureMutex);
+        if (!failed.exchange(true)) {
+            failure = std::move(status);
+        }
+    };
+
+    // Workers take the tiles in order, so neighbouring tiles, whose halos
+    // overlap, are filtered at about the same time. Each writes its tiles
+    // straight into the result.
+    ThreadPool* workers = sharedPoolFor(static_cast<std::size_t>(width) * height);
+    const std::size_t parts = std::min(workers ? workers->getThreadCount() : 1, count);
+    std::atomic<std::size_t> next{0};
+    forEachPart(workers, parts, [&](std::size_t) {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        std::vector<std::unique_ptr<Image>> intermediates;
+        for (std::size_t index = next++; index < count && !failed; index = next++) {
+            const Rect tile = tileAt(index);
+            auto target = destination.crop(tile);
+            auto status = !target ? makeVoidErrorResult(target.error().code(),
+                                                        target.error().message())
+                                  : filterTile(stages, source, tile, formats, intermediates,
+                                               target.value());
+            if (!status) {
+                fail(std::move(status));
+                break;
+            }
+        }
+    });
+
+    if (failed) {
+        return makeErrorResult<std::unique_ptr<Image>>(failure.error().code(),
+                                                       failure.error().message());
+    }
+    return makeSuccessResult(std::move(result));
+}
+
+}  // namespace
+
+FilterPipeline::FilterPipeline(std::vector<std::unique_ptr<FilterStrategy>> stages) {
+    for (auto& stage : stages) {
+        addStage(std::move(stage));
+    }
+}
+
+FilterPipeline& FilterPipeline::addStage(std::unique_ptr<FilterStrategy> stage) {
+    if (!stage) {
+        throw std::invalid_argument("Pipeline stage cannot be null");
+    }
+    m_stages.push_back(std::move(stage));
+    return *this;
+}
+
+Result<std::unique_ptr<Image>> FilterPipeline::apply(const Image& image) const {
+    return apply(image.view());
+}
+
+Result<std::unique_ptr<Image>> FilterPipeline::apply(const ImageView& view) const {
+    if (m_stages.empty()) {
+        return view.toImage();
+    }
+    if (view.isEmpty()) {
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
+                                                       "Cannot apply filter to an empty image");
+    }
+
+    try {
+        // Split the chain at every stage that needs the whole image; the
+        // local runs in between are fused
+        std::unique_ptr<Image> current;
+        ImageView input = view;
+        for (std::size_t first = 0; first < m_stages.size();) {
+            std::size_t last = first + 1;
+            if (m_stages[first]->getFootprint().local) {
+                while (last < m_stages.size() && m_stages[last]->getFootprint().local) {
+                    ++last;
+                }
+            }
+
+            auto output = last - first == 1
+                              ? m_stages[first]->apply(input)
+                              : runFused(Stages(m_stages).subspan(first, last - first), input,
+                                         m_tileWidth, m_tileHeight);
+            if (!output) {
+                return output;
+            }
+            current = std::move(output.value());
+            input = current->view();
+            first = last;
+        }
+        return makeSuccessResult(std::move(current));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::ProcessingFailed, std::format("Filter pipeline failed: {}", e.what()));
+    }
+}
+
+VoidResult FilterPipeline::applyTile(const ImageView& source,
+                                     const Rect& tile,
+                                     const MutableImageView& destination) const {
+    if (m_stages.empty() || !getFootprint().local) {
+        return FilterStrategy::applyTile(source, tile, destination);
+    }
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+
+    try {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        std::vector<std::unique_ptr<Image>> intermediates;
+        return filterTile(m_stages, source, tile, stageFormats(m_stages, source), intermediates,
+                          destination);
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Filter pipeline failed: {}", e.what()));
+    }
+}
+
+FilterFootprint FilterPipeline::getFootprint() const {
+    FilterFootprint footprint;
+    for (const auto& stage : m_stages) {
+        footprint = combine(footprint, stage->getFootprint());
+    }
+    return footprint;
+}
+
+ImageFormat FilterPipeline::getOutputFormat(Image::Type type, Image::Depth depth) const {
+    ImageFormat format{type, depth};
+    for (const auto& stage : m_stages) {
+        format = stage->getOutputFormat(format.type, format.depth);
+    }
+    return format;
+}
+
+std::string_view FilterPipeline::getName() const {
+    return "FilterPipeline";
+}
+
+std::unique_ptr<FilterStrategy> FilterPipeline::clone() const {
+    auto copy = std::make_unique<FilterPipeline>();
+    for (const auto& stage : m_stages) {
+        copy->addStage(stage->clone());
+    }
+    copy->setTileSize(m_tileWidth, m_tileHeight);
+    return copy;
+}
+
+void FilterPipeline::setTileSize(int width, int height) {
+    if (width < 0 || height < 0) {
+        throw std::invalid_argument(
+            std::format("Tile size cannot be negative, got {}x{}", width, height));
+    }
+    m_tileWidth = width;
+    m_tileHeight = height;
+}
+
+const FilterStrategy& FilterPipeline::getStage(std::size_t index) const {
+    if (index >= m_stages.size()) {
+        throw std::out_of_range(
+            std::format("Pipeline has {} stages, no stage {}", m_stages.size(), index));
+    }
+    return *m_stages[index];
+}
+
+}  // namespace DIPAL
@@ -0,0 +1,80 @@
+// src/Filters/FilterStrategy.cpp
+#include "../../include/DIPAL/Filters/FilterStrategy.hpp"
+
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+
+#include <format>
+
+namespace DIPAL {
+
+Result<std::unique_ptr<Image>> FilterStrategy::apply(const ImageView& view) const {
+    auto imageResult = view.toImage();
+    if (!imageResult) {
+        return imageResult;
+    }
+    return apply(*imageResult.value());
+}
+
+VoidResult FilterStrategy::applyTo(const ImageView& source,
+                                   const MutableImageView& destination) const {
+    auto result = apply(source);
+    if (!result) {
+        return makeVoidErrorResult(result.error().code(), result.error().message());
+    }
+    return destination.copyFrom(result.value()->view());
+}
+
+FilterFootprint FilterStrategy::getFootprint() const {
+    return {};
+}
+
+ImageFormat FilterStrategy::getOutputFormat(Image::Type type, Image::Depth depth) const {
+    return {type, depth};
+}
+
+VoidResult FilterStrategy::applyTile(const ImageView& source,
+                                     const Rect& tile,
+                                     const MutableImageView& destination) const {
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+    auto result = apply(source);
+    if (!result) {
+        return makeVoidErrorResult(result.error().code(), result.error().message());
+    }
+    auto pixels = result.value()->view().crop(tile);
+    if (!pixels) {
+        return makeVoidErrorResult(pixels.error().code(), pixels.error().message());
+    }
+    return destination.copyFrom(pixels.value());
+}
+
+VoidResult FilterStrategy::validateTile(const ImageView& source,
+                                        const Rect& tile,
+                                        const MutableImageView& destination) {
+    if (tile.x < 0 || tile.y < 0 || tile.width <= 0 || tile.height <= 0 ||
+        tile.x + tile.width > source.getWidth() || tile.y + tile.height > source.getHeight()) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("Tile ({}, {}) {}x{} is not inside the {}x{} source", tile.x, tile.y,
+                        tile.width, tile.height, source.getWidth(), source.getHeight()));
+    }
+    if (destination.getWidth() != tile.width || destination.getHeight() != tile.height) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("Tile destination is {}x{}, expected {}x{}", destination.getWidth(),
+                        destination.getHeight(), tile.width, tile.height));
+    }
+    return makeVoidSuccessResult();
+}
+
+Result<std::unique_ptr<Image>> createFilterOutput(const FilterStrategy& filter,
+                                                  const ImageView& source,
+                                                  int width,
+                                                  int height,
+                                                  Image::RowLayout layout) {
+    const ImageFormat format = filter.getOutputFormat(source.getType(), source.getDepth());
+    return ImageFactory::create(width, height, format.type, format.depth, layout);
+}
+
+}  // namespace DIPAL
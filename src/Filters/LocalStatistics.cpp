@@ -0,0 +1,152 @@
+// src/Filters/LocalStatistics.cpp
+#include "../../include/DIPAL/Filters/LocalStatistics.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/IntegralImage.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace DIPAL {
+
+namespace {
+
+// Writes the window means and/or variances of every pixel; either output may be null
+template <typename Sum>
+void computeMoments(const ImageView& view, int radius, ThreadPool* pool, Image* mean,
+                    Image* variance) {
+    const int width = view.getWidth();
+    const int height = view.getHeight();
+    const std::size_t samples =
+        static_cast<std::size_t>(width) * static_cast<std::size_t>(view.getChannels());
+    const auto channels = static_cast<std::size_t>(view.getChannels());
+
+    ThreadPool* workers =
+        pool ? pool
+             : sharedPoolFor(static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    auto table = IntegralImage<Sum>::compute(view, variance != nullptr, workers);
+    if (!table) {
+        throw std::runtime_error(std::string(table.error().message()));
+    }
+
+    const MutableImageView meanView = mean ? mean->mutableView() : MutableImageView();
+    const MutableImageView varianceView = variance ? variance->mutableView() : MutableImageView();
+    const std::size_t parts =
+        std::min(workers ? workers->getThreadCount() : 1, static_cast<std::size_t>(height));
+    forEachPart(workers, parts, [&](std::size_t part) {
+        const auto [y0, y1] = partitionRange(static_cast<std::size_t>(height), parts, part);
+        TemporaryBuffer<Sum> sums(samples);
+        TemporaryBuffer<Sum> squares(variance ? samples : 0);
+        for (auto y = static_cast<int>(y0); y < static_cast<int>(y1); ++y) {
+            table.value().windowSums(y, radius, sums, squares);
+            const int rows = std::min(height, y + radius + 1) - std::max(0, y - radius);
+            float* meanRow = mean ? MutablePixelAccessor<float>(meanView).row(y) : nullptr;
+            float* varianceRow = variance ? MutablePixelAccessor<float>(varianceView).row(y) : nullptr;
+            for (int x = 0; x < width; ++x) {
+                const int columns = std::min(width, x + radius + 1) - std::max(0, x - radius);
+                const double area = static_cast<double>(rows) * columns;
+                for (std::size_t c = 0; c < channels; ++c) {
+                    const std::size_t i = x * channels + c;
+                    const auto sum = static_cast<double>(sums[i]);
+                    const double m = sum / area;
+                    if (meanRow) {
+                        meanRow[i] = static_cast<float>(m);
+                    }
+                    if (varianceRow) {
+                        // (sum of x^2 - sum * mean) / n is exact for flat windows of
+                        // integers, and clamped in case rounding leaves it below zero
+                        const double v = (static_cast<double>(squares[i]) - sum * m) / area;
+                        varianceRow[i] = static_cast<float>(std::max(v, 0.0));
+                    }
+                }
+            }
+        }
+    });
+}
+
+Result<LocalStatistics::Moments> run(const ImageView& view, int radius, ThreadPool* pool,
+                                     bool wantMean, bool wantVariance) {
+    if (view.getType() != Image::Type::Grayscale && view.getType() != Image::Type::RGB &&
+        view.getType() != Image::Type::RGBA) {
+        return makeErrorResult<LocalStatistics::Moments>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type for local statistics: {}",
+                        static_cast<int>(view.getType())));
+    }
+    if (view.isEmpty()) {
+        return makeErrorResult<LocalStatistics::Moments>(
+            ErrorCode::InvalidParameter, "Cannot compute statistics of an empty image");
+    }
+    if (radius < 0) {
+        return makeErrorResult<LocalStatistics::Moments>(
+            ErrorCode::InvalidParameter, std::format("Radius must not be negative, got {}", radius));
+    }
+
+    try {
+        LocalStatistics::Moments moments;
+        for (auto [wanted, target] : {std::pair{wantMean, &moments.mean},
+                                      std::pair{wantVariance, &moments.variance}}) {
+            if (!wanted) {
+                continue;
+            }
+            auto image = ImageFactory::create(view.getWidth(), view.getHeight(), view.getType(),
+                                              Image::Depth::Float32);
+            if (!image) {
+                return makeErrorResult<LocalStatistics::Moments>(image.error().code(),
+                                                                 image.error().message());
+            }
+            *target = std::move(image.value());
+        }
+
+        // Windows wider than the image are clipped to it anyway
+        radius = std::min(radius, std::max(view.getWidth(), view.getHeight()));
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        // 64-bit sums of squared 16-bit samples are exact for windows below 2^32 pixels
+        if (view.getDepth() == Image::Depth::Float32) {
+            computeMoments<double>(view, radius, pool, moments.mean.get(), moments.variance.get());
+        } else {
+            computeMoments<uint64_t>(view, radius, pool, moments.mean.get(), moments.variance.get());
+        }
+        return makeSuccessResult(std::move(moments));
+    } catch (const std::exception& e) {
+        return makeErrorResult<LocalStatistics::Moments>(
+            ErrorCode::ProcessingFailed, std::format("Local statistics failed: {}", e.what()));
+    }
+}
+
+}  // namespace
+
+Result<std::unique_ptr<Image>> LocalStatistics::mean(const ImageView& view, int radius,
+                                                     ThreadPool* pool) {
+    auto moments = run(view, radius, pool, true, false);
+    if (!moments) {
+        return makeErrorResult<std::unique_ptr<Image>>(moments.error().code(),
+                                                       moments.error().message());
+    }
+    return makeSuccessResult(std::move(moments.value().mean));
+}
+
+Result<std::unique_ptr<Image>> LocalStatistics::variance(const ImageView& view, int radius,
+                                                         ThreadPool* pool) {
+    auto moments = run(view, radius, pool, false, true);
+    if (!moments) {
+        return makeErrorResult<std::unique_ptr<Image>>(moments.error().code(),
+                                                       moments.error().message());
+    }
+    return makeSuccessResult(std::move(moments.value().variance));
+}
+
+Result<LocalStatistics::Moments> LocalStatistics::meanAndVariance(const ImageView& view,
+                                                                  int radius,
+                                                                  ThreadPool* pool) {
+    return run(view, radius, pool, true, true);
+}
+
+}  // namespace DIPAL
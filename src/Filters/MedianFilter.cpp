@@ -1,15 +1,496 @@
 // src/Filters/MedianFilter.cpp
 #include "../../include/DIPAL/Filters/MedianFilter.hpp"
-#include "../../include/DIPAL/Image/GrayscaleImage.hpp"
-#include "../../include/DIPAL/Image/ColorImage.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/PlanarImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <stdexcept>
 #include <format>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace DIPAL {
 
+namespace {
+
+// A median costs tens of comparisons per sample, far more than the simple
+// filters kParallelPixels is tuned for, so threads pay off on smaller images
+constexpr std::size_t kMedianParallelPixels = std::size_t{1} << 16;
+
+// Per-channel median over a square window with replicated borders, for
+// source rows [y0, y1) of the tile: gathers every window and selects its
+// middle element. The destination holds the tile alone.
+template <typename T>
+void selectionMedian(const PixelAccessor<T>& src, const MutablePixelAccessor<T>& dst,
+                     int kernelSize, const Rect& tile, int y0, int y1) {
+    const int width = src.width();
+    const int channels = src.channels();
+    const int radius = kernelSize / 2;
+    
+    // Row pointers of the current window, with the border rows replicated
+    std::vector<const T*> rows(kernelSize);
+    std::vector<T> neighborhood(kernelSize * kernelSize);
+    const auto middle = neighborhood.begin() + neighborhood.size() / 2;
+    
+    for (int y = y0; y < y1; ++y) {
+        for (int ky = -radius; ky <= radius; ++ky) {
+            rows[ky + radius] = src.clampedRow(y + ky);
+        }
+        
+        T* dstRow = dst.row(y - tile.y);
+        for (int x = tile.x; x < tile.x + tile.width; ++x) {
+            for (int c = 0; c < channels; ++c) {
+                // Gather the neighborhood of this channel
+                size_t idx = 0;
+                for (const T* row : rows) {
+                    for (int kx = -radius; kx <= radius; ++kx) {
+                        int nx = std::clamp(x + kx, 0, width - 1);
+                        neighborhood[idx++] = row[nx * channels + c];
+                    }
+                }
+                
+                // Find median value
+                std::nth_element(neighborhood.begin(), middle, neighborhood.end());
+                dstRow[(x - tile.x) * channels + c] = *middle;
+            }
+        }
+    }
+}
+
+// Histogram levels of the 8-bit median: 16 coarse bins of 16 fine bins each
+constexpr int kFineBins = 256;
+constexpr int kCoarseBins = 16;
+constexpr int kSegment = kFineBins / kCoarseBins;
+
+// Largest kernel whose column counts fit the 16-bit column histograms
+constexpr int kMaxHistogramKernel = 65535;
+
+// dst += src over one coarse bin's fine segment; vectorized by the compiler
+inline void addSegment(uint32_t* dst, const uint16_t* src) noexcept {
+    for (int i = 0; i < kSegment; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+inline void subtractSegment(uint32_t* dst, const uint16_t* src) noexcept {
+    for (int i = 0; i < kSegment; ++i) {
+        dst[i] -= src[i];
+    }
+}
+
+// Median of a single-channel 8-bit image over source rows [y0, y1) of the
+// tile, after
+// Perreault and Hebert, "Median Filtering in Constant Time" (2007).
+//
+// Every column keeps a histogram of the kernelSize pixels above and below
+// the current row, updated by one removal and one insertion per row. The
+// window histogram is the sum of kernelSize column histograms and slides
+// right by adding one column and subtracting another. Both are two-level:
+// the coarse level (16 bins) is kept current at every step and locates the
+// median's coarse bin; only that bin's 16 fine counts are then brought up
+// to date, lazily, from the column histograms that entered and left the
+// window since they were last used. The work per pixel does not depend on
+// the kernel size.
+void histogramMedian(const PixelAccessor<uint8_t>& src, const MutablePixelAccessor<uint8_t>& dst,
+                     int kernelSize, const Rect& tile, int y0, int y1) {
+    const int width = src.width();
+    const int radius = kernelSize / 2;
+    const auto columnCount = static_cast<std::size_t>(width);
+    const auto column = [width](int x) { return static_cast<std::size_t>(std::clamp(x, 0, width - 1)); };
+
+    TemporaryBuffer<uint16_t> columnFine(columnCount * kFineBins);
+    TemporaryBuffer<uint16_t> columnCoarse(columnCount * kCoarseBins);
+    const auto insertRow = [&](const uint8_t* row) {
+        for (std::size_t x = 0; x < columnCount; ++x) {
+            ++columnFine[x * kFineBins + row[x]];
+            ++columnCoarse[x * kCoarseBins + (row[x] >> 4)];
+        }
+    };
+    const auto removeRow = [&](const uint8_t* row) {
+        for (std::size_t x = 0; x < columnCount; ++x) {
+            --columnFine[x * kFineBins + row[x]];
+            --columnCoarse[x * kCoarseBins + (row[x] >> 4)];
+        }
+    };
+
+    // Rank of the median among the kernelSize^2 window samples (an odd count)
+    const auto target = static_cast<uint32_t>(
+        static_cast<uint64_t>(kernelSize) * static_cast<uint64_t>(kernelSize) / 2);
+
+    std::array<uint32_t, kCoarseBins> coarse{};
+    std::array<uint32_t, kFineBins> fine{};
+    // Window centre for which each fine segment is current; kStale forces a rebuild
+    constexpr int kStale = std::numeric_limits<int>::min();
+    std::array<int, kCoarseBins> current{};
+
+    for (int ky = -radius; ky <= radius; ++ky) {
+        insertRow(src.clampedRow(y0 + ky));
+    }
+
+    for (int y = y0; y < y1; ++y) {
+        if (y > y0) {
+            removeRow(src.clampedRow(y - radius - 1));
+            insertRow(src.clampedRow(y + radius));
+        }
+
+        coarse.fill(0);
+        for (int i = tile.x - radius; i <= tile.x + radius; ++i) {
+            const uint16_t* counts = columnCoarse.data() + column(i) * kCoarseBins;
+            for (int b = 0; b < kCoarseBins; ++b) {
+                coarse[b] += counts[b];
+            }
+        }
+        current.fill(kStale);
+
+        uint8_t* out = dst.row(y - tile.y);
+        for (int x = tile.x; x < tile.x + tile.width; ++x) {
+            uint32_t below = 0;
+            int bin = 0;
+            while (below + coarse[bin] <= target) {
+                below += coarse[bin];
+                ++bin;
+            }
+
+            uint32_t* segment = fine.data() + bin * kSegment;
+            const std::size_t offset = static_cast<std::size_t>(bin) * kSegment;
+            if (current[bin] != x) {
+                // Replaying the columns that entered and left since the last
+                // use costs two updates per step; rebuilding costs kernelSize
+                if (current[bin] == kStale || 2 * (x - current[bin]) > kernelSize) {
+                    std::fill_n(segment, kSegment, 0u);
+                    for (int i = x - radius; i <= x + radius; ++i) {
+                        addSegment(segment, columnFine.data() + column(i) * kFineBins + offset);
+                    }
+                } else {
+                    for (int s = current[bin] + 1; s <= x; ++s) {
+                        addSegment(segment, columnFine.data() + column(s + radius) * kFineBins + offset);
+                        subtractSegment(segment,
+                                        columnFine.data() + column(s - radius - 1) * kFineBins + offset);
+                    }
+                }
+                current[bin] = x;
+            }
+
+            int value = 0;
+            while (below + segment[value] <= target) {
+                below += segment[value];
+                ++value;
+            }
+            out[x - tile.x] = static_cast<uint8_t>(bin * kSegment + value);
+
+            const uint16_t* entering = columnCoarse.data() + column(x + radius + 1) * kCoarseBins;
+            const uint16_t* leaving = columnCoarse.data() + column(x - radius) * kCoarseBins;
+            for (int b = 0; b < kCoarseBins; ++b) {
+                coarse[b] += entering[b];
+                coarse[b] -= leaving[b];
+            }
+        }
+    }
+}
+
+// One step of a selection network: an exchange leaves the minimum of two
+// wires on the first and the maximum on the second; when only one of them
+// is read later, the other half is dropped
+struct Comparator {
+    enum Kind : uint8_t { Exchange, MinOnly, MaxOnly };
+    uint8_t low;
+    uint8_t high;
+    Kind kind;
+};
+
+template <std::size_t N>
+struct SelectionNetwork {
+    std::array<Comparator, 256> steps{};
+    std::size_t size = 0;
+};
+
+// Network leaving the median of N inputs on wire N / 2: Batcher's odd-even
+// merge sort, pruned back from that wire to the comparators it depends on
+template <std::size_t N>
+consteval SelectionNetwork<N> makeMedianNetwork() {
+    // Wires past N would hold +infinity and never move, so comparators
+    // touching them are left out
+    std::array<Comparator, 512> sorting{};
+    std::size_t count = 0;
+    for (std::size_t p = 1; p < N; p <<= 1) {
+        for (std::size_t k = p; k >= 1; k >>= 1) {
+            for (std::size_t j = k % p; j + k < N; j += 2 * k) {
+                for (std::size_t i = 0; i < k && i + j + k < N; ++i) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        sorting[count++] = {static_cast<uint8_t>(i + j),
+                                            static_cast<uint8_t>(i + j + k), Comparator::Exchange};
+                    }
+                }
+            }
+        }
+    }
+
+    std::array<bool, N> needed{};
+    needed[N / 2] = true;
+    std::array<Comparator, 512> kept{};
+    std::size_t keptCount = 0;
+    for (std::size_t s = count; s-- > 0;) {
+        Comparator step = sorting[s];
+        const bool low = needed[step.low];
+        const bool high = needed[step.high];
+        if (!low && !high) {
+            continue;
+        }
+        step.kind = low && high ? Comparator::Exchange : low ? Comparator::MinOnly : Comparator::MaxOnly;
+        needed[step.low] = needed[step.high] = true;
+        kept[keptCount++] = step;
+    }
+
+    SelectionNetwork<N> network;
+    for (std::size_t s = 0; s < keptCount; ++s) {
+        network.steps[s] = kept[keptCount - 1 - s];
+    }
+    network.size = keptCount;
+    return network;
+}
+
+template <std::size_t N>
+inline constexpr SelectionNetwork<N> kMedianNetwork = makeMedianNetwork<N>();
+
+// One sample per register; the compiler turns std::min and std::max into
+// conditional moves, so the network has no data-dependent branches
+template <typename T>
+struct ScalarLanes {
+    using Register = T;
+    static constexpr std::size_t kCount = 1;
+    static Register load(const T* p) noexcept { return *p; }
+    static void store(T* p, Register v) noexcept { *p = v; }
+    static Register min(Register a, Register b) noexcept { return std::min(a, b); }
+    static Register max(Register a, Register b) noexcept { return std::max(a, b); }
+};
+
+// As many samples per register as the target's vector width holds
+template <typename T>
+struct SimdLanes : ScalarLanes<T> {};
+
+#if defined(__AVX2__)
+template <>
+struct SimdLanes<uint8_t> {
+    using Register = __m256i;
+    static constexpr std::size_t kCount = 32;
+    static Register load(const uint8_t* p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    static void store(uint8_t* p, Register v) noexcept {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    static Register min(Register a, Register b) noexcept { return _mm256_min_epu8(a, b); }
+    static Register max(Register a, Register b) noexcept { return _mm256_max_epu8(a, b); }
+};
+
+template <>
+struct SimdLanes<uint16_t> {
+    using Register = __m256i;
+    static constexpr std::size_t kCount = 16;
+    static Register load(const uint16_t* p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    static void store(uint16_t* p, Register v) noexcept {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    static Register min(Register a, Register b) noexcept { return _mm256_min_epu16(a, b); }
+    static Register max(Register a, Register b) noexcept { return _mm256_max_epu16(a, b); }
+};
+
+template <>
+struct SimdLanes<float> {
+    using Register = __m256;
+    static constexpr std::size_t kCount = 8;
+    static Register load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static void store(float* p, Register v) noexcept { _mm256_storeu_ps(p, v); }
+    static Register min(Register a, Register b) noexcept { return _mm256_min_ps(a, b); }
+    static Register max(Register a, Register b) noexcept { return _mm256_max_ps(a, b); }
+};
+#elif defined(__SSE2__)
+template <>
+struct SimdLanes<uint8_t> {
+    using Register = __m128i;
+    static constexpr std::size_t kCount = 16;
+    static Register load(const uint8_t* p) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static void store(uint8_t* p, Register v) noexcept {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    static Register min(Register a, Register b) noexcept { return _mm_min_epu8(a, b); }
+    static Register max(Register a, Register b) noexcept { return _mm_max_epu8(a, b); }
+};
+
+// SSE2 only compares signed 16-bit lanes: samples are offset by 2^15 on
+// load and back on store, which preserves their order
+template <>
+struct SimdLanes<uint16_t> {
+    using Register = __m128i;
+    static constexpr std::size_t kCount = 8;
+    static Register load(const uint16_t* p) noexcept {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+                             _mm_set1_epi16(static_cast<short>(0x8000)));
+    }
+    static void store(uint16_t* p, Register v) noexcept {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                         _mm_xor_si128(v, _mm_set1_epi16(static_cast<short>(0x8000))));
+    }
+    static Register min(Register a, Register b) noexcept { return _mm_min_epi16(a, b); }
+    static Register max(Register a, Register b) noexcept { return _mm_max_epi16(a, b); }
+};
+
+template <>
+struct SimdLanes<float> {
+    using Register = __m128;
+    static constexpr std::size_t kCount = 4;
+    static Register load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, Register v) noexcept { _mm_storeu_ps(p, v); }
+    static Register min(Register a, Register b) noexcept { return _mm_min_ps(a, b); }
+    static Register max(Register a, Register b) noexcept { return _mm_max_ps(a, b); }
+};
+#endif
+
+template <typename Lanes, Comparator Step>
+inline void compare(typename Lanes::Register* wires) noexcept {
+    if constexpr (Step.kind == Comparator::Exchange) {
+        const auto low = Lanes::min(wires[Step.low], wires[Step.high]);
+        wires[Step.high] = Lanes::max(wires[Step.low], wires[Step.high]);
+        wires[Step.low] = low;
+    } else if constexpr (Step.kind == Comparator::MinOnly) {
+        wires[Step.low] = Lanes::min(wires[Step.low], wires[Step.high]);
+    } else {
+        wires[Step.high] = Lanes::max(wires[Step.low], wires[Step.high]);
+    }
+}
+
+// Runs the whole network unrolled, leaving the median on wire N / 2
+template <typename Lanes, std::size_t N>
+inline void selectMedian(typename Lanes::Register* wires) noexcept {
+    [wires]<std::size_t... S>(std::index_sequence<S...>) {
+        (compare<Lanes, kMedianNetwork<N>.steps[S]>(wires), ...);
+    }(std::make_index_sequence<kMedianNetwork<N>.size>{});
+}
+
+// Median over a KernelSize x KernelSize window for source rows [y0, y1) of
+// the tile.
+// Interleaved channels need no special handling: horizontal neighbours are
+// a whole pixel apart, and each SIMD lane filters its own sample. Samples
+// whose window crosses the left or right border, and the tail of each row,
+// go through the same network one at a time.
+template <int KernelSize, typename T>
+void networkMedian(const PixelAccessor<T>& src, const MutablePixelAccessor<T>& dst,
+                   const Rect& tile, int y0, int y1) {
+    constexpr int kRadius = KernelSize / 2;
+    constexpr std::size_t kTaps = static_cast<std::size_t>(KernelSize) * KernelSize;
+    using Vector = SimdLanes<T>;
+    using Scalar = ScalarLanes<T>;
+
+    const int width = src.width();
+    const int channels = src.channels();
+    const auto samples = static_cast<std::size_t>(width) * static_cast<std::size_t>(channels);
+    // Samples whose window lies within the row
+    const std::size_t interiorBegin =
+        std::min(samples, static_cast<std::size_t>(kRadius) * static_cast<std::size_t>(channels));
+    const std::size_t interiorEnd =
+        std::max(interiorBegin, samples - std::min(samples, interiorBegin));
+    // The tile's samples, and the part of them computed with vectors
+    const std::size_t first = static_cast<std::size_t>(tile.x) * static_cast<std::size_t>(channels);
+    const std::size_t last =
+        first + static_cast<std::size_t>(tile.width) * static_cast<std::size_t>(channels);
+    const std::size_t vectorBegin = std::clamp(interiorBegin, first, last);
+    const std::size_t vectorEnd = std::clamp(interiorEnd, vectorBegin, last);
+
+    std::array<const T*, KernelSize> rows{};
+    const auto scalarMedians = [&](T* out, std::size_t begin, std::size_t end) {
+        typename Scalar::Register wires[kTaps];
+        for (std::size_t s = begin; s < end; ++s) {
+            const int x = static_cast<int>(s / static_cast<std::size_t>(channels));
+            const std::size_t c = s % static_cast<std::size_t>(channels);
+            for (int j = 0; j < KernelSize; ++j) {
+                for (int i = 0; i < KernelSize; ++i) {
+                    const auto nx = static_cast<std::size_t>(std::clamp(x + i - kRadius, 0, width - 1));
+                    wires[j * KernelSize + i] = rows[j][nx * static_cast<std::size_t>(channels) + c];
+                }
+            }
+            selectMedian<Scalar, kTaps>(wires);
+            out[s - first] = wires[kTaps / 2];
+        }
+    };
+
+    for (int y = y0; y < y1; ++y) {
+        for (int j = 0; j < KernelSize; ++j) {
+            rows[j] = src.clampedRow(y + j - kRadius);
+        }
+        T* out = dst.row(y - tile.y);
+
+        std::size_t s = vectorBegin;
+        for (; s + Vector::kCount <= vectorEnd; s += Vector::kCount) {
+            typename Vector::Register wires[kTaps];
+            for (int j = 0; j < KernelSize; ++j) {
+                for (int i = 0; i < KernelSize; ++i) {
+                    wires[j * KernelSize + i] = Vector::load(rows[j] + s + (i - kRadius) * channels);
+                }
+            }
+            selectMedian<Vector, kTaps>(wires);
+            Vector::store(out + (s - first), wires[kTaps / 2]);
+        }
+        scalarMedians(out, first, vectorBegin);
+        scalarMedians(out, s, last);
+    }
+}
+
+// Kernels with an unrolled sorting-network path
+constexpr bool hasNetwork(int kernelSize) noexcept {
+    return kernelSize == 3 || kernelSize == 5;
+}
+
+// Filters source rows [y0, y1) of a tile of one image or channel plane
+template <typename T>
+void medianRows(const PixelAccessor<T>& src, const MutablePixelAccessor<T>& dst, int kernelSize,
+                const Rect& tile, int y0, int y1) {
+    if (kernelSize == 3) {
+        networkMedian<3>(src, dst, tile, y0, y1);
+        return;
+    }
+    if (kernelSize == 5) {
+        networkMedian<5>(src, dst, tile, y0, y1);
+        return;
+    }
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        if (src.channels() == 1 && kernelSize >= MedianFilter::kHistogramKernelSize &&
+            kernelSize <= kMaxHistogramKernel) {
+            histogramMedian(src, dst, kernelSize, tile, y0, y1);
+            return;
+        }
+    }
+    selectionMedian(src, dst, kernelSize, tile, y0, y1);
+}
+
+// Strips of at least a kernel's height, so that priming the column
+// histograms of a strip stays small next to filtering it
+std::size_t stripCount(const ThreadPool* pool, int height, int kernelSize) {
+    if (!pool) {
+        return 1;
+    }
+    const auto strips = static_cast<std::size_t>(std::max(1, height / kernelSize));
+    return std::min(pool->getThreadCount(), strips);
+}
+
+}  // namespace
+
 MedianFilter::MedianFilter(int kernelSize) : m_kernelSize(kernelSize) {
     // Validate kernel size
     if (kernelSize <= 0 || kernelSize % 2 == 0) {
@@ -20,12 +501,8 @@ MedianFilter::MedianFilter(int kernelSize) : m_kernelSize(kernelSize) {
 }
 
 Result<std::unique_ptr<Image>> MedianFilter::apply(const Image& image) const {
-    // Create a result image as a clone of the input
-    auto result = image.clone();
-    
     int width = image.getWidth();
     int height = image.getHeight();
-    int radius = m_kernelSize / 2;
     
     if (width == 0 || height == 0) {
         return makeErrorResult<std::unique_ptr<Image>>(
@@ -33,131 +510,31 @@ Result<std::unique_ptr<Image>> MedianFilter::apply(const Image& image) const {
             "Cannot apply filter to an empty image"
         );
     }
+
+    if (image.getType() != Image::Type::Grayscale && image.getType() != Image::Type::RGB &&
+        image.getType() != Image::Type::RGBA) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type: {}", static_cast<int>(image.getType()))
+        );
+    }
     
     try {
-        // Process based on image type
-        if (image.getType() == Image::Type::Grayscale) {
-            // Process grayscale image
-            const auto& srcGray = static_cast<const GrayscaleImage&>(image);
-            auto& dstGray = static_cast<GrayscaleImage&>(*result);
-            
-            std::vector<uint8_t> neighborhood(m_kernelSize * m_kernelSize);
-            
-            for (int y = 0; y < height; ++y) {
-                for (int x = 0; x < width; ++x) {
-                    // Gather neighborhood pixels
-                    size_t idx = 0;
-                    for (int ky = -radius; ky <= radius; ++ky) {
-                        for (int kx = -radius; kx <= radius; ++kx) {
-                            int nx = std::clamp(x + kx, 0, width - 1);
-                            int ny = std::clamp(y + ky, 0, height - 1);
-                            
-                            auto pixelResult = srcGray.getPixel(nx, ny);
-                            if (!pixelResult) {
-                                return makeErrorResult<std::unique_ptr<Image>>(
-                                    pixelResult.error().code(),
-                                    std::format("Failed to get pixel at ({}, {}): {}", 
-                                              nx, ny, pixelResult.error().message())
-                                );
-                            }
-                            
-                            neighborhood[idx++] = pixelResult.value();
-                        }
-                    }
-                    
-                    // Find median value
-                    std::sort(neighborhood.begin(), neighborhood.end());
-                    uint8_t medianValue = neighborhood[neighborhood.size() / 2];
-                    
-                    // Set the result pixel
-                    auto setResult = dstGray.setPixel(x, y, medianValue);
-                    if (!setResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(
-                            setResult.error().code(),
-                            std::format("Failed to set pixel at ({}, {}): {}", 
-                                      x, y, setResult.error().message())
-                        );
-                    }
-                }
-            }
-        } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
-            // Process color image
-            const auto& srcColor = static_cast<const ColorImage&>(image);
-            auto& dstColor = static_cast<ColorImage&>(*result);
-            
-            // Process each channel separately
-            std::vector<uint8_t> rValues(m_kernelSize * m_kernelSize);
-            std::vector<uint8_t> gValues(m_kernelSize * m_kernelSize);
-            std::vector<uint8_t> bValues(m_kernelSize * m_kernelSize);
-            std::vector<uint8_t> aValues;
-            
-            bool hasAlpha = srcColor.hasAlpha();
-            if (hasAlpha) {
-                aValues.resize(m_kernelSize * m_kernelSize);
-            }
-            
-            for (int y = 0; y < height; ++y) {
-                for (int x = 0; x < width; ++x) {
-                    // Gather neighborhood pixels
-                    size_t idx = 0;
-                    for (int ky = -radius; ky <= radius; ++ky) {
-                        for (int kx = -radius; kx <= radius; ++kx) {
-                            int nx = std::clamp(x + kx, 0, width - 1);
-                            int ny = std::clamp(y + ky, 0, height - 1);
-                            
-                            uint8_t r, g, b, a;
-                            auto pixelResult = srcColor.getPixel(nx, ny, r, g, b, a);
-                            if (!pixelResult) {
-                                return makeErrorResult<std::unique_ptr<Image>>(
-                                    pixelResult.error().code(),
-                                    std::format("Failed to get pixel at ({}, {}): {}", 
-                                              nx, ny, pixelResult.error().message())
-                                );
-                            }
-                            
-                            rValues[idx] = r;
-                            gValues[idx] = g;
-                            bValues[idx] = b;
-                            if (hasAlpha) {
-                                aValues[idx] = a;
-                            }
-                            idx++;
-                        }
-                    }
-                    
-                    // Find median values for each channel
-                    std::sort(rValues.begin(), rValues.end());
-                    std::sort(gValues.begin(), gValues.end());
-                    std::sort(bValues.begin(), bValues.end());
-                    
-                    uint8_t medianR = rValues[rValues.size() / 2];
-                    uint8_t medianG = gValues[gValues.size() / 2];
-                    uint8_t medianB = bValues[gValues.size() / 2];
-                    uint8_t medianA = 255;
-                    
-                    if (hasAlpha) {
-                        std::sort(aValues.begin(), aValues.end());
-                        medianA = aValues[aValues.size() / 2];
-                    }
-                    
-                    // Set the result pixel
-                    auto setResult = dstColor.setPixel(x, y, medianR, medianG, medianB, medianA);
-                    if (!setResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(
-                            setResult.error().code(),
-                            std::format("Failed to set pixel at ({}, {}): {}", 
-                                      x, y, setResult.error().message())
-                        );
-                    }
-                }
-            }
-        } else {
+        auto resultImage = ImageFactory::create(
+            width, height, image.getType(), image.getDepth(), image.getRowLayout());
+        if (!resultImage) {
             return makeErrorResult<std::unique_ptr<Image>>(
-                ErrorCode::UnsupportedFormat,
-                std::format("Unsupported image type: {}", static_cast<int>(image.getType()))
+                resultImage.error().code(),
+                resultImage.error().message()
             );
         }
-        
+        auto result = std::move(resultImage.value());
+
+        auto status = filter(image.view(), image.view().bounds(), result->mutableView());
+        if (!status) {
+            return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                           status.error().message());
+        }
         return makeSuccessResult(std::move(result));
     } catch (const std::exception& e) {
         return makeErrorResult<std::unique_ptr<Image>>(
@@ -167,6 +544,85 @@ Result<std::unique_ptr<Image>> MedianFilter::apply(const Image& image) const {
     }
 }
 
+VoidResult MedianFilter::applyTile(const ImageView& source,
+                                   const Rect& tile,
+                                   const MutableImageView& destination) const {
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type: {}", static_cast<int>(source.getType())));
+    }
+    if (destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Median destination must match the source type");
+    }
+    try {
+        return filter(source, tile, destination);
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Median filter failed: {}", e.what()));
+    }
+}
+
+VoidResult MedianFilter::filter(const ImageView& source,
+                                const Rect& tile,
+                                const MutableImageView& destination) const {
+    // The channel planes are scratch memory
+    MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+
+    ThreadPool* workers = sharedPoolFor(
+        static_cast<std::size_t>(tile.width) * static_cast<std::size_t>(tile.height),
+        kMedianParallelPixels);
+    const std::size_t parts = stripCount(workers, tile.height, m_kernelSize);
+    const auto strip = [&](std::size_t part) {
+        const auto [first, last] =
+            partitionRange(static_cast<std::size_t>(tile.height), parts, part);
+        return std::pair{tile.y + static_cast<int>(first), tile.y + static_cast<int>(last)};
+    };
+
+    if (source.getDepth() == Image::Depth::UInt8 && source.getType() != Image::Type::Grayscale &&
+        !hasNetwork(m_kernelSize)) {
+        // 8-bit color: filter each channel as a contiguous plane so the
+        // window gathers read consecutive bytes and the histograms see
+        // one channel
+        auto planes = PlanarImage::fromInterleaved(source);
+        if (!planes) {
+            return makeVoidErrorResult(planes.error().code(), planes.error().message());
+        }
+
+        PlanarImage filtered(tile.width, tile.height, source.getType() == Image::Type::RGBA);
+        forEachPart(workers, parts, [&](std::size_t part) {
+            const auto [y0, y1] = strip(part);
+            for (int c = 0; c < filtered.getChannels(); ++c) {
+                medianRows(PixelAccessor<uint8_t>(planes.value()->getPlane(c)),
+                           MutablePixelAccessor<uint8_t>(filtered.getPlane(c)),
+                           m_kernelSize, tile, y0, y1);
+            }
+        });
+
+        return filtered.toInterleaved(destination);
+    }
+
+    visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+        const PixelAccessor<T> src(source);
+        const MutablePixelAccessor<T> dst(destination);
+        forEachPart(workers, parts, [&](std::size_t part) {
+            const auto [y0, y1] = strip(part);
+            medianRows(src, dst, m_kernelSize, tile, y0, y1);
+        });
+    });
+    return makeVoidSuccessResult();
+}
+
+FilterFootprint MedianFilter::getFootprint() const {
+    const int radius = m_kernelSize / 2;
+    return {radius, radius, radius, radius};
+}
+
 std::string_view MedianFilter::getName() const {
     return "MedianFilter";
 }
@@ -0,0 +1,335 @@
+// src/Filters/RecursiveGaussian.cpp
+#include "../../include/DIPAL/Filters/RecursiveGaussian.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+namespace DIPAL {
+
+namespace {
+
+// Samples per unit of the column pass, a few SIMD registers wide
+constexpr std::size_t kBandSamples = 16;
+
+constexpr int kMaxChannels = 4;
+
+struct Coefficients {
+    double gain;
+    double a1, a2, a3;
+    const double* boundary;  // 3x3, row-major
+};
+
+// Horizontal pass over one row of interleaved samples, in place. The
+// channels of a pixel are filtered together so their independent
+// recursions overlap in the pipeline.
+void filterRow(float* row, int width, int channels, const Coefficients& k) {
+    double p1[kMaxChannels], p2[kMaxChannels], p3[kMaxChannels];  // w[x-1], w[x-2], w[x-3]
+    double last[kMaxChannels];                                     // x[width-1]
+
+    // Left of the row the input is x[0], whose steady-state response is itself
+    for (int c = 0; c < channels; ++c) {
+        p1[c] = p2[c] = p3[c] = row[c];
+        last[c] = row[(width - 1) * channels + c];
+    }
+    for (int x = 0; x < width; ++x) {
+        float* pixel = row + x * channels;
+        for (int c = 0; c < channels; ++c) {
+            const double w = k.gain * pixel[c] + k.a1 * p1[c] + k.a2 * p2[c] + k.a3 * p3[c];
+            p3[c] = p2[c];
+            p2[c] = p1[c];
+            p1[c] = w;
+            pixel[c] = static_cast<float>(w);
+        }
+    }
+
+    // Right of the row the input is x[width-1]; the boundary matrix gives the
+    // anti-causal outputs past the end from the causal state at the end
+    for (int c = 0; c < channels; ++c) {
+        const double u = last[c];
+        const double d[3] = {p1[c] - u, p2[c] - u, p3[c] - u};
+        double y[3];
+        for (int j = 0; j < 3; ++j) {
+            y[j] = u + k.boundary[j * 3] * d[0] + k.boundary[j * 3 + 1] * d[1] +
+                   k.boundary[j * 3 + 2] * d[2];
+        }
+        p1[c] = y[0];
+        p2[c] = y[1];
+        p3[c] = y[2];
+    }
+    for (int x = width - 1; x >= 0; --x) {
+        float* pixel = row + x * channels;
+        for (int c = 0; c < channels; ++c) {
+            const double y = k.gain * pixel[c] + k.a1 * p1[c] + k.a2 * p2[c] + k.a3 * p3[c];
+            p3[c] = p2[c];
+            p2[c] = p1[c];
+            p1[c] = y;
+            pixel[c] = static_cast<float>(y);
+        }
+    }
+}
+
+// Vertical pass over samples [s0, s1) of every row, in place. The recursion
+// runs down and up the rows while the inner loops run along them, so they
+// read memory sequentially and vectorize across columns. As in the row
+// pass, the three previous outputs are carried in double precision: float
+// state keeps rounding noise alive, and a tile would then never settle on
+// the bits of a whole-image run. The upward pass stops at row top; the
+// rows above it are left half filtered.
+void filterColumns(float* data, std::size_t stride, int height, int top, std::size_t s0,
+                   std::size_t s1, const Coefficients& k) {
+    const std::size_t n = s1 - s0;
+    const auto rowAt = [&](int y) { return data + static_cast<std::size_t>(y) * stride + s0; };
+
+    // p[0..2]: the previous three outputs, rotated rather than shifted, so
+    // the slot of the oldest takes the newest; last: x[height-1]
+    TemporaryBuffer<double> state(3 * n);
+    TemporaryBuffer<float> last(n);
+    double* p[3] = {state.data(), state.data() + n, state.data() + 2 * n};
+    const auto rotate = [&] { std::swap(p[1], p[2]); std::swap(p[0], p[1]); };
+    std::copy_n(rowAt(height - 1), n, last.data());
+
+    // Above the image the input is x[0], whose steady-state response is itself
+    for (int j = 0; j < 3; ++j) {
+        std::copy_n(rowAt(0), n, p[j]);
+    }
+    for (int y = 0; y < height; ++y) {
+        float* row = rowAt(y);
+        double* p1 = p[0];
+        double* p2 = p[1];
+        double* p3 = p[2];
+        for (std::size_t i = 0; i < n; ++i) {
+            const double w = k.gain * row[i] + k.a1 * p1[i] + k.a2 * p2[i] + k.a3 * p3[i];
+            p3[i] = w;
+            row[i] = static_cast<float>(w);
+        }
+        rotate();
+    }
+
+    // Below the image the input is x[height-1]; the boundary matrix gives
+    // the anti-causal outputs past the end from the causal state at the end
+    for (std::size_t i = 0; i < n; ++i) {
+        const double u = last[i];
+        const double d[3] = {p[0][i] - u, p[1][i] - u, p[2][i] - u};
+        double y[3];
+        for (int j = 0; j < 3; ++j) {
+            y[j] = u + k.boundary[j * 3] * d[0] + k.boundary[j * 3 + 1] * d[1] +
+                   k.boundary[j * 3 + 2] * d[2];
+        }
+        for (int j = 0; j < 3; ++j) {
+            p[j][i] = y[j];
+        }
+    }
+
+    for (int y = height - 1; y >= top; --y) {
+        float* row = rowAt(y);
+        double* n1 = p[0];
+        double* n2 = p[1];
+        double* n3 = p[2];
+        for (std::size_t i = 0; i < n; ++i) {
+            const double v = k.gain * row[i] + k.a1 * n1[i] + k.a2 * n2[i] + k.a3 * n3[i];
+            n3[i] = v;
+            row[i] = static_cast<float>(v);
+        }
+        rotate();
+    }
+}
+
+template <typename T>
+void blur(const ImageView& source, const Rect& tile, const MutableImageView& destination,
+          const Coefficients& k, ThreadPool* workers) {
+    const PixelAccessor<T> src(source);
+    const MutablePixelAccessor<T> dst(destination);
+    const int width = src.width();
+    const int height = src.height();
+    const int channels = src.channels();
+    const std::size_t samples = static_cast<std::size_t>(width) * static_cast<std::size_t>(channels);
+    const std::size_t firstSample = static_cast<std::size_t>(tile.x) * static_cast<std::size_t>(channels);
+    const std::size_t tileSamples =
+        static_cast<std::size_t>(tile.width) * static_cast<std::size_t>(channels);
+    const std::size_t threads = workers ? workers->getThreadCount() : 1;
+
+    // Every source row feeds the column pass, but only the tile's columns
+    // of each are kept
+    TemporaryBuffer<float> data(tileSamples * static_cast<std::size_t>(height));
+
+    // Rows: load and filter horizontally
+    const std::size_t rowParts = std::min(threads, static_cast<std::size_t>(height));
+    forEachPart(workers, rowParts, [&](std::size_t part) {
+        const auto [y0, y1] = partitionRange(static_cast<std::size_t>(height), rowParts, part);
+        TemporaryBuffer<float> scratch(tileSamples < samples ? samples : 0);
+        for (std::size_t y = y0; y < y1; ++y) {
+            float* kept = data.data() + y * tileSamples;
+            float* row = tileSamples < samples ? scratch.data() : kept;
+            const T* in = src.row(static_cast<int>(y));
+            for (std::size_t i = 0; i < samples; ++i) {
+                row[i] = static_cast<float>(in[i]);
+            }
+            filterRow(row, width, channels, k);
+            if (row != kept) {
+                std::copy_n(row + firstSample, tileSamples, kept);
+            }
+        }
+    });
+
+    // Columns: filter vertically and store the tile's rows. The source has
+    // been fully read, so the destination may alias it.
+    const std::size_t bands = (tileSamples + kBandSamples - 1) / kBandSamples;
+    const std::size_t bandParts = std::min(threads, bands);
+    forEachPart(workers, bandParts, [&](std::size_t part) {
+        const auto [b0, b1] = partitionRange(bands, bandParts, part);
+        const std::size_t s0 = b0 * kBandSamples;
+        const std::size_t s1 = std::min(tileSamples, b1 * kBandSamples);
+        filterColumns(data.data(), tileSamples, height, tile.y, s0, s1, k);
+        for (int y = 0; y < tile.height; ++y) {
+            const float* row = data.data() + static_cast<std::size_t>(tile.y + y) * tileSamples;
+            T* out = dst.row(y);
+            for (std::size_t i = s0; i < s1; ++i) {
+                out[i] = roundToSample<T>(row[i]);
+            }
+        }
+    });
+}
+
+}  // namespace
+
+RecursiveGaussian::RecursiveGaussian(float sigma) : m_sigma(sigma) {
+    if (!(sigma >= kMinSigma)) {
+        throw std::invalid_argument(
+            std::format("Recursive Gaussian sigma must be at least {}, got {}", kMinSigma, sigma));
+    }
+
+    // Young and van Vliet, "Recursive implementation of the Gaussian filter" (1995)
+    const double s = sigma;
+    const double q = s >= 2.5 ? 0.98711 * s - 0.96330 : 3.97156 - 4.14554 * std::sqrt(1.0 - 0.26891 * s);
+    const double q2 = q * q;
+    const double q3 = q2 * q;
+    const double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+    m_feedback = {(2.44413 * q + 2.85619 * q2 + 1.26661 * q3) / b0,
+                  -(1.4281 * q2 + 1.26661 * q3) / b0,
+                  0.422205 * q3 / b0};
+    m_gain = 1.0 - (m_feedback[0] + m_feedback[1] + m_feedback[2]);
+
+    // Triggs and Sdika, "Boundary conditions for Young-van Vliet recursive
+    // filtering" (2006): past the last sample the input is constant, so the
+    // first anti-causal outputs depend linearly on how far the last three
+    // causal outputs are from that constant. Column i of the matrix is the
+    // response to a unit deviation of w[N-1-i], obtained here by running
+    // both recursions over a tail long enough for the response to vanish.
+    const auto [a1, a2, a3] = m_feedback;
+    const auto tail = static_cast<std::size_t>(std::ceil(40.0 * q)) + 64;
+    std::vector<double> w(tail + 3);
+    std::vector<double> y(tail + 3);
+    for (int i = 0; i < 3; ++i) {
+        std::fill(w.begin(), w.end(), 0.0);
+        std::fill(y.begin(), y.end(), 0.0);
+        w[2 - i] = 1.0;  // w[0..2] hold w[N-3..N-1]
+        for (std::size_t n = 3; n < w.size(); ++n) {
+            w[n] = a1 * w[n - 1] + a2 * w[n - 2] + a3 * w[n - 3];
+        }
+        for (std::size_t n = w.size() - 3; n-- > 3;) {
+            y[n] = m_gain * w[n] + a1 * y[n + 1] + a2 * y[n + 2] + a3 * y[n + 3];
+        }
+        for (int j = 0; j < 3; ++j) {
+            m_boundary[j * 3 + i] = y[3 + j];
+        }
+    }
+
+    // The impulse response never reaches zero. Its support is cut where the
+    // weight left beyond the radius, on a full-range 16-bit step, is below
+    // half the float LSB at 0.5, the smallest value whose rounding matters.
+    // With the recursions' state in double precision, a tile with this much
+    // context settles on the same working samples as a whole-image run.
+    std::vector<double> h(2 * tail + 1, 0.0);
+    h[tail] = 1.0;
+    for (std::size_t n = 0; n < h.size(); ++n) {
+        h[n] = m_gain * h[n] + (n >= 1 ? a1 * h[n - 1] : 0.0) + (n >= 2 ? a2 * h[n - 2] : 0.0) +
+               (n >= 3 ? a3 * h[n - 3] : 0.0);
+    }
+    for (std::size_t n = h.size(); n-- > 0;) {
+        h[n] = m_gain * h[n] + (n + 1 < h.size() ? a1 * h[n + 1] : 0.0) +
+               (n + 2 < h.size() ? a2 * h[n + 2] : 0.0) + (n + 3 < h.size() ? a3 * h[n + 3] : 0.0);
+    }
+    constexpr double kLevels = SampleTraits<uint16_t>::maxValue;
+    constexpr double kHalfLsb = 0x1p-25;  // half the float spacing in [0.5, 1)
+    double beyond = 0.0;
+    std::size_t radius = tail;
+    while (radius > 0 && (beyond + std::abs(h[tail + radius])) * kLevels < kHalfLsb) {
+        beyond += std::abs(h[tail + radius]);
+        --radius;
+    }
+    m_radius = static_cast<int>(radius);
+}
+
+VoidResult RecursiveGaussian::apply(const ImageView& source,
+                                    const MutableImageView& destination,
+                                    ThreadPool* pool) const {
+    return apply(source, Rect(0, 0, source.getWidth(), source.getHeight()), destination, pool);
+}
+
+VoidResult RecursiveGaussian::apply(const ImageView& source,
+                                    const Rect& tile,
+                                    const MutableImageView& destination,
+                                    ThreadPool* pool) const {
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type for recursive Gaussian: {}",
+                        static_cast<int>(source.getType())));
+    }
+    if (tile.x < 0 || tile.y < 0 || tile.width < 0 || tile.height < 0 ||
+        tile.x + tile.width > source.getWidth() || tile.y + tile.height > source.getHeight()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Blur tile must lie inside the source");
+    }
+    if (destination.getWidth() != tile.width || destination.getHeight() != tile.height ||
+        destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Blur destination must match the tile size and source type");
+    }
+    if (tile.width == 0 || tile.height == 0) {
+        return makeVoidSuccessResult();
+    }
+
+    try {
+        const std::size_t pixels = static_cast<std::size_t>(source.getWidth()) *
+                                   static_cast<std::size_t>(source.getHeight());
+        ThreadPool* workers = pool ? pool : sharedPoolFor(pixels);
+
+        const Coefficients coefficients{m_gain, m_feedback[0], m_feedback[1], m_feedback[2],
+                                        m_boundary.data()};
+        visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            blur<T>(source, tile, destination, coefficients, workers);
+        });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Recursive Gaussian failed: {}", e.what()));
+    }
+}
+
+Result<std::unique_ptr<Image>> RecursiveGaussian::apply(const Image& image, ThreadPool* pool) const {
+    auto resultImage = ImageFactory::create(image.getWidth(), image.getHeight(), image.getType(),
+                                            image.getDepth(), image.getRowLayout());
+    if (!resultImage) {
+        return resultImage;
+    }
+    auto result = std::move(resultImage.value());
+
+    auto status = apply(image.view(), result->mutableView(), pool);
+    if (!status) {
+        return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                       status.error().message());
+    }
+    return makeSuccessResult(std::move(result));
+}
+
+}  // namespace DIPAL
@@ -0,0 +1,331 @@
+// src/Filters/SeparableConvolution.cpp
+#include "../../include/DIPAL/Filters/SeparableConvolution.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace DIPAL {
+
+namespace {
+
+// Row buffers are padded to whole blocks of this many floats so the SIMD
+// loops below never need a scalar tail
+constexpr std::size_t kBlock = 8;
+
+inline std::size_t roundUpToBlock(std::size_t n) noexcept {
+    return (n + kBlock - 1) / kBlock * kBlock;
+}
+
+// out[i] = sum over k of weights[k] * inputs[k][i], for n a multiple of kBlock.
+// Both passes use it: the horizontal inputs are one padded row shifted by a
+// pixel per tap, the vertical inputs are rows of the ring buffer.
+void weightedSum(const float* const* inputs,
+                 const float* weights,
+                 std::size_t taps,
+                 float* out,
+                 std::size_t n) noexcept {
+#if defined(__AVX2__)
+    for (std::size_t i = 0; i < n; i += 8) {
+        __m256 acc = _mm256_mul_ps(_mm256_set1_ps(weights[0]), _mm256_loadu_ps(inputs[0] + i));
+        for (std::size_t k = 1; k < taps; ++k) {
+            acc = _mm256_add_ps(
+                acc, _mm256_mul_ps(_mm256_set1_ps(weights[k]), _mm256_loadu_ps(inputs[k] + i)));
+        }
+        _mm256_storeu_ps(out + i, acc);
+    }
+#elif defined(__SSE2__)
+    for (std::size_t i = 0; i < n; i += 4) {
+        __m128 acc = _mm_mul_ps(_mm_set1_ps(weights[0]), _mm_loadu_ps(inputs[0] + i));
+        for (std::size_t k = 1; k < taps; ++k) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(inputs[k] + i)));
+        }
+        _mm_storeu_ps(out + i, acc);
+    }
+#else
+    for (std::size_t i = 0; i < n; ++i) {
+        float acc = weights[0] * inputs[0][i];
+        for (std::size_t k = 1; k < taps; ++k) {
+            acc += weights[k] * inputs[k][i];
+        }
+        out[i] = acc;
+    }
+#endif
+}
+
+// Converts n samples to float
+template <typename T>
+void loadRow(const T* src, std::size_t n, float* dst) noexcept {
+    std::size_t i = 0;
+    if constexpr (std::is_same_v<T, uint8_t>) {
+#if defined(__AVX2__)
+        for (; i + 8 <= n; i += 8) {
+            const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)));
+        }
+#elif defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= n; i += 8) {
+            const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i words = _mm_unpacklo_epi8(bytes, zero);
+            _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)));
+            _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero)));
+        }
+#endif
+    }
+    for (; i < n; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+// Stores n float results as samples: integers are rounded to nearest (ties to
+// even, like the SIMD conversion) and saturated
+template <typename T>
+void storeRow(const float* src, std::size_t n, T* dst) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        std::copy_n(src, n, dst);
+    } else {
+        std::size_t i = 0;
+        if constexpr (std::is_same_v<T, uint8_t>) {
+#if defined(__AVX2__)
+            for (; i + 8 <= n; i += 8) {
+                const __m256i ints = _mm256_cvtps_epi32(_mm256_loadu_ps(src + i));
+                const __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(ints),
+                                                      _mm256_extracti128_si256(ints, 1));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i),
+                                 _mm_packus_epi16(words, words));
+            }
+#elif defined(__SSE2__)
+            for (; i + 8 <= n; i += 8) {
+                const __m128i words = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(src + i)),
+                                                      _mm_cvtps_epi32(_mm_loadu_ps(src + i + 4)));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i),
+                                 _mm_packus_epi16(words, words));
+            }
+#endif
+        }
+        for (; i < n; ++i) {
+            dst[i] = roundToSample<T>(src[i]);
+        }
+    }
+}
+
+// Convolves output rows [firstRow, lastRow) and hands each one, as floats
+// before rounding, to sink(y, samples). Only the source rows those outputs
+// read are filtered, so disjoint row ranges can run concurrently.
+template <typename T, typename Sink>
+void convolveRows(const ImageView& source,
+                  std::span<const float> horizontal,
+                  std::span<const float> vertical,
+                  int firstRow,
+                  int lastRow,
+                  Sink&& sink) {
+    const PixelAccessor<T> src(source);
+    const int height = src.height();
+    const auto channels = static_cast<std::size_t>(src.channels());
+    const std::size_t samples = static_cast<std::size_t>(src.width()) * channels;
+    const std::size_t blocks = roundUpToBlock(samples);
+    const std::size_t padding = horizontal.size() / 2 * channels;
+    const int radiusY = static_cast<int>(vertical.size()) / 2;
+    const std::size_t ringRows = vertical.size();
+
+    // Zero-initialized, so the block padding past the right border stays finite
+    TemporaryBuffer<float> padded(blocks + 2 * padding);
+    TemporaryBuffer<float> ring(ringRows * blocks);
+    TemporaryBuffer<float> output(blocks);
+
+    std::vector<const float*> rowTaps(horizontal.size());
+    for (std::size_t k = 0; k < rowTaps.size(); ++k) {
+        rowTaps[k] = padded.data() + k * channels;
+    }
+    std::vector<const float*> columnTaps(ringRows);
+
+    int next = std::max(0, firstRow - radiusY);  // next source row to filter horizontally
+    for (int y = firstRow; y < lastRow; ++y) {
+        const int needed = std::min(y + radiusY, height - 1);
+        for (; next <= needed; ++next) {
+            float* row = padded.data() + padding;
+            loadRow(src.row(next), samples, row);
+            for (std::size_t j = 0; j < padding; ++j) {
+                padded[j] = row[j % channels];
+                row[samples + j] = row[samples - channels + j % channels];
+            }
+            weightedSum(rowTaps.data(), horizontal.data(), horizontal.size(),
+                        ring.data() + static_cast<std::size_t>(next) % ringRows * blocks, blocks);
+        }
+
+        // The rows y - radiusY .. y + radiusY (clamped) occupy distinct ring slots
+        for (std::size_t k = 0; k < ringRows; ++k) {
+            const int sourceRow = std::clamp(y + static_cast<int>(k) - radiusY, 0, height - 1);
+            columnTaps[k] = ring.data() + static_cast<std::size_t>(sourceRow) % ringRows * blocks;
+        }
+        weightedSum(columnTaps.data(), vertical.data(), ringRows, output.data(), blocks);
+
+        sink(y, std::span<const float>(output.data(), samples));
+    }
+}
+
+// Convolves the pixels of a tile of the source into a tile-sized destination
+template <typename T>
+void convolve(const ImageView& source,
+              const Rect& tile,
+              const MutableImageView& destination,
+              std::span<const float> horizontal,
+              std::span<const float> vertical) {
+    const MutablePixelAccessor<T> dst(destination);
+    const auto channels = static_cast<std::size_t>(source.getChannels());
+    const std::size_t first = static_cast<std::size_t>(tile.x) * channels;
+    const std::size_t count = static_cast<std::size_t>(tile.width) * channels;
+    convolveRows<T>(source, horizontal, vertical, tile.y, tile.y + tile.height,
+                    [&](int y, std::span<const float> row) {
+                        // Row y of the source has been consumed, so in-place filtering is safe
+                        storeRow(row.data() + first, count, dst.row(y - tile.y));
+                    });
+}
+
+VoidResult validateSource(const ImageView& source) {
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type for convolution: {}",
+                        static_cast<int>(source.getType())));
+    }
+    return makeVoidSuccessResult();
+}
+
+void validateKernel(const std::vector<float>& kernel, const char* name) {
+    if (kernel.empty() || kernel.size() % 2 == 0) {
+        throw std::invalid_argument(
+            std::format("{} kernel length must be odd, got {}", name, kernel.size()));
+    }
+}
+
+}  // namespace
+
+SeparableConvolution::SeparableConvolution(std::vector<float> horizontal,
+                                           std::vector<float> vertical)
+    : m_horizontal(std::move(horizontal)), m_vertical(std::move(vertical)) {
+    validateKernel(m_horizontal, "Horizontal");
+    validateKernel(m_vertical, "Vertical");
+}
+
+SeparableConvolution::SeparableConvolution(std::vector<float> kernel)
+    : SeparableConvolution(kernel, kernel) {}
+
+VoidResult SeparableConvolution::apply(const ImageView& source,
+                                       const MutableImageView& destination) const {
+    if (auto valid = validateSource(source); !valid) {
+        return valid;
+    }
+    if (destination.getWidth() != source.getWidth() ||
+        destination.getHeight() != source.getHeight() ||
+        destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Convolution destination must match the source size and type");
+    }
+    if (source.isEmpty()) {
+        return makeVoidSuccessResult();
+    }
+
+    try {
+        visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            convolve<T>(source, source.bounds(), destination, m_horizontal, m_vertical);
+        });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Separable convolution failed: {}", e.what()));
+    }
+}
+
+VoidResult SeparableConvolution::apply(const ImageView& source,
+                                       const Rect& tile,
+                                       const MutableImageView& destination) const {
+    if (auto valid = validateSource(source); !valid) {
+        return valid;
+    }
+    if (tile.x < 0 || tile.y < 0 || tile.width < 0 || tile.height < 0 ||
+        tile.x + tile.width > source.getWidth() || tile.y + tile.height > source.getHeight()) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("Tile ({}, {}) {}x{} is not inside the {}x{} source", tile.x, tile.y,
+                        tile.width, tile.height, source.getWidth(), source.getHeight()));
+    }
+    if (destination.getWidth() != tile.width || destination.getHeight() != tile.height ||
+        destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Convolution destination must match the tile size and source type");
+    }
+    if (tile.width == 0 || tile.height == 0) {
+        return makeVoidSuccessResult();
+    }
+
+    try {
+        visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            convolve<T>(source, tile, destination, m_horizontal, m_vertical);
+        });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Separable convolution failed: {}", e.what()));
+    }
+}
+
+VoidResult SeparableConvolution::stream(const ImageView& source,
+                                        int firstRow,
+                                        int lastRow,
+                                        const RowSink& sink) const {
+    if (auto valid = validateSource(source); !valid) {
+        return valid;
+    }
+    if (firstRow < 0 || lastRow > source.getHeight() || firstRow > lastRow) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("Rows [{}, {}) are outside the image of height {}", firstRow, lastRow,
+                        source.getHeight()));
+    }
+    if (source.isEmpty() || firstRow == lastRow) {
+        return makeVoidSuccessResult();
+    }
+
+    try {
+        visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            convolveRows<T>(source, m_horizontal, m_vertical, firstRow, lastRow, sink);
+        });
+        return makeVoidSuccessResult();
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Separable convolution failed: {}", e.what()));
+    }
+}
+
+Result<std::unique_ptr<Image>> SeparableConvolution::apply(const Image& image) const {
+    auto resultImage = ImageFactory::create(image.getWidth(), image.getHeight(), image.getType(),
+                                            image.getDepth(), image.getRowLayout());
+    if (!resultImage) {
+        return resultImage;
+    }
+    auto result = std::move(resultImage.value());
+
+    auto status = apply(image.view(), result->mutableView());
+    if (!status) {
+        return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                       status.error().message());
+    }
+    return makeSuccessResult(std::move(result));
+}
+
+}  // namespace DIPAL
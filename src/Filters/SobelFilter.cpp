@@ -1,162 +1,537 @@
 // src/Filters/SobelFilter.cpp
 #include "../../include/DIPAL/Filters/SobelFilter.hpp"
-#include "../../include/DIPAL/Image/GrayscaleImage.hpp"
-#include "../../include/DIPAL/Image/ColorImage.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
 #include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <format>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace DIPAL {
 
-SobelFilter::SobelFilter(bool normalize) : m_normalize(normalize) {}
+namespace {
+
+using Operator = SobelFilter::Operator;
+using Norm = SobelFilter::Norm;
+
+// Row buffers are padded to whole blocks of this many floats so the SIMD
+// loop below never needs a scalar tail
+constexpr std::size_t kBlock = 8;
+
+inline std::size_t roundUpToBlock(std::size_t n) noexcept {
+    return (n + kBlock - 1) / kBlock * kBlock;
+}
+
+// Float lanes of the widest available vectors. Comparisons return masks
+// with every bit of the true lanes set, for use with the bitwise operations.
+#if defined(__AVX2__)
+struct Lanes {
+    using Vector = __m256;
+    static constexpr std::size_t kCount = 8;
+    static Vector load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static void store(float* p, Vector v) noexcept { _mm256_storeu_ps(p, v); }
+    static Vector set(float v) noexcept { return _mm256_set1_ps(v); }
+    static Vector add(Vector a, Vector b) noexcept { return _mm256_add_ps(a, b); }
+    static Vector sub(Vector a, Vector b) noexcept { return _mm256_sub_ps(a, b); }
+    static Vector mul(Vector a, Vector b) noexcept { return _mm256_mul_ps(a, b); }
+    static Vector sqrt(Vector v) noexcept { return _mm256_sqrt_ps(v); }
+    static Vector abs(Vector v) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+    static Vector greater(Vector a, Vector b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Vector equal(Vector a, Vector b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static Vector bitAnd(Vector a, Vector b) noexcept { return _mm256_and_ps(a, b); }
+    static Vector bitOr(Vector a, Vector b) noexcept { return _mm256_or_ps(a, b); }
+    static Vector bitXor(Vector a, Vector b) noexcept { return _mm256_xor_ps(a, b); }
+};
+#elif defined(__SSE2__)
+struct Lanes {
+    using Vector = __m128;
+    static constexpr std::size_t kCount = 4;
+    static Vector load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, Vector v) noexcept { _mm_storeu_ps(p, v); }
+    static Vector set(float v) noexcept { return _mm_set1_ps(v); }
+    static Vector add(Vector a, Vector b) noexcept { return _mm_add_ps(a, b); }
+    static Vector sub(Vector a, Vector b) noexcept { return _mm_sub_ps(a, b); }
+    static Vector mul(Vector a, Vector b) noexcept { return _mm_mul_ps(a, b); }
+    static Vector sqrt(Vector v) noexcept { return _mm_sqrt_ps(v); }
+    static Vector abs(Vector v) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+    static Vector greater(Vector a, Vector b) noexcept { return _mm_cmpgt_ps(a, b); }
+    static Vector equal(Vector a, Vector b) noexcept { return _mm_cmpeq_ps(a, b); }
+    static Vector bitAnd(Vector a, Vector b) noexcept { return _mm_and_ps(a, b); }
+    static Vector bitOr(Vector a, Vector b) noexcept { return _mm_or_ps(a, b); }
+    static Vector bitXor(Vector a, Vector b) noexcept { return _mm_xor_ps(a, b); }
+};
+#else
+struct Lanes {
+    using Vector = float;
+    static constexpr std::size_t kCount = 1;
+    static Vector load(const float* p) noexcept { return *p; }
+    static void store(float* p, Vector v) noexcept { *p = v; }
+    static Vector set(float v) noexcept { return v; }
+    static Vector add(Vector a, Vector b) noexcept { return a + b; }
+    static Vector sub(Vector a, Vector b) noexcept { return a - b; }
+    static Vector mul(Vector a, Vector b) noexcept { return a * b; }
+    static Vector sqrt(Vector v) noexcept { return std::sqrt(v); }
+    static Vector abs(Vector v) noexcept { return std::fabs(v); }
+    static Vector greater(Vector a, Vector b) noexcept { return mask(a > b); }
+    static Vector equal(Vector a, Vector b) noexcept { return mask(a == b); }
+    static Vector bitAnd(Vector a, Vector b) noexcept { return bits(bits(a) & bits(b)); }
+    static Vector bitOr(Vector a, Vector b) noexcept { return bits(bits(a) | bits(b)); }
+    static Vector bitXor(Vector a, Vector b) noexcept { return bits(bits(a) ^ bits(b)); }
+
+private:
+    static uint32_t bits(float v) noexcept { return std::bit_cast<uint32_t>(v); }
+    static float bits(uint32_t v) noexcept { return std::bit_cast<float>(v); }
+    static float mask(bool set) noexcept { return bits(set ? ~uint32_t{0} : uint32_t{0}); }
+};
+#endif
+
+// Weights of the outer and middle rows (or columns) of each operator
+template <Operator Op>
+struct Weights;
+
+template <>
+struct Weights<Operator::Sobel> {
+    static constexpr float kOuter = 1.0f;
+    static constexpr float kMiddle = 2.0f;
+};
+
+template <>
+struct Weights<Operator::Scharr> {
+    static constexpr float kOuter = 3.0f;
+    static constexpr float kMiddle = 10.0f;
+};
+
+template <>
+struct Weights<Operator::Prewitt> {
+    static constexpr float kOuter = 1.0f;
+    static constexpr float kMiddle = 1.0f;
+};
+
+// Directions of the boundaries between orientation bins, over [0, 180) degrees
+struct Boundaries {
+    int bins = 0;
+    std::array<float, SobelFilter::kMaxOrientationBins> cosines{};
+    std::array<float, SobelFilter::kMaxOrientationBins> sines{};
+};
+
+Boundaries makeBoundaries(int bins) {
+    Boundaries boundaries;
+    boundaries.bins = bins;
+    for (int k = 0; k < bins; ++k) {
+        const double angle = (k + 0.5) * std::numbers::pi / bins;
+        boundaries.cosines[k] = static_cast<float>(std::cos(angle));
+        boundaries.sines[k] = static_cast<float>(std::sin(angle));
+    }
+    return boundaries;
+}
+
+// Gradient of n pixels from three padded luminance rows (index -1 and n are
+// readable). Writes the magnitudes and, if orientation is not null, the
+// number of bin boundaries below each gradient's direction.
+template <Operator Op, Norm N>
+void gradientRow(const float* above, const float* center, const float* below, std::size_t n,
+                 float* magnitude, float* orientation, const Boundaries& boundaries) noexcept {
+    using W = Weights<Op>;
+    const auto outer = Lanes::set(W::kOuter);
+    const auto middle = Lanes::set(W::kMiddle);
+    const auto zero = Lanes::set(0.0f);
+    const auto one = Lanes::set(1.0f);
+    const auto signBit = Lanes::set(-0.0f);
+
+    for (std::size_t i = 0; i < n; i += Lanes::kCount) {
+        const auto aboveLeft = Lanes::load(above + i - 1);
+        const auto aboveRight = Lanes::load(above + i + 1);
+        const auto belowLeft = Lanes::load(below + i - 1);
+        const auto belowRight = Lanes::load(below + i + 1);
+
+        auto gx = Lanes::add(Lanes::sub(aboveRight, aboveLeft), Lanes::sub(belowRight, belowLeft));
+        auto gy = Lanes::add(Lanes::sub(belowLeft, aboveLeft), Lanes::sub(belowRight, aboveRight));
+        if constexpr (W::kOuter != 1.0f) {
+            gx = Lanes::mul(outer, gx);
+            gy = Lanes::mul(outer, gy);
+        }
+        const auto dx = Lanes::sub(Lanes::load(center + i + 1), Lanes::load(center + i - 1));
+        const auto dy = Lanes::sub(Lanes::load(below + i), Lanes::load(above + i));
+        if constexpr (W::kMiddle != 1.0f) {
+            gx = Lanes::add(gx, Lanes::mul(middle, dx));
+            gy = Lanes::add(gy, Lanes::mul(middle, dy));
+        } else {
+            gx = Lanes::add(gx, dx);
+            gy = Lanes::add(gy, dy);
+        }
+
+        if constexpr (N == Norm::L1) {
+            Lanes::store(magnitude + i, Lanes::add(Lanes::abs(gx), Lanes::abs(gy)));
+        } else {
+            Lanes::store(magnitude + i,
+                         Lanes::sqrt(Lanes::add(Lanes::mul(gx, gx), Lanes::mul(gy, gy))));
+        }
+
+        if (orientation) {
+            // Fold the direction into [0, 180) degrees, then count the
+            // boundaries it lies past: a boundary at angle b is passed when
+            // the cross product of (cos b, sin b) and the gradient is positive
+            const auto flip = Lanes::bitOr(
+                Lanes::greater(zero, gy),
+                Lanes::bitAnd(Lanes::equal(gy, zero), Lanes::greater(zero, gx)));
+            const auto sign = Lanes::bitAnd(flip, signBit);
+            const auto fx = Lanes::bitXor(gx, sign);
+            const auto fy = Lanes::bitXor(gy, sign);
+            auto count = zero;
+            for (int k = 0; k < boundaries.bins; ++k) {
+                const auto passed =
+                    Lanes::greater(Lanes::mul(Lanes::set(boundaries.cosines[k]), fy),
+                                   Lanes::mul(Lanes::set(boundaries.sines[k]), fx));
+                count = Lanes::add(count, Lanes::bitAnd(passed, one));
+            }
+            Lanes::store(orientation + i, count);
+        }
+    }
+}
+
+// Luminance of one source row, with the weights used by
+// ImageFactory::toGrayscale and truncated to the sample type like a stored
+// grayscale image. The pixels before and after the row are replicated.
+template <typename T>
+void lumaRow(const T* src, int width, int channels, float* dst) noexcept {
+    if (channels == 1) {
+        for (int x = 0; x < width; ++x) {
+            dst[x] = static_cast<float>(src[x]);
+        }
+    } else {
+        for (int x = 0; x < width; ++x) {
+            const T* px = src + static_cast<std::size_t>(x) * channels;
+            const float luma = 0.299f * px[0] + 0.587f * px[1] + 0.114f * px[2];
+            if constexpr (std::is_floating_point_v<T>) {
+                dst[x] = luma;
+            } else {
+                dst[x] = static_cast<float>(static_cast<T>(luma));
+            }
+        }
+    }
+    dst[-1] = dst[0];
+    dst[width] = dst[width - 1];
+}
+
+// Where the gradient of the tile's rows goes, tile-relative. Magnitudes of
+// integer depths are truncated; when normalizing they are kept as floats
+// until the strongest edge of the whole tile is known.
+template <typename T>
+struct Outputs {
+    MutablePixelAccessor<T> magnitude;
+    MutablePixelAccessor<uint8_t> orientation;
+    float* unnormalized = nullptr;  // tile width * height, if normalizing
+    bool hasOrientation = false;
+};
+
+// Gradient of tile rows [y0, y1). Luminance is computed for whole source
+// rows, which pad the tile with its halo.
+template <typename T, Operator Op, Norm N>
+float gradientRows(const PixelAccessor<T>& src, const Rect& tile, const Outputs<T>& outputs,
+                   const Boundaries& boundaries, int y0, int y1) {
+    const int width = tile.width;
+    const int channels = src.channels();
+    const std::size_t n = roundUpToBlock(static_cast<std::size_t>(width));
+    // One padding float before each row and a block after it
+    const std::size_t stride = roundUpToBlock(static_cast<std::size_t>(src.width())) + 2 * kBlock;
+
+    TemporaryBuffer<float> ring(3 * stride);
+    TemporaryBuffer<float> magnitude(n);
+    TemporaryBuffer<float> orientation(outputs.hasOrientation ? n : 0);
+    std::array<int, 3> loaded{-1, -1, -1};
+    const auto luma = [&](int y) -> const float* {
+        y = std::clamp(y, 0, src.height() - 1);
+        const auto slot = static_cast<std::size_t>(y % 3);
+        float* row = ring.data() + slot * stride + kBlock;
+        if (loaded[slot] != y) {
+            lumaRow(src.row(y), src.width(), channels, row);
+            loaded[slot] = y;
+        }
+        return row + tile.x;
+    };
+
+    float strongest = 0.0f;
+    for (int y = y0; y < y1; ++y) {
+        const float* above = luma(tile.y + y - 1);
+        const float* center = luma(tile.y + y);
+        const float* below = luma(tile.y + y + 1);
+        gradientRow<Op, N>(above, center, below, n, magnitude.data(),
+                           outputs.hasOrientation ? orientation.data() : nullptr, boundaries);
+
+        if (outputs.unnormalized) {
+            float* row = outputs.unnormalized + static_cast<std::size_t>(y) * width;
+            for (int x = 0; x < width; ++x) {
+                const float m = std::is_floating_point_v<T> ? magnitude[x] : std::trunc(magnitude[x]);
+                row[x] = m;
+                strongest = std::max(strongest, m);
+            }
+        } else {
+            T* row = outputs.magnitude.row(y);
+            for (int x = 0; x < width; ++x) {
+                if constexpr (std::is_floating_point_v<T>) {
+                    row[x] = magnitude[x];
+                } else {
+                    row[x] = static_cast<T>(
+                        std::min(magnitude[x], static_cast<float>(SampleTraits<T>::maxValue)));
+                }
+            }
+        }
+
+        if (outputs.hasOrientation) {
+            uint8_t* row = outputs.orientation.row(y);
+            for (int x = 0; x < width; ++x) {
+                const auto bin = static_cast<int>(orientation[x]);
+                row[x] = static_cast<uint8_t>(bin == boundaries.bins ? 0 : bin);
+            }
+        }
+    }
+    return strongest;
+}
+
+// Scales rows [y0, y1) so that the strongest edge is the maximum sample value
+template <typename T>
+void normalizeRows(const float* unnormalized, const MutablePixelAccessor<T>& dst, float strongest,
+                   int y0, int y1) {
+    const int width = dst.width();
+    for (int y = y0; y < y1; ++y) {
+        const float* src = unnormalized + static_cast<std::size_t>(y) * width;
+        T* row = dst.row(y);
+        for (int x = 0; x < width; ++x) {
+            if constexpr (std::is_floating_point_v<T>) {
+                row[x] = src[x] * SampleTraits<T>::maxValue / strongest;
+            } else {
+                // Both are integers, so the double quotient truncates exactly
+                row[x] = static_cast<T>(static_cast<double>(src[x]) * SampleTraits<T>::maxValue /
+                                        static_cast<double>(strongest));
+            }
+        }
+    }
+}
+
+template <typename T, Operator Op, Norm N>
+void computeGradient(const ImageView& source, const Rect& tile, const MutableImageView& magnitude,
+                     const MutableImageView& orientation, int bins, bool normalize) {
+    const int width = tile.width;
+    const int height = tile.height;
+    const PixelAccessor<T> src(source);
+
+    TemporaryBuffer<float> unnormalized(
+        normalize ? static_cast<std::size_t>(width) * static_cast<std::size_t>(height) : 0);
+    const Outputs<T> outputs{MutablePixelAccessor<T>(magnitude),
+                             MutablePixelAccessor<uint8_t>(orientation),
+                             normalize ? unnormalized.data() : nullptr, bins > 0};
+    const Boundaries boundaries = makeBoundaries(bins);
+
+    ThreadPool* workers =
+        sharedPoolFor(static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    const std::size_t parts =
+        std::min(workers ? workers->getThreadCount() : 1, static_cast<std::size_t>(height));
+    const auto strip = [&](std::size_t part) {
+        const auto [first, last] = partitionRange(static_cast<std::size_t>(height), parts, part);
+        return std::pair{static_cast<int>(first), static_cast<int>(last)};
+    };
+
+    std::vector<float> strongest(parts, 0.0f);
+    forEachPart(workers, parts, [&](std::size_t part) {
+        const auto [y0, y1] = strip(part);
+        strongest[part] = gradientRows<T, Op, N>(src, tile, outputs, boundaries, y0, y1);
+    });
+
+    if (normalize) {
+        const float peak = *std::max_element(strongest.begin(), strongest.end());
+        if (peak > 0.0f) {
+            forEachPart(workers, parts, [&](std::size_t part) {
+                const auto [y0, y1] = strip(part);
+                normalizeRows(unnormalized.data(), outputs.magnitude, peak, y0, y1);
+            });
+        } else {
+            // A flat image has no edges to scale
+            for (int y = 0; y < height; ++y) {
+                std::fill_n(outputs.magnitude.row(y), width, T{});
+            }
+        }
+    }
+}
+
+// Instantiates the pass for the filter's operator and norm
+template <typename T>
+void dispatchGradient(Operator op, Norm norm, const ImageView& source, const Rect& tile,
+                      const MutableImageView& magnitude, const MutableImageView& orientation,
+                      int bins, bool normalize) {
+    const auto run = [&]<Operator Op>(std::integral_constant<Operator, Op>) {
+        if (norm == Norm::L1) {
+            computeGradient<T, Op, Norm::L1>(source, tile, magnitude, orientation, bins,
+                                             normalize);
+        } else {
+            computeGradient<T, Op, Norm::L2>(source, tile, magnitude, orientation, bins,
+                                             normalize);
+        }
+    };
+    switch (op) {
+        case Operator::Scharr:
+            run(std::integral_constant<Operator, Operator::Scharr>{});
+            break;
+        case Operator::Prewitt:
+            run(std::integral_constant<Operator, Operator::Prewitt>{});
+            break;
+        default:
+            run(std::integral_constant<Operator, Operator::Sobel>{});
+            break;
+    }
+}
+
+}  // namespace
+
+SobelFilter::SobelFilter(bool normalize, Operator op, Norm norm)
+    : m_normalize(normalize), m_operator(op), m_norm(norm) {}
 
 Result<std::unique_ptr<Image>> SobelFilter::apply(const Image& image) const {
+    auto gradient = computeGradient(image, 0);
+    if (!gradient) {
+        return makeErrorResult<std::unique_ptr<Image>>(gradient.error().code(),
+                                                       gradient.error().message());
+    }
+    return makeSuccessResult(std::move(gradient.value().magnitude));
+}
+
+Result<SobelFilter::Gradient> SobelFilter::computeGradient(const Image& image,
+                                                           int orientationBins) const {
     int width = image.getWidth();
     int height = image.getHeight();
-    
+
     if (width == 0 || height == 0) {
-        return makeErrorResult<std::unique_ptr<Image>>(
+        return makeErrorResult<Gradient>(
             ErrorCode::InvalidParameter,
             "Cannot apply filter to an empty image"
         );
     }
-    
+
+    if (orientationBins < 0 || orientationBins > kMaxOrientationBins) {
+        return makeErrorResult<Gradient>(
+            ErrorCode::InvalidParameter,
+            std::format("Orientation bins must be between 0 and {}, got {}", kMaxOrientationBins,
+                        orientationBins)
+        );
+    }
+
     try {
-        // Sobel operates on grayscale images, so convert to grayscale if needed
-        std::unique_ptr<GrayscaleImage> grayImage;
-        
-        if (image.getType() == Image::Type::Grayscale) {
-            // Clone the input grayscale image
-            auto clone = image.clone();
-            grayImage = std::unique_ptr<GrayscaleImage>(
-                static_cast<GrayscaleImage*>(clone.release())
-            );
-        } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
-            // Convert color to grayscale
-            const auto& colorImage = static_cast<const ColorImage&>(image);
-            auto result = ImageFactory::toGrayscale(colorImage);
-            if (!result) {
-                return makeErrorResult<std::unique_ptr<Image>>(
-                    result.error().code(),
-                    result.error().message()
-                );
-            }
-            grayImage = std::move(result.value());
-        } else {
-            return makeErrorResult<std::unique_ptr<Image>>(
-                ErrorCode::UnsupportedFormat,
-                std::format("Unsupported image type: {}", static_cast<int>(image.getType()))
-            );
-        }
-        
-        // Create output grayscale image
-        auto resultGray = ImageFactory::createGrayscale(width, height);
-        if (!resultGray) {
-            return makeErrorResult<std::unique_ptr<Image>>(
-                resultGray.error().code(),
-                resultGray.error().message()
-            );
+        Gradient gradient;
+
+        // Create output grayscale image of the input depth
+        auto magnitude = ImageFactory::create(
+            width, height, Image::Type::Grayscale, image.getDepth(), image.getRowLayout());
+        if (!magnitude) {
+            return makeErrorResult<Gradient>(magnitude.error().code(), magnitude.error().message());
         }
-        auto& outputGray = *resultGray.value();
-        
-        // Sobel kernels
-        const int kx[3][3] = {
-            {-1, 0, 1},
-            {-2, 0, 2},
-            {-1, 0, 1}
-        };
-        
-        const int ky[3][3] = {
-            {-1, -2, -1},
-            {0, 0, 0},
-            {1, 2, 1}
-        };
-        
-        // Find maximum gradient magnitude for normalization if needed
-        int maxMagnitude = 0;
-        std::vector<int> magnitudes(width * height, 0);
-        
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                int gx = 0;
-                int gy = 0;
-                
-                // Apply Sobel kernels
-                for (int ky_idx = -1; ky_idx <= 1; ++ky_idx) {
-                    for (int kx_idx = -1; kx_idx <= 1; ++kx_idx) {
-                        int nx = std::clamp(x + kx_idx, 0, width - 1);
-                        int ny = std::clamp(y + ky_idx, 0, height - 1);
-                        
-                        auto pixelResult = grayImage->getPixel(nx, ny);
-                        if (!pixelResult) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                pixelResult.error().code(),
-                                std::format("Failed to get pixel at ({}, {}): {}", 
-                                          nx, ny, pixelResult.error().message())
-                            );
-                        }
-                        
-                        uint8_t pixelValue = pixelResult.value();
-                        gx += pixelValue * kx[ky_idx + 1][kx_idx + 1];
-                        gy += pixelValue * ky[ky_idx + 1][kx_idx + 1];
-                    }
-                }
-                
-                // Calculate gradient magnitude
-                int magnitude = static_cast<int>(std::sqrt(gx * gx + gy * gy));
-                
-                // Store magnitude for normalization
-                magnitudes[y * width + x] = magnitude;
-                maxMagnitude = std::max(maxMagnitude, magnitude);
+        gradient.magnitude = std::move(magnitude.value());
+
+        if (orientationBins > 0) {
+            auto orientation = ImageFactory::create(
+                width, height, Image::Type::Grayscale, Image::Depth::UInt8, image.getRowLayout());
+            if (!orientation) {
+                return makeErrorResult<Gradient>(orientation.error().code(),
+                                                 orientation.error().message());
             }
+            gradient.orientation = std::move(orientation.value());
         }
-        
-        // Set output pixels
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                int magnitude = magnitudes[y * width + x];
-                
-                // Normalize if required
-                uint8_t outputValue;
-                if (m_normalize && maxMagnitude > 0) {
-                    outputValue = static_cast<uint8_t>((magnitude * 255) / maxMagnitude);
-                } else {
-                    outputValue = static_cast<uint8_t>(std::min(255, magnitude));
-                }
-                
-                auto setResult = outputGray.setPixel(x, y, outputValue);
-                if (!setResult) {
-                    return makeErrorResult<std::unique_ptr<Image>>(
-                        setResult.error().code(),
-                        std::format("Failed to set pixel at ({}, {}): {}", 
-                                  x, y, setResult.error().message())
-                    );
-                }
-            }
+
+        auto status = computeInto(
+            image.view(), image.view().bounds(), gradient.magnitude->mutableView(),
+            gradient.orientation ? gradient.orientation->mutableView() : MutableImageView(),
+            orientationBins);
+        if (!status) {
+            return makeErrorResult<Gradient>(status.error().code(), status.error().message());
         }
-        
-        // Return the result
-        return makeSuccessResult<std::unique_ptr<Image>>(std::move(resultGray.value()));
+        return makeSuccessResult(std::move(gradient));
     } catch (const std::exception& e) {
-        return makeErrorResult<std::unique_ptr<Image>>(
+        return makeErrorResult<Gradient>(
             ErrorCode::ProcessingFailed,
             std::format("Sobel filter failed: {}", e.what())
         );
     }
 }
 
+VoidResult SobelFilter::applyTile(const ImageView& source,
+                                  const Rect& tile,
+                                  const MutableImageView& destination) const {
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+    if (destination.getType() != Image::Type::Grayscale ||
+        destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Sobel destination must be grayscale of the source depth");
+    }
+    try {
+        return computeInto(source, tile, destination, MutableImageView(), 0);
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Sobel filter failed: {}", e.what()));
+    }
+}
+
+VoidResult SobelFilter::computeInto(const ImageView& source,
+                                    const Rect& tile,
+                                    const MutableImageView& magnitude,
+                                    const MutableImageView& orientation,
+                                    int orientationBins) const {
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type: {}", static_cast<int>(source.getType())));
+    }
+
+    // Luminance rows and unnormalized magnitudes are scratch memory
+    MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+    visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+        dispatchGradient<T>(m_operator, m_norm, source, tile, magnitude, orientation,
+                            orientationBins, m_normalize);
+    });
+    return makeVoidSuccessResult();
+}
+
+FilterFootprint SobelFilter::getFootprint() const {
+    // Normalization scales by the strongest edge of the whole image
+    return {1, 1, 1, 1, !m_normalize};
+}
+
+ImageFormat SobelFilter::getOutputFormat(Image::Type, Image::Depth depth) const {
+    return {Image::Type::Grayscale, depth};
+}
+
 std::string_view SobelFilter::getName() const {
     return "SobelFilter";
 }
 
 std::unique_ptr<FilterStrategy> SobelFilter::clone() const {
-    return std::make_unique<SobelFilter>(m_normalize);
+    return std::make_unique<SobelFilter>(m_normalize, m_operator, m_norm);
 }
 
 bool SobelFilter::isNormalized() const noexcept {
     return m_normalize;
 }
 
+SobelFilter::Operator SobelFilter::getOperator() const noexcept {
+    return m_operator;
+}
+
+SobelFilter::Norm SobelFilter::getNorm() const noexcept {
+    return m_norm;
+}
+
 } // namespace DIPAL
@@ -1,145 +1,107 @@
 // src/Filters/UnsharpMaskFilter.cpp
 #include "../../include/DIPAL/Filters/UnsharpMaskFilter.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
 
 #include "../../include/DIPAL/Filters/GaussianBlurFilter.hpp"
-#include "../../include/DIPAL/Image/ColorImage.hpp"
-#include "../../include/DIPAL/Image/GrayscaleImage.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
 
 #include <algorithm>
 #include <cmath>
 #include <format>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 namespace DIPAL {
 
-UnsharpMaskFilter::UnsharpMaskFilter(float amount, float radius, uint8_t threshold)
-    : m_amount(amount), m_radius(radius), m_threshold(threshold) {
-    if (amount < 0.0f) {
-        throw std::invalid_argument(std::format("Amount must be positive, got {}", amount));
+namespace {
+
+// src + amount * (src - blurred) over one row, for differences of at least
+// the threshold. The threshold is given on the 8-bit scale and rescaled to
+// the sample depth; integer results are clamped, float results are kept as
+// computed. Alpha, when present, is copied from the source.
+template <typename T>
+void sharpenRow(const T* src,
+                std::span<const float> blurred,
+                T* dst,
+                int channels,
+                int colorChannels,
+                float amount,
+                uint8_t threshold8) {
+    using Value = std::conditional_t<std::is_floating_point_v<T>, float, int>;
+
+    const Value threshold = static_cast<Value>(threshold8 * (SampleTraits<T>::maxValue / 255.0f));
+    const std::size_t samples = blurred.size();
+
+    if constexpr (std::is_floating_point_v<T>) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            // Calculate the difference for sharpening
+            const float diff = src[i] - blurred[i];
+
+            // Apply threshold, then sharpening with amount parameter
+            dst[i] = src[i] + amount * (std::abs(diff) < threshold ? 0.0f : diff);
+        }
+    } else {
+        // Integer samples and differences are exact in float; written without
+        // branches so the compiler can vectorize the loop
+        const auto limit = static_cast<int>(SampleTraits<T>::maxValue);
+        const auto floatThreshold = static_cast<float>(threshold);
+        for (std::size_t i = 0; i < samples; ++i) {
+            const auto srcValue = static_cast<float>(src[i]);
+            // The blur is rounded as SeparableConvolution would store it
+            const float diff = srcValue - static_cast<float>(roundToSample<T>(blurred[i]));
+            const float kept = std::abs(diff) < floatThreshold ? 0.0f : diff;
+            const int newValue = static_cast<int>(src[i]) + static_cast<int>(amount * kept);
+            dst[i] = static_cast<T>(std::min(std::max(newValue, 0), limit));
+        }
     }
+
+    if (colorChannels < channels) {
+        for (std::size_t i = static_cast<std::size_t>(colorChannels); i < samples;
+             i += static_cast<std::size_t>(channels)) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+// Gaussian kernel for the mask: sigma = radius over about three radii
+std::vector<float> maskKernel(float radius) {
     if (radius <= 0.0f) {
         throw std::invalid_argument(std::format("Radius must be positive, got {}", radius));
     }
+    return GaussianBlurFilter::createKernel(radius, static_cast<int>(radius * 3.0f) | 1);
+}
+
+}  // namespace
+
+UnsharpMaskFilter::UnsharpMaskFilter(float amount, float radius, uint8_t threshold)
+    : m_amount(amount), m_radius(radius), m_threshold(threshold), m_blur(maskKernel(radius)) {
+    if (amount < 0.0f) {
+        throw std::invalid_argument(std::format("Amount must be positive, got {}", amount));
+    }
 }
 
 Result<std::unique_ptr<Image>> UnsharpMaskFilter::apply(const Image& image) const {
     try {
-        // Create a blurred version of the image using Gaussian blur
-        GaussianBlurFilter blurFilter(
-            m_radius, static_cast<int>(m_radius * 3.0f) | 1);  // Ensure kernel size is odd
-        auto blurredResult = blurFilter.apply(image);
-
-        if (!blurredResult) {
-            return makeErrorResult<std::unique_ptr<Image>>(
-                blurredResult.error().code(),
-                std::format("Unsharp mask failed in blur step: {}",
-                            blurredResult.error().message()));
+        auto resultImage = ImageFactory::create(image.getWidth(),
+                                                image.getHeight(),
+                                                image.getType(),
+                                                image.getDepth(),
+                                                image.getRowLayout());
+        if (!resultImage) {
+            return makeErrorResult<std::unique_ptr<Image>>(resultImage.error().code(),
+                                                           resultImage.error().message());
         }
+        auto result = std::move(resultImage.value());
 
-        // Create a result image as a clone of the input
-        auto result = image.clone();
-
-        // Apply unsharp masking based on image type
-        if (image.getType() == Image::Type::Grayscale) {
-            const auto& srcGray = static_cast<const GrayscaleImage&>(image);
-            const auto& blurredGray = static_cast<const GrayscaleImage&>(*blurredResult.value());
-            auto& dstGray = static_cast<GrayscaleImage&>(*result);
-
-            for (int y = 0; y < image.getHeight(); ++y) {
-                for (int x = 0; x < image.getWidth(); ++x) {
-                    auto origResult = srcGray.getPixel(x, y);
-                    auto blurResult = blurredGray.getPixel(x, y);
-
-                    if (!origResult || !blurResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(
-                            ErrorCode::ProcessingFailed,
-                            "Failed to get pixel values for unsharp mask");
-                    }
-
-                    uint8_t srcValue = origResult.value();
-                    uint8_t blurValue = blurResult.value();
-
-                    // Calculate the difference for sharpening
-                    int diff = static_cast<int>(srcValue) - static_cast<int>(blurValue);
-
-                    // Apply threshold
-                    if (std::abs(diff) < m_threshold) {
-                        diff = 0;
-                    }
-
-                    // Apply sharpening with amount parameter
-                    int newValue = static_cast<int>(srcValue) + static_cast<int>(m_amount * diff);
-                    newValue = std::clamp(newValue, 0, 255);
-
-                    auto setResult = dstGray.setPixel(x, y, static_cast<uint8_t>(newValue));
-                    if (!setResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(setResult.error().code(),
-                                                                       setResult.error().message());
-                    }
-                }
-            }
-        } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
-            const auto& srcColor = static_cast<const ColorImage&>(image);
-            const auto& blurredColor = static_cast<const ColorImage&>(*blurredResult.value());
-            auto& dstColor = static_cast<ColorImage&>(*result);
-            bool hasAlpha = (image.getType() == Image::Type::RGBA);
-
-            for (int y = 0; y < image.getHeight(); ++y) {
-                for (int x = 0; x < image.getWidth(); ++x) {
-                    uint8_t srcR, srcG, srcB, srcA;
-                    uint8_t blurR, blurG, blurB, blurA;
-
-                    auto srcResult = srcColor.getPixel(x, y, srcR, srcG, srcB, srcA);
-                    auto blurResult = blurredColor.getPixel(x, y, blurR, blurG, blurB, blurA);
-
-                    if (!srcResult || !blurResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(
-                            ErrorCode::ProcessingFailed,
-                            "Failed to get pixel values for unsharp mask");
-                    }
-
-                    // Calculate differences for each channel
-                    int diffR = static_cast<int>(srcR) - static_cast<int>(blurR);
-                    int diffG = static_cast<int>(srcG) - static_cast<int>(blurG);
-                    int diffB = static_cast<int>(srcB) - static_cast<int>(blurB);
-
-                    // Apply thresholding
-                    if (std::abs(diffR) < m_threshold)
-                        diffR = 0;
-                    if (std::abs(diffG) < m_threshold)
-                        diffG = 0;
-                    if (std::abs(diffB) < m_threshold)
-                        diffB = 0;
-
-                    // Apply sharpening with amount parameter
-                    int newR = static_cast<int>(srcR) + static_cast<int>(m_amount * diffR);
-                    int newG = static_cast<int>(srcG) + static_cast<int>(m_amount * diffG);
-                    int newB = static_cast<int>(srcB) + static_cast<int>(m_amount * diffB);
-
-                    // Clamp to valid range
-                    newR = std::clamp(newR, 0, 255);
-                    newG = std::clamp(newG, 0, 255);
-                    newB = std::clamp(newB, 0, 255);
-
-                    auto setResult = dstColor.setPixel(x,
-                                                       y,
-                                                       static_cast<uint8_t>(newR),
-                                                       static_cast<uint8_t>(newG),
-                                                       static_cast<uint8_t>(newB),
-                                                       hasAlpha ? srcA : 255);
-
-                    if (!setResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(setResult.error().code(),
-                                                                       setResult.error().message());
-                    }
-                }
-            }
-        } else {
-            return makeErrorResult<std::unique_ptr<Image>>(
-                ErrorCode::UnsupportedFormat,
-                std::format("Unsupported image type for unsharp mask: {}",
-                            static_cast<int>(image.getType())));
+        auto status = sharpen(image.view(), image.view().bounds(), result->mutableView());
+        if (!status) {
+            return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                           status.error().message());
         }
-
         return makeSuccessResult(std::move(result));
     } catch (const std::exception& e) {
         return makeErrorResult<std::unique_ptr<Image>>(
@@ -147,6 +109,81 @@ Result<std::unique_ptr<Image>> UnsharpMaskFilter::apply(const Image& image) cons
     }
 }
 
+VoidResult UnsharpMaskFilter::applyTile(const ImageView& source,
+                                        const Rect& tile,
+                                        const MutableImageView& destination) const {
+    if (auto valid = validateTile(source, tile, destination); !valid) {
+        return valid;
+    }
+    try {
+        return sharpen(source, tile, destination);
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Unsharp mask failed: {}", e.what()));
+    }
+}
+
+VoidResult UnsharpMaskFilter::sharpen(const ImageView& source,
+                                      const Rect& tile,
+                                      const MutableImageView& destination) const {
+    if (source.getType() != Image::Type::Grayscale && source.getType() != Image::Type::RGB &&
+        source.getType() != Image::Type::RGBA) {
+        return makeVoidErrorResult(ErrorCode::UnsupportedFormat,
+                                   std::format("Unsupported image type for unsharp mask: {}",
+                                               static_cast<int>(source.getType())));
+    }
+    if (destination.getType() != source.getType() || destination.getDepth() != source.getDepth()) {
+        return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                   "Unsharp mask destination must match the source type");
+    }
+
+    // Alpha is not sharpened; it is copied from the source
+    const int channels = source.getChannels();
+    const int colorChannels = source.getType() == Image::Type::RGBA ? 3 : channels;
+    const std::size_t first = static_cast<std::size_t>(tile.x) * channels;
+    const std::size_t samples = static_cast<std::size_t>(tile.width) * channels;
+
+    // Each strip streams its blurred rows and sharpens them as they
+    // complete, so no blurred image is ever stored
+    MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+    ThreadPool* workers =
+        sharedPoolFor(static_cast<std::size_t>(tile.width) * static_cast<std::size_t>(tile.height));
+    const std::size_t parts =
+        std::min(workers ? workers->getThreadCount() : 1, static_cast<std::size_t>(tile.height));
+    std::vector<VoidResult> statuses(parts, makeVoidSuccessResult());
+
+    visitSampleType(source.getDepth(), [&]<typename T>(std::type_identity<T>) {
+        const PixelAccessor<T> src(source);
+        const MutablePixelAccessor<T> dst(destination);
+        forEachPart(workers, parts, [&](std::size_t part) {
+            const auto [y0, y1] =
+                partitionRange(static_cast<std::size_t>(tile.height), parts, part);
+            statuses[part] = m_blur.stream(
+                source, tile.y + static_cast<int>(y0), tile.y + static_cast<int>(y1),
+                [&](int y, std::span<const float> blurred) {
+                    sharpenRow(src.row(y) + first, blurred.subspan(first, samples),
+                               dst.row(y - tile.y), channels, colorChannels, m_amount,
+                               m_threshold);
+                });
+        });
+    });
+
+    for (const auto& status : statuses) {
+        if (!status) {
+            return makeVoidErrorResult(
+                status.error().code(),
+                std::format("Unsharp mask failed in blur step: {}", status.error().message()));
+        }
+    }
+    return makeVoidSuccessResult();
+}
+
+FilterFootprint UnsharpMaskFilter::getFootprint() const {
+    const int rx = m_blur.getRadiusX();
+    const int ry = m_blur.getRadiusY();
+    return {rx, ry, rx, ry};
+}
+
 std::string_view UnsharpMaskFilter::getName() const {
     return "UnsharpMaskFilter";
 }
@@ -1,9 +1,11 @@
 // src/IO/BMPImageIO.cpp
 #include "../../include/DIPAL/IO/BMPImageIO.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
 #include "../../include/DIPAL/Image/ColorImage.hpp"
 #include "../../include/DIPAL/Image/GrayscaleImage.hpp"
 #include "../../include/DIPAL/Image/ImageFactory.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <vector>
 #include <format>
@@ -112,7 +114,7 @@ Result<std::unique_ptr<Image>> BMPImageIO::load(std::string_view filename) {
             
             // Calculate row padding (BMP rows are padded to 4-byte boundaries)
             int rowSize = ((width * 3 + 3) / 4) * 4;
-            std::vector<uint8_t> rowData(rowSize);
+            IOBuffer<uint8_t> rowData(rowSize);
             
             // Seek to pixel data
             file.seekg(fileHeader.dataOffset);
@@ -130,17 +132,14 @@ Result<std::unique_ptr<Image>> BMPImageIO::load(std::string_view filename) {
                     );
                 }
                 
+                // BMP stores pixels in BGR order
+                auto dst = colorImage.getRow(readY);
+                const int channels = colorImage.getChannels();
                 for (int x = 0; x < width; ++x) {
-                    // BMP stores pixels in BGR order
-                    uint8_t b = rowData[x * 3];
-                    uint8_t g = rowData[x * 3 + 1];
-                    uint8_t r = rowData[x * 3 + 2];
-                    
-                    auto setResult = colorImage.setPixel(x, readY, r, g, b);
-                    auto checkResult = checkPixelResult<std::unique_ptr<Image>>(setResult,x,readY,nullptr);
-                    if (!checkResult) {
-                      return checkResult;
-                    }
+                    uint8_t* px = dst.data() + static_cast<size_t>(x) * channels;
+                    px[0] = rowData[x * 3 + 2];
+                    px[1] = rowData[x * 3 + 1];
+                    px[2] = rowData[x * 3];
                 }
             }
         } else if (infoHeader.bitsPerPixel == 8) {
@@ -164,7 +163,7 @@ Result<std::unique_ptr<Image>> BMPImageIO::load(std::string_view filename) {
                 
                 // Calculate row padding
                 int rowSize = ((width + 3) / 4) * 4;
-                std::vector<uint8_t> rowData(rowSize);
+                IOBuffer<uint8_t> rowData(rowSize);
                 
                 // Seek to pixel data
                 file.seekg(fileHeader.dataOffset);
@@ -216,7 +215,7 @@ Result<std::unique_ptr<Image>> BMPImageIO::load(std::string_view filename) {
                 
                 // Calculate row padding
                 int rowSize = ((width + 3) / 4) * 4;
-                std::vector<uint8_t> rowData(rowSize);
+                IOBuffer<uint8_t> rowData(rowSize);
                 
                 // Seek to pixel data
                 file.seekg(fileHeader.dataOffset);
@@ -234,16 +233,7 @@ Result<std::unique_ptr<Image>> BMPImageIO::load(std::string_view filename) {
                         );
                     }
                     
-                    for (int x = 0; x < width; ++x) {
-                        auto setResult = grayImage.setPixel(x, readY, rowData[x]);
-                        if (!setResult) {
-                          return makeErrorResult<std::unique_ptr<Image>>(
-                            setResult.error().code(),
-                            std::format("Failed to set pixel at ({}, {}): {}", 
-                            x, readY, setResult.error().message())
-                          );
-                        }
-                    }
+                    std::copy_n(rowData.begin(), width, grayImage.getRow(readY).begin());
                 }
             }
         }
@@ -258,6 +248,13 @@ Result<std::unique_ptr<Image>> BMPImageIO::load(std::string_view filename) {
 }
 
 VoidResult BMPImageIO::save(const Image& image, std::string_view filename) {
+    if (image.getDepth() != Image::Depth::UInt8) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            "BMP export requires 8-bit samples; use ImageFactory::convertDepth first"
+        );
+    }
+
     std::ofstream file(std::string(filename), std::ios::binary);
     if (!file) {
         return makeVoidErrorResult(
@@ -320,20 +317,11 @@ VoidResult BMPImageIO::save(const Image& image, std::string_view filename) {
             
             // Write pixel data
             const auto& grayImage = static_cast<const GrayscaleImage&>(image);
-            std::vector<uint8_t> rowData(rowSize, 0);  // Initialize with zeros for padding
+            IOBuffer<uint8_t> rowData(rowSize, 0);  // Initialize with zeros for padding
             
             for (int y = height - 1; y >= 0; --y) {  // Bottom-up
-                for (int x = 0; x < width; ++x) {
-                    auto result = grayImage.getPixel(x, y);
-                    if (!result) {
-                        return makeVoidErrorResult(
-                            result.error().code(),
-                            result.error().message()
-                        );
-                    }
-                    
-                    rowData[x] = result.value();
-                }
+                auto row = grayImage.getRow(y);
+                std::copy(row.begin(), row.end(), rowData.begin());
                 
                 file.write(reinterpret_cast<const char*>(rowData.data()), rowSize);
             }
@@ -352,23 +340,17 @@ VoidResult BMPImageIO::save(const Image& image, std::string_view filename) {
             
             // Write pixel data
             const auto& colorImage = static_cast<const ColorImage&>(image);
-            std::vector<uint8_t> rowData(rowSize, 0);  // Initialize with zeros for padding
+            IOBuffer<uint8_t> rowData(rowSize, 0);  // Initialize with zeros for padding
             
             for (int y = height - 1; y >= 0; --y) {  // Bottom-up
+                auto row = colorImage.getRow(y);
+                const int channels = colorImage.getChannels();
                 for (int x = 0; x < width; ++x) {
-                    uint8_t r, g, b, a;
-                    auto result = colorImage.getPixel(x, y, r, g, b, a);
-                    if (!result) {
-                        return makeVoidErrorResult(
-                            result.error().code(),
-                            result.error().message()
-                        );
-                    }
-                    
                     // BMP uses BGR order
-                    rowData[x * 3] = b;
-                    rowData[x * 3 + 1] = g;
-                    rowData[x * 3 + 2] = r;
+                    const uint8_t* px = row.data() + static_cast<size_t>(x) * channels;
+                    rowData[x * 3] = px[2];
+                    rowData[x * 3 + 1] = px[1];
+                    rowData[x * 3 + 2] = px[0];
                 }
                 
                 file.write(reinterpret_cast<const char*>(rowData.data()), rowSize);
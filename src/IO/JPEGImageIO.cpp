@@ -1,6 +1,7 @@
 // src/IO/JPEGImageIO.cpp
 #include "../../include/DIPAL/IO/JPEGImageIO.hpp"
 
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
 #include "../../include/DIPAL/Image/ColorImage.hpp"
 #include "../../include/DIPAL/Image/GrayscaleImage.hpp"
 #include "../../include/DIPAL/Image/ImageFactory.hpp"
@@ -121,7 +122,7 @@ Result<std::unique_ptr<Image>> JPEGImageIO::load(std::string_view filename) {
         }
 
         // Allocate buffer for one row
-        std::vector<JSAMPLE> buffer(width * channels);
+        IOBuffer<JSAMPLE> buffer(width * channels);
         JSAMPROW row_pointer[1] = {buffer.data()};
 
         // Process each scanline
@@ -192,6 +193,13 @@ Result<std::unique_ptr<Image>> JPEGImageIO::load(std::string_view filename) {
 }
 
 VoidResult JPEGImageIO::save(const Image& image, std::string_view filename, int quality) {
+    if (image.getDepth() != Image::Depth::UInt8) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            "JPEG export requires 8-bit samples; use ImageFactory::convertDepth first"
+        );
+    }
+
     // Clamp quality value
     quality = std::clamp(quality, 0, 100);
 
@@ -256,7 +264,7 @@ VoidResult JPEGImageIO::save(const Image& image, std::string_view filename, int
 
         // Create a buffer for one row
         int rowSize = cinfo.image_width * cinfo.input_components;
-        std::vector<JSAMPLE> buffer(rowSize);
+        IOBuffer<JSAMPLE> buffer(rowSize);
         JSAMPROW row_pointer[1] = {buffer.data()};
 
         // Process each scanline
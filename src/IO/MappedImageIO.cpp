@@ -0,0 +1,435 @@
+// src/IO/MappedImageIO.cpp
+#include "../../include/DIPAL/IO/MappedImageIO.hpp"
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Utils/MemoryUtils.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace DIPAL {
+
+namespace {
+
+constexpr char kRawMagic[8] = {'D', 'I', 'P', 'A', 'L', 'R', 'A', 'W'};
+constexpr uint32_t kRawVersion = 1;
+
+// Native raw header, stored in host byte order at the start of the file
+struct RawHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t dataOffset;
+    int32_t width;
+    int32_t height;
+    uint8_t type;
+    uint8_t depth;
+    uint8_t layout;
+    uint8_t reserved;
+    uint64_t stride;
+};
+static_assert(std::is_trivially_copyable_v<RawHeader>);
+static_assert(sizeof(RawHeader) <= MappedImageIO::kRawHeaderSize);
+
+int channelsOf(Image::Type type) {
+    switch (type) {
+        case Image::Type::RGB:
+            return 3;
+        case Image::Type::RGBA:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+// Stride an image of this geometry gets, so mapped rows line up with getRow()
+std::size_t strideFor(int width, Image::Type type, Image::Depth depth, Image::RowLayout layout) {
+    const std::size_t rowBytes = static_cast<std::size_t>(width) * channelsOf(type) *
+                                 Image::bytesPerSample(depth);
+    return layout == Image::RowLayout::Aligned
+               ? MemoryUtils::alignUp(rowBytes, Image::kRowAlignment)
+               : rowBytes;
+}
+
+// Bytes of stride * height rows, or nullopt if that does not fit in size_t
+std::optional<std::size_t> pixelBytes(std::size_t stride, int height) {
+    if (stride != 0 && static_cast<std::size_t>(height) > SIZE_MAX / stride) {
+        return std::nullopt;
+    }
+    return stride * static_cast<std::size_t>(height);
+}
+
+bool isMappableType(Image::Type type) {
+    return type == Image::Type::Grayscale || type == Image::Type::RGB ||
+           type == Image::Type::RGBA;
+}
+
+struct Mapping {
+    std::shared_ptr<uint8_t> base;  // Unmaps the file when the last owner goes
+    std::size_t size = 0;
+    bool writable = false;  // Writes reach the file (MAP_SHARED)
+};
+
+std::string systemError(int error) {
+    return std::generic_category().message(error);
+}
+
+#ifndef _WIN32
+// Map a whole file. A non-zero newSize creates or truncates the file to that
+// size first. Read-only access maps the file privately, so writes to the image
+// only change the process's copy of the touched pages.
+Result<Mapping> mapFile(const std::string& path,
+                        MappedImageIO::Access access,
+                        std::size_t newSize = 0) {
+    const bool writable = access == MappedImageIO::Access::ReadWrite;
+    const int flags = newSize > 0 ? (O_RDWR | O_CREAT | O_TRUNC) : (writable ? O_RDWR : O_RDONLY);
+
+    const int fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+        const int error = errno;
+        return makeErrorResult<Mapping>(
+            error == ENOENT ? ErrorCode::FileNotFound : ErrorCode::FileAccessDenied,
+            std::format("Failed to open {}: {}", path, systemError(error)));
+    }
+
+    std::size_t size = newSize;
+    if (newSize > 0) {
+        if (::ftruncate(fd, static_cast<off_t>(newSize)) != 0) {
+            const int error = errno;
+            ::close(fd);
+            return makeErrorResult<Mapping>(
+                ErrorCode::FileAccessDenied,
+                std::format("Failed to size {}: {}", path, systemError(error)));
+        }
+    } else {
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            return makeErrorResult<Mapping>(
+                ErrorCode::FileAccessDenied,
+                std::format("Failed to stat {}: {}", path, systemError(error)));
+        }
+        size = static_cast<std::size_t>(info.st_size);
+    }
+
+    if (size == 0) {
+        ::close(fd);
+        return makeErrorResult<Mapping>(ErrorCode::InvalidFormat,
+                                        std::format("Cannot map empty file: {}", path));
+    }
+
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                           writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    const int error = errno;
+    ::close(fd);  // The mapping keeps its own reference to the file
+
+    if (address == MAP_FAILED) {
+        return makeErrorResult<Mapping>(
+            ErrorCode::AllocationFailed,
+            std::format("Failed to map {}: {}", path, systemError(error)));
+    }
+
+    Mapping mapping;
+    mapping.base = std::shared_ptr<uint8_t>(static_cast<uint8_t*>(address),
+                                            [size](uint8_t* p) { ::munmap(p, size); });
+    mapping.size = size;
+    mapping.writable = writable;
+    return makeSuccessResult(std::move(mapping));
+}
+#else
+Result<Mapping> mapFile(const std::string& path,
+                        [[maybe_unused]] MappedImageIO::Access access,
+                        [[maybe_unused]] std::size_t newSize = 0) {
+    return makeErrorResult<Mapping>(
+        ErrorCode::NotImplemented,
+        std::format("Memory-mapped images are not supported on this platform: {}", path));
+}
+#endif
+
+// Turn a region of a mapping into an image; the image keeps the mapping alive
+Result<std::unique_ptr<Image>> wrapMapping(const Mapping& mapping,
+                                           std::size_t offset,
+                                           int width,
+                                           int height,
+                                           Image::Type type,
+                                           Image::Depth depth,
+                                           Image::RowLayout layout) {
+    const auto bytes = pixelBytes(strideFor(width, type, depth, layout), height);
+    if (!bytes) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::CorruptedData,
+            std::format("{}x{} image is larger than the address space", width, height));
+    }
+    // Compared as a subtraction so that offset + bytes cannot overflow
+    if (offset > mapping.size || mapping.size - offset < *bytes) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::CorruptedData,
+            std::format("File holds {} bytes of pixel data, {}x{} image needs {}",
+                        mapping.size - std::min(offset, mapping.size), width, height, *bytes));
+    }
+
+    std::shared_ptr<uint8_t> pixels(mapping.base, mapping.base.get() + offset);
+    PixelBuffer buffer(std::move(pixels), *bytes);
+    if (mapping.writable) {
+        // Copies of the image get their own pixels, so the image itself
+        // keeps writing to the file
+        buffer.setExclusive();
+    }
+    return ImageFactory::wrap(width, height, type, depth, layout, std::move(buffer));
+}
+
+// Parse a binary PGM/PPM header in memory; returns the offset of the pixel data
+Result<std::size_t> parsePnmHeader(const uint8_t* data,
+                                   std::size_t size,
+                                   Image::Type& type,
+                                   int& width,
+                                   int& height) {
+    std::size_t pos = 2;
+    type = data[1] == '5' ? Image::Type::Grayscale : Image::Type::RGB;
+
+    // Reads the next decimal field, skipping whitespace and comments
+    auto readNumber = [&](int& value) -> bool {
+        while (pos < size) {
+            if (data[pos] == '#') {
+                while (pos < size && data[pos] != '\n') {
+                    ++pos;
+                }
+            } else if (std::isspace(data[pos])) {
+                ++pos;
+            } else {
+                break;
+            }
+        }
+
+        long long number = 0;
+        const std::size_t start = pos;
+        while (pos < size && std::isdigit(data[pos]) && number <= INT32_MAX) {
+            number = number * 10 + (data[pos] - '0');
+            ++pos;
+        }
+        value = static_cast<int>(number);
+        return pos > start && number <= INT32_MAX;
+    };
+
+    int maxValue = 0;
+    if (!readNumber(width) || !readNumber(height) || !readNumber(maxValue) || pos >= size ||
+        !std::isspace(data[pos])) {
+        return makeErrorResult<std::size_t>(ErrorCode::InvalidFormat, "Invalid PGM/PPM header");
+    }
+
+    if (width <= 0 || height <= 0) {
+        return makeErrorResult<std::size_t>(
+            ErrorCode::InvalidFormat,
+            std::format("Invalid PGM/PPM dimensions: {}x{}", width, height));
+    }
+    if (maxValue != 255) {
+        return makeErrorResult<std::size_t>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Only 8-bit PGM/PPM files (maximum value 255) can be mapped, got {}",
+                        maxValue));
+    }
+
+    // Exactly one whitespace character separates the header from the pixels
+    return makeSuccessResult(pos + 1);
+}
+
+}  // namespace
+
+Result<std::unique_ptr<Image>> MappedImageIO::map(std::string_view filename, Access access) {
+    auto mapped = mapFile(std::string(filename), access);
+    if (!mapped) {
+        return makeErrorResult<std::unique_ptr<Image>>(mapped.error().code(),
+                                                       mapped.error().message());
+    }
+    const Mapping& mapping = mapped.value();
+    const uint8_t* data = mapping.base.get();
+
+    if (mapping.size >= sizeof(RawHeader) &&
+        std::memcmp(data, kRawMagic, sizeof(kRawMagic)) == 0) {
+        RawHeader header;
+        std::memcpy(&header, data, sizeof(header));
+
+        const auto type = static_cast<Image::Type>(header.type);
+        const auto depth = static_cast<Image::Depth>(header.depth);
+        const auto layout = static_cast<Image::RowLayout>(header.layout);
+
+        // Pixels anywhere but the page-aligned offset would leave aligned rows
+        // and wide samples misaligned, so no other offset is accepted
+
+        if (header.version != kRawVersion || !isMappableType(type) ||
+            header.depth > static_cast<uint8_t>(Image::Depth::Float32) ||
+            header.layout > static_cast<uint8_t>(Image::RowLayout::Aligned) ||
+            header.width <= 0 || header.height <= 0 ||
+            header.stride != strideFor(header.width, type, depth, layout) ||
+            header.dataOffset != kRawHeaderSize) {
+            return makeErrorResult<std::unique_ptr<Image>>(
+                ErrorCode::CorruptedData, std::format("Invalid raw image header: {}", filename));
+        }
+
+        return wrapMapping(mapping, header.dataOffset, header.width, header.height, type, depth,
+                           layout);
+    }
+
+    if (mapping.size >= 3 && data[0] == 'P' && (data[1] == '5' || data[1] == '6')) {
+        Image::Type type;
+        int width = 0;
+        int height = 0;
+        auto offset = parsePnmHeader(data, mapping.size, type, width, height);
+        if (!offset) {
+            return makeErrorResult<std::unique_ptr<Image>>(offset.error().code(),
+                                                           offset.error().message());
+        }
+        return wrapMapping(mapping, offset.value(), width, height, type, Image::Depth::UInt8,
+                           Image::RowLayout::Packed);
+    }
+
+    if (mapping.size >= 2 && data[0] == 'B' && data[1] == 'M') {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::UnsupportedFormat,
+            "BMP rows are stored bottom-up in BGR order and cannot be mapped; "
+            "use BMPImageIO::load");
+    }
+
+    return makeErrorResult<std::unique_ptr<Image>>(
+        ErrorCode::UnsupportedFormat,
+        std::format("Not a mappable image file (binary PGM/PPM or raw): {}", filename));
+}
+
+Result<std::unique_ptr<Image>> MappedImageIO::create(std::string_view filename,
+                                                     int width,
+                                                     int height,
+                                                     Image::Type type,
+                                                     Image::Depth depth,
+                                                     Image::RowLayout layout) {
+    if (width <= 0 || height <= 0) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
+    }
+    if (!isMappableType(type)) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Cannot map image type {}", static_cast<int>(type)));
+    }
+
+    const std::size_t stride = strideFor(width, type, depth, layout);
+    const auto bytes = pixelBytes(stride, height);
+    if (!bytes || *bytes > SIZE_MAX - kRawHeaderSize) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::InvalidParameter,
+            std::format("{}x{} image is larger than the address space", width, height));
+    }
+    auto mapped = mapFile(std::string(filename), Access::ReadWrite, kRawHeaderSize + *bytes);
+    if (!mapped) {
+        return makeErrorResult<std::unique_ptr<Image>>(mapped.error().code(),
+                                                       mapped.error().message());
+    }
+
+    RawHeader header{};
+    std::memcpy(header.magic, kRawMagic, sizeof(kRawMagic));
+    header.version = kRawVersion;
+    header.dataOffset = static_cast<uint32_t>(kRawHeaderSize);
+    header.width = width;
+    header.height = height;
+    header.type = static_cast<uint8_t>(type);
+    header.depth = static_cast<uint8_t>(depth);
+    header.layout = static_cast<uint8_t>(layout);
+    header.stride = stride;
+    std::memcpy(mapped.value().base.get(), &header, sizeof(header));
+
+    return wrapMapping(mapped.value(), kRawHeaderSize, width, height, type, depth, layout);
+}
+
+VoidResult MappedImageIO::saveRaw(const Image& image, std::string_view filename) {
+    if (image.isEmpty() || !isMappableType(image.getType())) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type for raw files: {}",
+                        static_cast<int>(image.getType())));
+    }
+
+    std::ofstream file(std::string(filename), std::ios::binary);
+    if (!file) {
+        return makeVoidErrorResult(ErrorCode::FileAccessDenied,
+                                   std::format("Failed to create file: {}", filename));
+    }
+
+    RawHeader header{};
+    std::memcpy(header.magic, kRawMagic, sizeof(kRawMagic));
+    header.version = kRawVersion;
+    header.dataOffset = static_cast<uint32_t>(kRawHeaderSize);
+    header.width = image.getWidth();
+    header.height = image.getHeight();
+    header.type = static_cast<uint8_t>(image.getType());
+    header.depth = static_cast<uint8_t>(image.getDepth());
+    header.layout = static_cast<uint8_t>(image.getRowLayout());
+    header.stride = image.getStride();
+
+    std::vector<char> block(kRawHeaderSize, 0);
+    std::memcpy(block.data(), &header, sizeof(header));
+    file.write(block.data(), static_cast<std::streamsize>(block.size()));
+
+    // Rows are written with their padding so the file matches the in-memory stride
+    const std::size_t padding = image.getStride() - image.getRowBytes();
+    const std::vector<char> zeros(padding, 0);
+    for (int y = 0; y < image.getHeight(); ++y) {
+        auto row = image.getRow(y);
+        file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        file.write(zeros.data(), static_cast<std::streamsize>(padding));
+    }
+
+    if (!file) {
+        return makeVoidErrorResult(ErrorCode::FileAccessDenied,
+                                   std::format("Failed to write file: {}", filename));
+    }
+    return makeVoidSuccessResult();
+}
+
+VoidResult MappedImageIO::flush(const Image& image) {
+#ifndef _WIN32
+    if (image.isEmpty()) {
+        return makeVoidSuccessResult();
+    }
+    // Only read-write mappings are exclusive, and copies never take them over;
+    // anything else holds pixels the file will never see
+    if (!image.hasExclusiveData()) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            "Image pixels are not a read-write file mapping; nothing would reach the file");
+    }
+
+    // msync wants a page-aligned start; extend the range down to the page boundary
+    const auto pageSize = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = reinterpret_cast<std::uintptr_t>(image.getData());
+    const std::uintptr_t pageStart = start & ~(pageSize - 1);
+    const std::size_t length = image.getDataSize() + (start - pageStart);
+
+    if (::msync(reinterpret_cast<void*>(pageStart), length, MS_SYNC) != 0) {
+        const int error = errno;
+        return makeVoidErrorResult(ErrorCode::FileAccessDenied,
+                                   std::format("Failed to flush mapped image: {}", systemError(error)));
+    }
+    return makeVoidSuccessResult();
+#else
+    static_cast<void>(image);
+    return makeVoidErrorResult(ErrorCode::NotImplemented,
+                               "Memory-mapped images are not supported on this platform");
+#endif
+}
+
+}  // namespace DIPAL
@@ -1,5 +1,6 @@
 // src/IO/PPMImageIO.cpp
 #include "../../include/DIPAL/IO/PPMImageIO.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
 #include "../../include/DIPAL/Image/ColorImage.hpp"
 #include "../../include/DIPAL/Image/GrayscaleImage.hpp"
 #include "../../include/DIPAL/Image/ImageFactory.hpp"
@@ -127,38 +128,25 @@ Result<std::unique_ptr<Image>> PPMImageIO::load(std::string_view filename) {
                     }
                 }
             } else if (magicNumber == "P6") {
-                // Binary format
-                std::vector<uint8_t> data(width * height * 3);
-                file.read(reinterpret_cast<char*>(data.data()), data.size());
-                
-                if (file.gcount() != static_cast<std::streamsize>(data.size())) {
-                    return makeErrorResult<std::unique_ptr<Image>>(
-                        ErrorCode::InvalidFormat,
-                        "Failed to read complete pixel data"
-                    );
-                }
-                
+                // Binary format, read row by row straight into the (possibly padded) rows
+                const size_t rowBytes = static_cast<size_t>(width) * 3;
+
                 for (int y = 0; y < height; ++y) {
-                    for (int x = 0; x < width; ++x) {
-                        size_t idx = (y * width + x) * 3;
-                        uint8_t r = data[idx];
-                        uint8_t g = data[idx + 1];
-                        uint8_t b = data[idx + 2];
-                        
-                        // Normalize values if needed
-                        if (maxValue != 255) {
-                            r = static_cast<uint8_t>((static_cast<float>(r) / maxValue) * 255);
-                            g = static_cast<uint8_t>((static_cast<float>(g) / maxValue) * 255);
-                            b = static_cast<uint8_t>((static_cast<float>(b) / maxValue) * 255);
-                        }
-                    auto setResult = colorImage.setPixel(x, y, r, g, b);
-                    if (!setResult) {
-                      return makeErrorResult<std::unique_ptr<Image>>(
-                          setResult.error().code(),
-                          std::format("Failed to set pixel at ({}, {}): {}", 
-                          x, y, setResult.error().message())
+                    auto row = colorImage.getRow(y);
+                    file.read(reinterpret_cast<char*>(row.data()), rowBytes);
+
+                    if (file.gcount() != static_cast<std::streamsize>(rowBytes)) {
+                        return makeErrorResult<std::unique_ptr<Image>>(
+                            ErrorCode::InvalidFormat,
+                            "Failed to read complete pixel data"
                         );
-                      }
+                    }
+
+                    // Normalize values if needed
+                    if (maxValue != 255) {
+                        for (auto& v : row) {
+                            v = static_cast<uint8_t>((static_cast<float>(v) / maxValue) * 255);
+                        }
                     }
                 }
             }
@@ -204,37 +192,25 @@ Result<std::unique_ptr<Image>> PPMImageIO::load(std::string_view filename) {
                   }
                 }
             } else if (magicNumber == "P5") {
-                // Binary format
-                std::vector<uint8_t> data(width * height);
-                file.read(reinterpret_cast<char*>(data.data()), data.size());
-                
-                if (file.gcount() != static_cast<std::streamsize>(data.size())) {
-                    return makeErrorResult<std::unique_ptr<Image>>(
-                        ErrorCode::InvalidFormat,
-                        "Failed to read complete pixel data"
-                    );
-                }
-                
+                // Binary format, read row by row straight into the (possibly padded) rows
+                const size_t rowBytes = static_cast<size_t>(width);
+
                 for (int y = 0; y < height; ++y) {
-                    for (int x = 0; x < width; ++x) {
-                        size_t idx = y * width + x;
-                        uint8_t g = data[idx];
-                        
-                        // Normalize values if needed
-                        if (maxValue != 255) {
-                            g = static_cast<uint8_t>((static_cast<float>(g) / maxValue) * 255);
-                        }
-                        
+                    auto row = grayImage.getRow(y);
+                    file.read(reinterpret_cast<char*>(row.data()), rowBytes);
 
-                        auto setResult = grayImage.setPixel(x, y, g);
-                        if (!setResult) {
-                          return makeErrorResult<std::unique_ptr<Image>>(
-                          setResult.error().code(),
-                          std::format("Failed to set pixel at ({}, {}): {}", 
-                            x, y, setResult.error().message())
-                          );
-                      }
+                    if (file.gcount() != static_cast<std::streamsize>(rowBytes)) {
+                        return makeErrorResult<std::unique_ptr<Image>>(
+                            ErrorCode::InvalidFormat,
+                            "Failed to read complete pixel data"
+                        );
+                    }
 
+                    // Normalize values if needed
+                    if (maxValue != 255) {
+                        for (auto& v : row) {
+                            v = static_cast<uint8_t>((static_cast<float>(v) / maxValue) * 255);
+                        }
                     }
                 }
             }
@@ -255,6 +231,13 @@ Result<std::unique_ptr<Image>> PPMImageIO::load(std::string_view filename) {
 }
 
 VoidResult PPMImageIO::save(const Image& image, std::string_view filename) {
+    if (image.getDepth() != Image::Depth::UInt8) {
+        return makeVoidErrorResult(
+            ErrorCode::UnsupportedFormat,
+            "PPM export requires 8-bit samples; use ImageFactory::convertDepth first"
+        );
+    }
+
     std::ofstream file(std::string(filename), std::ios::binary);
     if (!file) {
         return makeVoidErrorResult(
@@ -276,20 +259,10 @@ VoidResult PPMImageIO::save(const Image& image, std::string_view filename) {
             
             const auto& grayImage = static_cast<const GrayscaleImage&>(image);
             
-            // Write pixel data
+            // Write pixel data one row at a time, skipping any row padding
             for (int y = 0; y < height; ++y) {
-                for (int x = 0; x < width; ++x) {
-                    auto result = grayImage.getPixel(x, y);
-                    if (!result) {
-                        return makeVoidErrorResult(
-                            result.error().code(),
-                            result.error().message()
-                        );
-                    }
-                    
-                    uint8_t pixel = result.value();
-                    file.write(reinterpret_cast<const char*>(&pixel), 1);
-                }
+                auto row = grayImage.getRow(y);
+                file.write(reinterpret_cast<const char*>(row.data()), row.size());
             }
         } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
             // Save as PPM (P6 - binary)
@@ -299,21 +272,25 @@ VoidResult PPMImageIO::save(const Image& image, std::string_view filename) {
             
             const auto& colorImage = static_cast<const ColorImage&>(image);
             
-            // Write pixel data (ignore alpha)
+            // Write pixel data one row at a time (ignore alpha)
+            const int channels = colorImage.getChannels();
+            IOBuffer<uint8_t> rowData(static_cast<size_t>(width) * 3);
+
             for (int y = 0; y < height; ++y) {
+                auto row = colorImage.getRow(y);
+
+                if (channels == 3) {
+                    file.write(reinterpret_cast<const char*>(row.data()), row.size());
+                    continue;
+                }
+
                 for (int x = 0; x < width; ++x) {
-                    uint8_t r, g, b, a;
-                    auto result = colorImage.getPixel(x, y, r, g, b, a);
-                    if (!result) {
-                        return makeVoidErrorResult(
-                            result.error().code(),
-                            result.error().message()
-                        );
-                    }
-                    
-                    uint8_t pixels[3] = {r, g, b};
-                    file.write(reinterpret_cast<const char*>(pixels), 3);
+                    const uint8_t* px = row.data() + static_cast<size_t>(x) * channels;
+                    rowData[x * 3] = px[0];
+                    rowData[x * 3 + 1] = px[1];
+                    rowData[x * 3 + 2] = px[2];
                 }
+                file.write(reinterpret_cast<const char*>(rowData.data()), rowData.size());
             }
         } else {
             return makeVoidErrorResult(
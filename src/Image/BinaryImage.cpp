@@ -6,17 +6,87 @@
 #include <algorithm>
 #include <bit>
 #include <cmath>
+#include <cstring>
 #include <format>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace DIPAL {
 
-BinaryImage::BinaryImage(int width, int height) : Image(width, height, Type::Binary) {
-    // Binary images are packed with 8 pixels per byte, so we adjust the storage size
-    // We need to ceil(width / 8) bytes per row
-    int bytesPerRow = getBytesPerRow();
+namespace {
+
+// Rows are processed as 64-pixel words; loads and stores go through memcpy
+// because packed rows start at any byte offset
+constexpr std::size_t kWordBits = 64;
+constexpr std::size_t kWordBytes = sizeof(uint64_t);
+
+inline uint64_t loadWord(const uint8_t* p) noexcept {
+    uint64_t word;
+    std::memcpy(&word, p, kWordBytes);
+    return word;
+}
+
+inline void storeWord(uint8_t* p, uint64_t word) noexcept {
+    std::memcpy(p, &word, kWordBytes);
+}
 
-    // Reallocate data storage with the correct size
-    m_data.resize(static_cast<size_t>(bytesPerRow) * height);
+// Mask of the valid bits in the last byte of a row (0xFF when the width is a multiple of 8)
+inline uint8_t tailMask(std::size_t width) noexcept {
+    const std::size_t extraBits = width % 8;
+    return extraBits == 0 ? uint8_t{0xFF} : static_cast<uint8_t>((1u << extraBits) - 1);
+}
+
+// Threshold 64 samples into one word, bit i = sample i
+inline uint64_t thresholdWord(const uint8_t* src, uint8_t threshold) noexcept {
+#if defined(__AVX2__)
+    // Unsigned src >= t  <=>  max(src, t) == src
+    const __m256i t = _mm256_set1_epi8(static_cast<char>(threshold));
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+    const auto lo = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(a, t), a)));
+    const auto hi = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(b, t), b)));
+    return static_cast<uint64_t>(lo) | (static_cast<uint64_t>(hi) << 32);
+#elif defined(__SSE2__)
+    const __m128i t = _mm_set1_epi8(static_cast<char>(threshold));
+    uint64_t word = 0;
+    for (int i = 0; i < 4; ++i) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16 * i));
+        const auto bits =
+            static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, t), v)));
+        word |= static_cast<uint64_t>(bits) << (16 * i);
+    }
+    return word;
+#else
+    uint64_t word = 0;
+    for (std::size_t i = 0; i < kWordBits; ++i) {
+        word |= static_cast<uint64_t>(src[i] >= threshold) << i;
+    }
+    return word;
+#endif
+}
+
+// Writes bits [0, bytes * 8) of word to dst in row byte order
+inline void storeWordBytes(uint8_t* dst, uint64_t word, std::size_t bytes) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(dst, &word, bytes);
+    } else {
+        for (std::size_t i = 0; i < bytes; ++i) {
+            dst[i] = static_cast<uint8_t>(word >> (8 * i));
+        }
+    }
+}
+
+}  // namespace
+
+BinaryImage::BinaryImage(int width, int height, RowLayout layout)
+    : Image(width, height, Type::Binary, layout) {
+    // The base class already sized each row as ceil(width / 8) bytes (plus padding)
 
     // Override the bytesPerPixel value set by base constructor since we're bit-packed
     m_bytesPerPixel = 0;  // Not applicable for bit-packed images
@@ -32,7 +102,7 @@ Result<bool> BinaryImage::getPixel(int x, int y) const {
     uint8_t bitMask = getBitMask(x);
 
     // Check if the bit is set (1 = white, 0 = black)
-    return makeSuccessResult((m_data[byteIndex] & bitMask) != 0);
+    return makeSuccessResult((m_data.data()[byteIndex] & bitMask) != 0);
 }
 
 VoidResult BinaryImage::setPixel(int x, int y, bool value) {
@@ -45,86 +115,59 @@ VoidResult BinaryImage::setPixel(int x, int y, bool value) {
 
     if (value) {
         // Set the bit (white pixel)
-        m_data[byteIndex] |= bitMask;
+        mutablePixels()[byteIndex] |= bitMask;
     } else {
         // Clear the bit (black pixel)
-        m_data[byteIndex] &= ~bitMask;
+        mutablePixels()[byteIndex] &= ~bitMask;
     }
 
     return makeVoidSuccessResult();
 }
 
 std::unique_ptr<Image> BinaryImage::clone() const {
-    auto cloned = std::make_unique<BinaryImage>(m_width, m_height);
-    std::copy(m_data.begin(), m_data.end(), cloned->m_data.begin());
-    return cloned;
-}
-
-std::span<const uint8_t> BinaryImage::getRow(int y) const {
-    if (y < 0 || y >= m_height) {
-        return std::span<const uint8_t>();  // Return empty span for invalid row
-    }
-
-    int bytesPerRow = getBytesPerRow();
-    const uint8_t* rowStart = m_data.data() + static_cast<size_t>(y) * bytesPerRow;
-    return std::span<const uint8_t>(rowStart, bytesPerRow);
-}
-
-std::span<uint8_t> BinaryImage::getRow(int y) {
-    if (y < 0 || y >= m_height) {
-        return std::span<uint8_t>();  // Return empty span for invalid row
-    }
-
-    int bytesPerRow = getBytesPerRow();
-    uint8_t* rowStart = m_data.data() + static_cast<size_t>(y) * bytesPerRow;
-    return std::span<uint8_t>(rowStart, bytesPerRow);
+    // The clone shares the pixel buffer until either image is written to
+    return std::make_unique<BinaryImage>(*this);
 }
 
 int BinaryImage::getBytesPerRow() const {
-    return (m_width + 7) / 8;  // Ceiling division for bit packing (8 pixels per byte)
+    return static_cast<int>(getRowBytes());  // ceil(width / 8) for bit packing
 }
 
 VoidResult BinaryImage::invert() {
-    // Invert all bits in the image
-    for (auto& byte : m_data) {
-        byte = ~byte;
-    }
+    const std::size_t bytesPerRow = getRowBytes();
+    const std::size_t words = bytesPerRow / kWordBytes;
+    const uint8_t lastMask = tailMask(static_cast<std::size_t>(m_width));
+    uint8_t* pixels = mutablePixels();
 
-    // If the image width is not a multiple of 8, we need to clean up the unused bits
-    // in the last byte of each row to avoid counting them in operations like countWhitePixels
-    int extraBits = m_width % 8;
-    if (extraBits != 0) {
-        int bytesPerRow = getBytesPerRow();
-        uint8_t mask = static_cast<uint8_t>((1 << extraBits) - 1);  // Mask for used bits
+    for (int y = 0; y < m_height; ++y) {
+        uint8_t* row = pixels + static_cast<std::size_t>(y) * m_stride;
 
-        for (int y = 0; y < m_height; ++y) {
-            size_t lastByteIndex = static_cast<size_t>(y) * bytesPerRow + bytesPerRow - 1;
-            m_data[lastByteIndex] &= mask;  // Zero out unused bits
+        // Invert whole words, then the remaining bytes (row padding is left untouched)
+        for (std::size_t w = 0; w < words; ++w) {
+            storeWord(row + w * kWordBytes, ~loadWord(row + w * kWordBytes));
         }
+        for (std::size_t i = words * kWordBytes; i < bytesPerRow; ++i) {
+            row[i] = static_cast<uint8_t>(~row[i]);
+        }
+
+        // Bits past the width must stay zero so counts and comparisons ignore them
+        row[bytesPerRow - 1] &= lastMask;
     }
 
     return makeVoidSuccessResult();
 }
 
 VoidResult BinaryImage::fill(bool value) {
-    // Set all bytes to 0x00 (all black) or 0xFF (all white)
-    std::fill(m_data.begin(), m_data.end(), value ? 0xFF : 0x00);
-
-    // If the image width is not a multiple of 8, we need to clean up the unused bits
-    // in the last byte of each row
-    int extraBits = m_width % 8;
-    if (extraBits != 0) {
-        int bytesPerRow = getBytesPerRow();
-        uint8_t mask = static_cast<uint8_t>((1 << extraBits) - 1);  // Mask for used bits
-
-        for (int y = 0; y < m_height; ++y) {
-            size_t lastByteIndex = static_cast<size_t>(y) * bytesPerRow + bytesPerRow - 1;
-            if (value) {
-                m_data[lastByteIndex] &= mask;  // Keep the used bits, zero out unused bits
-            } else {
-                // Already zeroed
-            }
-        }
+    const std::size_t bytesPerRow = getRowBytes();
+    const uint8_t lastMask = tailMask(static_cast<std::size_t>(m_width));
+    uint8_t* pixels = mutablePixels();
+
+    for (int y = 0; y < m_height; ++y) {
+        uint8_t* row = pixels + static_cast<std::size_t>(y) * m_stride;
+
+        // memset stores whole words (and vectors) for all but the smallest rows
+        std::memset(row, value ? 0xFF : 0x00, bytesPerRow);
+        row[bytesPerRow - 1] &= lastMask;
     }
 
     return makeVoidSuccessResult();
@@ -132,30 +175,53 @@ VoidResult BinaryImage::fill(bool value) {
 
 size_t BinaryImage::countWhitePixels() const {
     size_t count = 0;
+    for (int y = 0; y < m_height; ++y) {
+        count += countRow(rowPtr(y), static_cast<std::size_t>(m_width));
+    }
+    return count;
+}
 
-    // For each byte, count the number of bits set to 1 (white pixels)
-    for (size_t i = 0; i < m_data.size(); ++i) {
-        count += std::popcount(m_data[i]);
+void BinaryImage::thresholdRow(const uint8_t* src, uint8_t* dst, std::size_t width,
+                               uint8_t threshold, bool invert) noexcept {
+    const uint64_t flip = invert ? ~uint64_t{0} : 0;
+
+    std::size_t x = 0;
+    for (; x + kWordBits <= width; x += kWordBits) {
+        storeWordBytes(dst + x / 8, thresholdWord(src + x, threshold) ^ flip, kWordBytes);
     }
 
-    // If the image width is not a multiple of 8, we need to subtract the count for unused bits
-    // in the last byte of each row
-    int extraBits = m_width % 8;
-    if (extraBits != 0) {
-        [[maybe_unused]] int unusedBits = 8 - extraBits;
-        int bytesPerRow = getBytesPerRow();
-
-        for (int y = 0; y < m_height; ++y) {
-            size_t lastByteIndex = static_cast<size_t>(y) * bytesPerRow + bytesPerRow - 1;
-            uint8_t lastByte = m_data[lastByteIndex];
-
-            // Count only the bits corresponding to actual pixels
-            uint8_t maskedByte = lastByte & ((1 << extraBits) - 1);
-            uint8_t unusedBitCount = std::popcount(lastByte) - std::popcount(maskedByte);
-            count -= unusedBitCount;
+    // Row tail: fewer than 64 pixels, written as whole bytes with the unused bits cleared
+    const std::size_t remaining = width - x;
+    if (remaining > 0) {
+        uint64_t word = 0;
+        for (std::size_t i = 0; i < remaining; ++i) {
+            word |= static_cast<uint64_t>(src[x + i] >= threshold) << i;
         }
+        word = (word ^ flip) & (~uint64_t{0} >> (kWordBits - remaining));
+        storeWordBytes(dst + x / 8, word, (remaining + 7) / 8);
+    }
+}
+
+std::size_t BinaryImage::countRow(const uint8_t* row, std::size_t width) noexcept {
+    const std::size_t words = width / kWordBits;
+
+    // Byte order does not matter for counting, so full words are used as loaded
+    std::size_t count = 0;
+    for (std::size_t w = 0; w < words; ++w) {
+        count += static_cast<std::size_t>(std::popcount(loadWord(row + w * kWordBytes)));
     }
 
+    // Row tail: assemble the remaining bytes in bit order and drop the bits past the width
+    const std::size_t remaining = width % kWordBits;
+    if (remaining > 0) {
+        const uint8_t* tail = row + words * kWordBytes;
+        uint64_t word = 0;
+        for (std::size_t i = 0; i < (remaining + 7) / 8; ++i) {
+            word |= static_cast<uint64_t>(tail[i]) << (8 * i);
+        }
+        word &= ~uint64_t{0} >> (kWordBits - remaining);
+        count += static_cast<std::size_t>(std::popcount(word));
+    }
     return count;
 }
 
@@ -163,30 +229,12 @@ Result<std::unique_ptr<BinaryImage>> BinaryImage::fromGrayscale(const GrayscaleI
                                                                 uint8_t threshold,
                                                                 bool invert) {
     try {
-        auto result = std::make_unique<BinaryImage>(image.getWidth(), image.getHeight());
+        auto result = std::make_unique<BinaryImage>(image.getWidth(), image.getHeight(),
+                                                    image.getRowLayout());
 
+        const auto width = static_cast<std::size_t>(image.getWidth());
         for (int y = 0; y < image.getHeight(); ++y) {
-            for (int x = 0; x < image.getWidth(); ++x) {
-                auto pixelResult = image.getPixel(x, y);
-                if (!pixelResult) {
-                    return makeErrorResult<std::unique_ptr<BinaryImage>>(
-                        pixelResult.error().code(), pixelResult.error().message());
-                }
-
-                uint8_t pixelValue = pixelResult.value();
-                bool isWhite = (pixelValue >= threshold);
-
-                // Apply inversion if requested
-                if (invert) {
-                    isWhite = !isWhite;
-                }
-
-                auto setResult = result->setPixel(x, y, isWhite);
-                if (!setResult) {
-                    return makeErrorResult<std::unique_ptr<BinaryImage>>(
-                        setResult.error().code(), setResult.error().message());
-                }
-            }
+            thresholdRow(image.getRow(y).data(), result->rowPtr(y), width, threshold, invert);
         }
 
         return makeSuccessResult(std::move(result));
@@ -202,8 +250,7 @@ int BinaryImage::getBitIndex(int x, int y) const {
 }
 
 int BinaryImage::getByteIndex(int x, int y) const {
-    int bytesPerRow = getBytesPerRow();
-    return (y * bytesPerRow) + (x / 8);
+    return static_cast<int>(static_cast<size_t>(y) * m_stride) + (x / 8);
 }
 
 uint8_t BinaryImage::getBitMask(int x) const {
@@ -1,28 +1,33 @@
 // src/Image/ColorImage.cpp
 #include "../../include/DIPAL/Image/ColorImage.hpp"
 #include "../../include/DIPAL/Image/GrayscaleImage.hpp"
+#include "../../include/DIPAL/Image/PlanarImage.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 namespace DIPAL {
 
-ColorImage::ColorImage(int width, int height, bool hasAlpha)
-    : Image(width, height, hasAlpha ? Type::RGBA : Type::RGB) {}
+ColorImage::ColorImage(int width, int height, bool hasAlpha, RowLayout layout)
+    : Image(width, height, hasAlpha ? Type::RGBA : Type::RGB, layout) {}
+
+ColorImage::ColorImage(int width, int height, bool hasAlpha, RowLayout layout, PixelBuffer buffer)
+    : Image(width, height, hasAlpha ? Type::RGBA : Type::RGB, Depth::UInt8, layout,
+            std::move(buffer)) {}
 
 VoidResult ColorImage::getPixel(int x, int y, uint8_t& r, uint8_t& g, uint8_t& b, uint8_t& a) const {
     if (!Image::isValidCoordinate(x, y)) {
         return makeVoidErrorResult(ErrorCode::OutOfRange, "Pixel coordinates out of range");
     }
 
-    size_t idx = static_cast<size_t>(y) * m_width * m_bytesPerPixel + 
-                 static_cast<size_t>(x) * m_bytesPerPixel;
-                 
-    r = m_data[idx];
-    g = m_data[idx + 1];
-    b = m_data[idx + 2];
+    const uint8_t* pixel = rowPtr(y) + static_cast<size_t>(x) * m_bytesPerPixel;
+
+    r = pixel[0];
+    g = pixel[1];
+    b = pixel[2];
 
-    if (hasAlpha() && idx + 3 < m_data.size()) {
-        a = m_data[idx + 3];
+    if (hasAlpha()) {
+        a = pixel[3];
     } else {
         a = 255;  // Default alpha is fully opaque
     }
@@ -35,15 +40,14 @@ VoidResult ColorImage::setPixel(int x, int y, uint8_t r, uint8_t g, uint8_t b, u
         return makeVoidErrorResult(ErrorCode::OutOfRange, "Pixel coordinates out of range");
     }
 
-    size_t idx = static_cast<size_t>(y) * m_width * m_bytesPerPixel + 
-                 static_cast<size_t>(x) * m_bytesPerPixel;
-                 
-    m_data[idx] = r;
-    m_data[idx + 1] = g;
-    m_data[idx + 2] = b;
+    uint8_t* pixel = rowPtr(y) + static_cast<size_t>(x) * m_bytesPerPixel;
 
-    if (hasAlpha() && idx + 3 < m_data.size()) {
-        m_data[idx + 3] = a;
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+
+    if (hasAlpha()) {
+        pixel[3] = a;
     }
     
     return makeVoidSuccessResult();
@@ -61,30 +65,26 @@ Result<std::unique_ptr<GrayscaleImage>> ColorImage::getChannel(int channel) cons
         );
     }
     
-    auto channelImage = std::make_unique<GrayscaleImage>(m_width, m_height);
-    
+    auto channelImage = std::make_unique<GrayscaleImage>(m_width, m_height, m_rowLayout);
+
     for (int y = 0; y < m_height; ++y) {
+        const uint8_t* src = rowPtr(y) + channel;
+        auto dst = channelImage->getRow(y);
         for (int x = 0; x < m_width; ++x) {
-            size_t srcIdx = static_cast<size_t>(y) * m_width * m_bytesPerPixel + 
-                           static_cast<size_t>(x) * m_bytesPerPixel + channel;
-            
-            auto result = channelImage->setPixel(x, y, m_data[srcIdx]);
-            if (!result) {
-                return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
-                    result.error().code(),
-                    result.error().message()
-                );
-            }
+            dst[x] = src[static_cast<size_t>(x) * m_bytesPerPixel];
         }
     }
     
     return makeSuccessResult(std::move(channelImage));
 }
 
+Result<std::unique_ptr<PlanarImage>> ColorImage::toPlanar(RowLayout layout) const {
+    return PlanarImage::fromInterleaved(view(), layout);
+}
+
 std::unique_ptr<Image> ColorImage::clone() const {
-    auto cloned = std::make_unique<ColorImage>(m_width, m_height, hasAlpha());
-    std::copy(m_data.begin(), m_data.end(), cloned->m_data.begin());
-    return cloned;
+    // The clone shares the pixel buffer until either image is written to
+    return std::make_unique<ColorImage>(*this);
 }
 
 
@@ -1,9 +1,14 @@
 // src/Image/Image.cpp
 #include "../../include/DIPAL/Image/Image.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Image/ImageAllocator.hpp"
+#include "../../include/DIPAL/Image/ImageView.hpp"
+#include "../../include/DIPAL/Utils/MemoryUtils.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <format>
@@ -13,8 +18,13 @@ namespace DIPAL {
 
 Image::Image(const Image &other)
     : m_width(other.m_width), m_height(other.m_height), m_type(other.m_type),
-      m_channels(other.m_channels), m_bytesPerPixel(other.m_bytesPerPixel) {
+      m_depth(other.m_depth), m_channels(other.m_channels), m_bytesPerPixel(other.m_bytesPerPixel),
+      m_rowLayout(other.m_rowLayout), m_stride(other.m_stride) {
   m_data = other.m_data;
+  // Writes to an exclusive buffer must keep reaching it from the original
+  if (m_data.isExclusive()) {
+    detachData();
+  }
 }
 
 Image &Image::operator=(const Image &other) {
@@ -22,21 +32,29 @@ Image &Image::operator=(const Image &other) {
     m_width = other.m_width;
     m_height = other.m_height;
     m_type = other.m_type;
+    m_depth = other.m_depth;
     m_channels = other.m_channels;
     m_bytesPerPixel = other.m_bytesPerPixel;
+    m_rowLayout = other.m_rowLayout;
+    m_stride = other.m_stride;
     m_data = other.m_data;
+    if (m_data.isExclusive()) {
+      detachData();
+    }
   }
   return *this;
 }
 
 Image::Image(Image &&other) noexcept
     : m_width(other.m_width), m_height(other.m_height), m_type(other.m_type),
-      m_channels(other.m_channels), m_bytesPerPixel(other.m_bytesPerPixel),
+      m_depth(other.m_depth), m_channels(other.m_channels), m_bytesPerPixel(other.m_bytesPerPixel),
+      m_rowLayout(other.m_rowLayout), m_stride(other.m_stride),
       m_data(std::move(other.m_data)) {
   other.m_width = 0;
   other.m_height = 0;
   other.m_channels = 0;
   other.m_bytesPerPixel = 0;
+  other.m_stride = 0;
 }
 
 Image &Image::operator=(Image &&other) noexcept {
@@ -44,23 +62,56 @@ Image &Image::operator=(Image &&other) noexcept {
     m_width = other.m_width;
     m_height = other.m_height;
     m_type = other.m_type;
+    m_depth = other.m_depth;
     m_channels = other.m_channels;
     m_bytesPerPixel = other.m_bytesPerPixel;
+    m_rowLayout = other.m_rowLayout;
+    m_stride = other.m_stride;
     m_data = std::move(other.m_data);
 
     other.m_width = 0;
     other.m_height = 0;
     other.m_channels = 0;
     other.m_bytesPerPixel = 0;
+    other.m_stride = 0;
   }
   return *this;
 }
 
-Image::Image(int width, int height, Type type)
-    : m_width(width), m_height(height), m_type(type) {
-  if (width <= 0 || height <= 0) {
+Image::Image(int width, int height, Type type, RowLayout layout)
+    : Image(width, height, type, Depth::UInt8, layout) {}
+
+Image::Image(int width, int height, Type type, Depth depth, RowLayout layout)
+    : m_width(width), m_height(height), m_type(type), m_depth(depth),
+      m_rowLayout(layout), m_stride(0) {
+  initGeometry(type, depth, layout);
+
+  // Allocate memory for the image data (zero-filled)
+  m_data = ImageAllocator::getDefault()->allocate(
+      ImageBufferKey{width, height, type, layout, m_stride * static_cast<size_t>(height), depth});
+  m_data.track(MemoryTracker::currentCategory());
+}
+
+Image::Image(int width, int height, Type type, Depth depth, RowLayout layout, PixelBuffer buffer)
+    : m_width(width), m_height(height), m_type(type), m_depth(depth),
+      m_rowLayout(layout), m_stride(0) {
+  initGeometry(type, depth, layout);
+
+  const std::size_t required = m_stride * static_cast<size_t>(height);
+  if (buffer.size() < required) {
+    throw std::invalid_argument(std::format(
+        "Pixel buffer of {} bytes is too small for {} bytes of image data", buffer.size(), required));
+  }
+  m_data = std::move(buffer);
+}
+
+void Image::initGeometry(Type type, Depth depth, RowLayout layout) {
+  if (m_width <= 0 || m_height <= 0) {
     throw std::invalid_argument("Image dimensions must be positive");
   }
+  if (type == Type::Binary && depth != Depth::UInt8) {
+    throw std::invalid_argument("Binary images are bit-packed and have no sample depth");
+  }
 
   // Set channel and bytes per pixel based on type
   switch (type) {
@@ -83,9 +134,27 @@ Image::Image(int width, int height, Type type)
   default:
     throw std::invalid_argument("Invalid image type");
   }
+  m_bytesPerPixel *= bytesPerSample(depth);
 
-  // Allocate memory for the image data
-  m_data.resize(static_cast<size_t>(width) * height * m_bytesPerPixel);
+  // Pad rows to the alignment boundary if requested
+  m_stride = getRowBytes();
+  if (layout == RowLayout::Aligned) {
+    m_stride = MemoryUtils::alignUp(m_stride, kRowAlignment);
+  }
+
+  // stride * height sizes the buffer; it must not wrap around
+  if (static_cast<size_t>(m_height) > SIZE_MAX / m_stride) {
+    throw std::overflow_error(std::format("{}x{} image with a {}-byte stride exceeds the address space",
+                                          m_width, m_height, m_stride));
+  }
+}
+
+void Image::detachData() {
+  ImageBufferKey key{m_width, m_height, m_type, m_rowLayout, m_data.size(), m_depth};
+  PixelBuffer copy = ImageAllocator::getDefault()->allocate(key, false);
+  copy.track(MemoryTracker::currentCategory());
+  std::memcpy(copy.mutableData(), m_data.data(), m_data.size());
+  m_data = std::move(copy);
 }
 
 int Image::getWidth() const { return m_width; }
@@ -94,13 +163,17 @@ int Image::getHeight() const { return m_height; }
 
 Image::Type Image::getType() const { return m_type; }
 
+Image::Depth Image::getDepth() const noexcept { return m_depth; }
+
+int Image::getBytesPerSample() const noexcept { return bytesPerSample(m_depth); }
+
 bool Image::isEmpty() const {
   return m_data.empty() || m_width <= 0 || m_height <= 0;
 }
 
 const std::uint8_t *Image::getData() const { return m_data.data(); }
 
-std::uint8_t *Image::getData() { return m_data.data(); }
+std::uint8_t *Image::getData() { return mutablePixels(); }
 
 int Image::getChannels() const { return m_channels; }
 
@@ -108,22 +181,63 @@ int Image::getBytesPerPixel() const { return m_bytesPerPixel; }
 
 size_t Image::getDataSize() const { return m_data.size(); }
 
+std::size_t Image::getStride() const noexcept { return m_stride; }
+
+std::size_t Image::getRowBytes() const noexcept {
+  if (m_type == Type::Binary) {
+    // Bit-packed: 8 pixels per byte
+    return (static_cast<size_t>(m_width) + 7) / 8;
+  }
+  return static_cast<size_t>(m_width) * m_bytesPerPixel;
+}
+
+Image::RowLayout Image::getRowLayout() const noexcept { return m_rowLayout; }
+
+bool Image::isContiguous() const noexcept {
+  return m_stride == getRowBytes();
+}
+
+std::span<const uint8_t> Image::getRow(int y) const {
+  if (y < 0 || y >= m_height) {
+    return std::span<const uint8_t>(); // Return empty span for invalid row
+  }
+  return std::span<const uint8_t>(rowPtr(y), getRowBytes());
+}
+
+std::span<uint8_t> Image::getRow(int y) {
+  if (y < 0 || y >= m_height) {
+    return std::span<uint8_t>(); // Return empty span for invalid row
+  }
+  return std::span<uint8_t>(rowPtr(y), getRowBytes());
+}
+
+ImageView Image::view() const { return ImageView(*this); }
+
+MutableImageView Image::mutableView() { return MutableImageView(*this); }
+
 std::unique_ptr<Image> Image::clone() const {
-  auto cloned = std::make_unique<Image>(m_width, m_height, m_type);
-  std::copy(m_data.begin(), m_data.end(), cloned->m_data.begin());
-  return cloned;
+  // The clone shares the pixel buffer until either image is written to
+  return std::make_unique<Image>(*this);
 }
 
+bool Image::isShared() const noexcept { return m_data.isShared(); }
+
+bool Image::sharesDataWith(const Image &other) const noexcept {
+  return m_data.sharesWith(other.m_data);
+}
+
+bool Image::hasExclusiveData() const noexcept { return m_data.isExclusive(); }
+
 bool Image::isValidCoordinate(int x, int y) const {
   return x >= 0 && x < m_width && y >= 0 && y < m_height;
 }
 
 std::span<const std::uint8_t> Image::getDataSpan() const noexcept {
-  return std::span<const std::uint8_t>(m_data);
+  return std::span<const std::uint8_t>(m_data.data(), m_data.size());
 }
 
 std::span<std::uint8_t> Image::getDataSpan() {
-  return std::span<std::uint8_t>(m_data);
+  return std::span<std::uint8_t>(mutablePixels(), m_data.size());
 }
 
 std::string Image::toString() const {
@@ -145,6 +259,12 @@ std::string Image::toString() const {
     typeStr = "Unknown";
   }
 
+  if (m_depth != Depth::UInt8) {
+    return std::format("Image({}x{}, type={}, channels={}, depth={})", m_width,
+                       m_height, typeStr, m_channels,
+                       m_depth == Depth::UInt16 ? "uint16" : "float32");
+  }
+
   return std::format("Image({}x{}, type={}, channels={})", m_width, m_height,
                      typeStr, m_channels);
 }
@@ -155,12 +275,12 @@ std::size_t Image::getPixelIndex(int x, int y) const {
   if (!isValidCoordinate(x, y)) {
     throw std::out_of_range("Pixel coordinates out of range");
   }
-  return static_cast<size_t>(y) * m_width * m_bytesPerPixel +
+  return static_cast<size_t>(y) * m_stride +
          static_cast<size_t>(x) * m_bytesPerPixel;
 }
 
 Image::Image()
     : m_width(0), m_height(0), m_type(Type::Grayscale), m_channels(0),
-      m_bytesPerPixel(0) {}
+      m_bytesPerPixel(0), m_rowLayout(RowLayout::Packed), m_stride(0) {}
 
 } // namespace DIPAL
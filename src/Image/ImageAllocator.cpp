@@ -0,0 +1,440 @@
+// src/Image/ImageAllocator.cpp
+#include "../../include/DIPAL/Image/ImageAllocator.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+#include "../../include/DIPAL/Utils/MemoryUtils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace DIPAL {
+
+// Default allocator
+
+namespace {
+
+std::mutex g_defaultMutex;
+
+std::shared_ptr<ImageAllocator>& defaultSlot() {
+    static std::shared_ptr<ImageAllocator> allocator = std::make_shared<HeapImageAllocator>();
+    return allocator;
+}
+
+}  // namespace
+
+std::shared_ptr<ImageAllocator> ImageAllocator::getDefault() {
+    std::lock_guard<std::mutex> lock(g_defaultMutex);
+    return defaultSlot();
+}
+
+void ImageAllocator::setDefault(std::shared_ptr<ImageAllocator> allocator) {
+    if (!allocator) {
+        allocator = std::make_shared<HeapImageAllocator>();
+    }
+    std::lock_guard<std::mutex> lock(g_defaultMutex);
+    defaultSlot() = std::move(allocator);
+}
+
+// HeapImageAllocator
+
+PixelBuffer HeapImageAllocator::allocate(const ImageBufferKey& key, bool zeroFill) {
+    // Copy-on-write detaches overwrite the whole buffer right away
+    return zeroFill ? PixelBuffer(key.bytes) : PixelBuffer::uninitialized(key.bytes);
+}
+
+std::string_view HeapImageAllocator::getName() const {
+    return "HeapImageAllocator";
+}
+
+// MappedImageAllocator
+
+MappedImageAllocator::MappedImageAllocator(std::filesystem::path directory, std::size_t threshold)
+    : m_directory(directory.empty() ? std::filesystem::temp_directory_path() : std::move(directory)),
+      m_threshold(threshold) {}
+
+PixelBuffer MappedImageAllocator::allocate(const ImageBufferKey& key, bool zeroFill) {
+#ifndef _WIN32
+    if (key.bytes >= m_threshold && key.bytes > 0) {
+        std::string path = (m_directory / "dipal-image-XXXXXX").string();
+        const int fd = ::mkstemp(path.data());
+        if (fd < 0) {
+            throw std::bad_alloc();
+        }
+
+        // Only the mapping refers to the file from here on; it is deleted with it
+        ::unlink(path.c_str());
+
+        const std::size_t size = key.bytes;
+        void* address = MAP_FAILED;
+        if (::ftruncate(fd, static_cast<off_t>(size)) == 0) {
+            address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+
+        // A freshly sized file reads as zeros, so zeroFill needs no work
+        std::shared_ptr<uint8_t> storage(static_cast<uint8_t*>(address),
+                                         [size](uint8_t* p) { ::munmap(p, size); });
+        return PixelBuffer(std::move(storage), size);
+    }
+#endif
+    return HeapImageAllocator().allocate(key, zeroFill);
+}
+
+std::string_view MappedImageAllocator::getName() const {
+    return "MappedImageAllocator";
+}
+
+const std::filesystem::path& MappedImageAllocator::getDirectory() const noexcept {
+    return m_directory;
+}
+
+std::size_t MappedImageAllocator::getThreshold() const noexcept {
+    return m_threshold;
+}
+
+// LargePageImageAllocator
+
+LargePageImageAllocator::LargePageImageAllocator() : LargePageImageAllocator(Config{}) {}
+
+LargePageImageAllocator::LargePageImageAllocator(Config config) : m_config(std::move(config)) {}
+
+PixelBuffer LargePageImageAllocator::allocate(const ImageBufferKey& key, bool zeroFill) {
+#ifndef _WIN32
+    if (key.bytes >= m_config.threshold && key.bytes > 0) {
+        // Over-map by one huge page and cut the mapping down to an aligned range
+        const std::size_t size = MemoryUtils::alignUp(key.bytes, kHugePageSize);
+        void* raw = ::mmap(nullptr, size + kHugePageSize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        auto* base = static_cast<uint8_t*>(raw);
+        auto* aligned = reinterpret_cast<uint8_t*>(
+            MemoryUtils::alignUp(reinterpret_cast<std::uintptr_t>(base), kHugePageSize));
+        const std::size_t head = static_cast<std::size_t>(aligned - base);
+        if (head > 0) {
+            ::munmap(base, head);
+        }
+        const std::size_t tail = kHugePageSize - head;
+        if (tail > 0) {
+            ::munmap(aligned + size, tail);
+        }
+
+#ifdef MADV_HUGEPAGE
+        if (m_config.hugePages) {
+            // Advisory only: without THP support the mapping keeps small pages
+            ::madvise(aligned, size, MADV_HUGEPAGE);
+        }
+#endif
+
+        std::shared_ptr<uint8_t> storage(aligned, [size](uint8_t* p) { ::munmap(p, size); });
+
+        // Anonymous mappings read as zeros, so zeroFill needs no work. Writing the
+        // zeros anyway from the strip owners decides which node each page lands on.
+        ThreadPool* pool = m_config.firstTouchPool.get();
+        if (pool && !pool->currentWorkerIndex()) {
+            const std::size_t workers = pool->getThreadCount();
+            const std::size_t rows = static_cast<std::size_t>(std::max(key.height, 1));
+            const std::size_t rowBytes = key.bytes / rows;
+
+            std::vector<std::future<void>> touched;
+            touched.reserve(workers);
+            for (std::size_t i = 0; i < workers; ++i) {
+                const auto [first, last] = partitionRange(rows, workers, i);
+                const std::size_t begin = first * rowBytes;
+                const std::size_t end = i + 1 == workers ? size : last * rowBytes;
+                if (end > begin) {
+                    touched.push_back(pool->submitTo(
+                        i, [p = aligned + begin, n = end - begin]() { std::memset(p, 0, n); }));
+                }
+            }
+            for (auto& future : touched) {
+                future.get();
+            }
+        }
+
+        return PixelBuffer(std::move(storage), key.bytes);
+    }
+#endif
+    return HeapImageAllocator().allocate(key, zeroFill);
+}
+
+std::string_view LargePageImageAllocator::getName() const {
+    return "LargePageImageAllocator";
+}
+
+const LargePageImageAllocator::Config& LargePageImageAllocator::getConfig() const noexcept {
+    return m_config;
+}
+
+// PooledImageAllocator
+
+namespace {
+
+struct KeyHash {
+    std::size_t operator()(const ImageBufferKey& key) const noexcept {
+        std::size_t h = std::hash<int>{}(key.width);
+        h = h * 31 + std::hash<int>{}(key.height);
+        h = h * 31 + static_cast<std::size_t>(key.type);
+        h = h * 31 + static_cast<std::size_t>(key.layout);
+        h = h * 31 + static_cast<std::size_t>(key.depth);
+        return h * 31 + std::hash<std::size_t>{}(key.bytes);
+    }
+};
+
+uint8_t* allocateBlock(std::size_t bytes) {
+    void* ptr = MemoryUtils::alignedAlloc(
+        MemoryUtils::alignUp(std::max<std::size_t>(bytes, 1), PixelBuffer::kAlignment),
+        PixelBuffer::kAlignment);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return static_cast<uint8_t*>(ptr);
+}
+
+}  // namespace
+
+struct PooledImageAllocator::State : std::enable_shared_from_this<State> {
+    struct ThreadCache;
+
+    explicit State(Config cfg) : config(cfg), memoryCap(cfg.memoryCap) {}
+
+    ~State() {
+        for (auto& [key, blocks] : pool) {
+            for (uint8_t* block : blocks) {
+                MemoryUtils::alignedFree(block);
+            }
+        }
+        // Blocks still parked in thread caches are freed later by their threads;
+        // they stop counting now, together with the pool
+        MemoryTracker::recordDeallocation(MemoryCategory::PoolCache, cachedBytes.load());
+    }
+
+    // Idle bytes are reported to the MemoryTracker as PoolCache
+    void addCached(std::size_t bytes) noexcept {
+        cachedBytes += bytes;
+        MemoryTracker::recordAllocation(MemoryCategory::PoolCache, bytes);
+    }
+    void removeCached(std::size_t bytes) noexcept {
+        cachedBytes -= bytes;
+        MemoryTracker::recordDeallocation(MemoryCategory::PoolCache, bytes);
+    }
+
+    ThreadCache& localCache();
+    uint8_t* acquire(const ImageBufferKey& key);
+    void release(const ImageBufferKey& key, uint8_t* block) noexcept;
+    void trimPoolTo(std::size_t bytes);
+
+    const Config config;
+    std::atomic<std::size_t> memoryCap;
+
+    std::mutex mutex;
+    std::unordered_map<ImageBufferKey, std::vector<uint8_t*>, KeyHash> pool;
+
+    std::atomic<std::size_t> cachedBytes{0};
+    std::atomic<std::size_t> threadCacheHits{0};
+    std::atomic<std::size_t> poolHits{0};
+    std::atomic<std::size_t> misses{0};
+    std::atomic<std::size_t> releasedBytes{0};
+};
+
+// Idle buffers private to one thread. A thread keeps one cache per live pool;
+// caches of pools that have been destroyed are dropped on the next access.
+struct PooledImageAllocator::State::ThreadCache {
+    std::weak_ptr<State> owner;
+    const State* id = nullptr;
+    std::vector<std::pair<ImageBufferKey, uint8_t*>> blocks;
+    std::size_t bytes = 0;
+
+    ThreadCache() = default;
+    ThreadCache(ThreadCache&& other) noexcept
+        : owner(std::move(other.owner)),
+          id(other.id),
+          blocks(std::move(other.blocks)),
+          bytes(std::exchange(other.bytes, 0)) {
+        other.blocks.clear();
+    }
+    ThreadCache& operator=(ThreadCache&& other) noexcept {
+        std::swap(owner, other.owner);
+        std::swap(id, other.id);
+        std::swap(blocks, other.blocks);
+        std::swap(bytes, other.bytes);
+        return *this;
+    }
+
+    ~ThreadCache() {
+        for (auto& [key, block] : blocks) {
+            MemoryUtils::alignedFree(block);
+        }
+        if (auto state = owner.lock()) {
+            state->removeCached(bytes);
+        }
+    }
+};
+
+PooledImageAllocator::State::ThreadCache& PooledImageAllocator::State::localCache() {
+    thread_local std::vector<ThreadCache> caches;
+
+    // Forget caches whose pool is gone (their destructor frees the blocks)
+    std::erase_if(caches, [](const ThreadCache& cache) { return cache.owner.expired(); });
+
+    for (auto& cache : caches) {
+        if (cache.id == this) {
+            return cache;
+        }
+    }
+
+    ThreadCache cache;
+    cache.owner = weak_from_this();
+    cache.id = this;
+    caches.push_back(std::move(cache));
+    return caches.back();
+}
+
+uint8_t* PooledImageAllocator::State::acquire(const ImageBufferKey& key) {
+    auto& cache = localCache();
+    auto it = std::find_if(cache.blocks.begin(), cache.blocks.end(),
+                           [&key](const auto& entry) { return entry.first == key; });
+    if (it != cache.blocks.end()) {
+        uint8_t* block = it->second;
+        cache.blocks.erase(it);
+        cache.bytes -= key.bytes;
+        removeCached(key.bytes);
+        ++threadCacheHits;
+        return block;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = pool.find(key);
+        if (found != pool.end() && !found->second.empty()) {
+            uint8_t* block = found->second.back();
+            found->second.pop_back();
+            removeCached(key.bytes);
+            ++poolHits;
+            return block;
+        }
+    }
+
+    ++misses;
+    return allocateBlock(key.bytes);
+}
+
+void PooledImageAllocator::State::release(const ImageBufferKey& key, uint8_t* block) noexcept {
+    try {
+        const std::size_t cap = memoryCap.load(std::memory_order_relaxed);
+
+        // Prefer the releasing thread's cache: no lock, and the memory is still warm
+        auto& cache = localCache();
+        if (cache.blocks.size() < config.threadCacheEntries &&
+            cache.bytes + key.bytes <= config.threadCacheBytes &&
+            cachedBytes.load(std::memory_order_relaxed) + key.bytes <= cap) {
+            cache.blocks.emplace_back(key, block);
+            cache.bytes += key.bytes;
+            addCached(key.bytes);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cachedBytes.load(std::memory_order_relaxed) + key.bytes <= cap) {
+            pool[key].push_back(block);
+            addCached(key.bytes);
+            return;
+        }
+    } catch (...) {
+        // Bookkeeping failed to allocate; fall through and free the block
+    }
+
+    releasedBytes += key.bytes;
+    MemoryUtils::alignedFree(block);
+}
+
+void PooledImageAllocator::State::trimPoolTo(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& [key, blocks] : pool) {
+        while (!blocks.empty() && cachedBytes.load(std::memory_order_relaxed) > bytes) {
+            MemoryUtils::alignedFree(blocks.back());
+            blocks.pop_back();
+            removeCached(key.bytes);
+            releasedBytes += key.bytes;
+        }
+    }
+    std::erase_if(pool, [](const auto& entry) { return entry.second.empty(); });
+}
+
+PooledImageAllocator::PooledImageAllocator() : PooledImageAllocator(Config{}) {}
+
+PooledImageAllocator::PooledImageAllocator(Config config)
+    : m_state(std::make_shared<State>(config)) {}
+
+PooledImageAllocator::~PooledImageAllocator() = default;
+
+PixelBuffer PooledImageAllocator::allocate(const ImageBufferKey& key, bool zeroFill) {
+    uint8_t* block = m_state->acquire(key);
+    if (zeroFill) {
+        std::memset(block, 0, key.bytes);
+    }
+
+    // The buffer keeps the pool state alive and hands the block back when the last owner goes
+    std::shared_ptr<uint8_t> storage(block, [state = m_state, key](uint8_t* p) {
+        state->release(key, p);
+    });
+    return PixelBuffer(std::move(storage), key.bytes);
+}
+
+std::string_view PooledImageAllocator::getName() const {
+    return "PooledImageAllocator";
+}
+
+PooledImageAllocator::Statistics PooledImageAllocator::getStatistics() const {
+    Statistics stats;
+    stats.threadCacheHits = m_state->threadCacheHits.load();
+    stats.poolHits = m_state->poolHits.load();
+    stats.misses = m_state->misses.load();
+    stats.cachedBytes = m_state->cachedBytes.load();
+    stats.releasedBytes = m_state->releasedBytes.load();
+    return stats;
+}
+
+void PooledImageAllocator::setMemoryCap(std::size_t bytes) {
+    m_state->memoryCap = bytes;
+    m_state->trimPoolTo(bytes);
+}
+
+std::size_t PooledImageAllocator::getMemoryCap() const noexcept {
+    return m_state->memoryCap.load();
+}
+
+void PooledImageAllocator::trim() {
+    auto& cache = m_state->localCache();
+    for (auto& [key, block] : cache.blocks) {
+        MemoryUtils::alignedFree(block);
+        m_state->removeCached(key.bytes);
+        m_state->releasedBytes += key.bytes;
+    }
+    cache.blocks.clear();
+    cache.bytes = 0;
+
+    m_state->trimPoolTo(0);
+}
+
+}  // namespace DIPAL
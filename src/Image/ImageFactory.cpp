@@ -5,6 +5,7 @@
 #include "../../include/DIPAL/Image/BinaryImage.hpp"
 #include "../../include/DIPAL/Image/ColorImage.hpp"
 #include "../../include/DIPAL/Image/GrayscaleImage.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
 
 #include <filesystem>
 #include <format>
@@ -14,7 +15,23 @@
 
 namespace DIPAL {
 
-Result<std::unique_ptr<Image>> ImageFactory::create(int width, int height, Image::Type type) {
+namespace {
+
+template <typename ImageT>
+Result<std::unique_ptr<Image>> asImageResult(Result<std::unique_ptr<ImageT>> result) {
+    if (!result) {
+        return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
+                                                       result.error().message());
+    }
+    return makeSuccessResult<std::unique_ptr<Image>>(std::move(result.value()));
+}
+
+}  // namespace
+
+Result<std::unique_ptr<Image>> ImageFactory::create(int width,
+                                                    int height,
+                                                    Image::Type type,
+                                                    Image::RowLayout layout) {
     if (width <= 0 || height <= 0) {
         return makeErrorResult<std::unique_ptr<Image>>(
             ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
@@ -23,7 +40,7 @@ Result<std::unique_ptr<Image>> ImageFactory::create(int width, int height, Image
     try {
         switch (type) {
             case Image::Type::Binary: {
-                auto result = createBinary(width, height);
+                auto result = createBinary(width, height, layout);
                 if (!result) {
                     return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
                                                                    result.error().message());
@@ -31,7 +48,7 @@ Result<std::unique_ptr<Image>> ImageFactory::create(int width, int height, Image
                 return makeSuccessResult<std::unique_ptr<Image>>(std::move(result.value()));
             }
             case Image::Type::Grayscale: {
-                auto result = createGrayscale(width, height);
+                auto result = createGrayscale(width, height, layout);
                 if (!result) {
                     return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
                                                                    result.error().message());
@@ -39,7 +56,7 @@ Result<std::unique_ptr<Image>> ImageFactory::create(int width, int height, Image
                 return makeSuccessResult<std::unique_ptr<Image>>(std::move(result.value()));
             }
             case Image::Type::RGB: {
-                auto result = createColor(width, height, false);
+                auto result = createColor(width, height, false, layout);
                 if (!result) {
                     return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
                                                                    result.error().message());
@@ -47,7 +64,7 @@ Result<std::unique_ptr<Image>> ImageFactory::create(int width, int height, Image
                 return makeSuccessResult<std::unique_ptr<Image>>(std::move(result.value()));
             }
             case Image::Type::RGBA: {
-                auto result = createColor(width, height, true);
+                auto result = createColor(width, height, true, layout);
                 if (!result) {
                     return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
                                                                    result.error().message());
@@ -65,14 +82,89 @@ Result<std::unique_ptr<Image>> ImageFactory::create(int width, int height, Image
     }
 }
 
-Result<std::unique_ptr<BinaryImage>> ImageFactory::createBinary(int width, int height) {
+Result<std::unique_ptr<Image>> ImageFactory::create(int width,
+                                                    int height,
+                                                    Image::Type type,
+                                                    Image::Depth depth,
+                                                    Image::RowLayout layout) {
+    if (depth == Image::Depth::UInt8) {
+        return create(width, height, type, layout);
+    }
+
+    if (type == Image::Type::Binary) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::InvalidParameter, "Binary images only support 8-bit depth");
+    }
+
+    return visitSampleType(
+        depth, [&]<typename T>(std::type_identity<T>) -> Result<std::unique_ptr<Image>> {
+            switch (type) {
+                case Image::Type::Grayscale:
+                    return asImageResult(createTyped<T, 1>(width, height, layout));
+                case Image::Type::RGB:
+                    return asImageResult(createTyped<T, 3>(width, height, layout));
+                case Image::Type::RGBA:
+                    return asImageResult(createTyped<T, 4>(width, height, layout));
+                default:
+                    return makeErrorResult<std::unique_ptr<Image>>(
+                        ErrorCode::InvalidParameter,
+                        std::format("Unsupported image type: {}", static_cast<int>(type)));
+            }
+        });
+}
+
+Result<std::unique_ptr<Image>> ImageFactory::wrap(int width,
+                                                  int height,
+                                                  Image::Type type,
+                                                  Image::Depth depth,
+                                                  Image::RowLayout layout,
+                                                  PixelBuffer buffer) {
+    if (width <= 0 || height <= 0) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
+    }
+
+    if (type != Image::Type::Grayscale && type != Image::Type::RGB &&
+        type != Image::Type::RGBA) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Cannot wrap pixel memory as image type {}", static_cast<int>(type)));
+    }
+
+    try {
+        return visitSampleType(
+            depth, [&]<typename T>(std::type_identity<T>) -> Result<std::unique_ptr<Image>> {
+                std::unique_ptr<Image> image;
+                if (type == Image::Type::Grayscale) {
+                    image = std::make_unique<TypedImage<T, 1>>(width, height, layout, std::move(buffer));
+                } else if (type == Image::Type::RGB) {
+                    image = std::make_unique<TypedImage<T, 3>>(width, height, layout, std::move(buffer));
+                } else {
+                    image = std::make_unique<TypedImage<T, 4>>(width, height, layout, std::move(buffer));
+                }
+                return makeSuccessResult(std::move(image));
+            });
+    } catch (const std::invalid_argument& e) {
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter, e.what());
+    } catch (const std::overflow_error& e) {
+        // No buffer can hold the declared geometry
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::CorruptedData, e.what());
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::InternalError, std::format("Failed to wrap pixel memory: {}", e.what()));
+    }
+}
+
+Result<std::unique_ptr<BinaryImage>> ImageFactory::createBinary(int width,
+                                                                int height,
+                                                                Image::RowLayout layout) {
     if (width <= 0 || height <= 0) {
         return makeErrorResult<std::unique_ptr<BinaryImage>>(
             ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
     }
 
     try {
-        auto image = std::make_unique<BinaryImage>(width, height);
+        auto image = std::make_unique<BinaryImage>(width, height, layout);
 
         // Initialize all pixels to black (false)
         auto fillResult = image->fill(false);
@@ -89,14 +181,16 @@ Result<std::unique_ptr<BinaryImage>> ImageFactory::createBinary(int width, int h
     }
 }
 
-Result<std::unique_ptr<GrayscaleImage>> ImageFactory::createGrayscale(int width, int height) {
+Result<std::unique_ptr<GrayscaleImage>> ImageFactory::createGrayscale(int width,
+                                                                      int height,
+                                                                      Image::RowLayout layout) {
     if (width <= 0 || height <= 0) {
         return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
             ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
     }
 
     try {
-        auto image = std::make_unique<GrayscaleImage>(width, height);
+        auto image = std::make_unique<GrayscaleImage>(width, height, layout);
         return makeSuccessResult(std::move(image));
     } catch (const std::exception& e) {
         return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
@@ -107,14 +201,15 @@ Result<std::unique_ptr<GrayscaleImage>> ImageFactory::createGrayscale(int width,
 
 Result<std::unique_ptr<ColorImage>> ImageFactory::createColor(int width,
                                                               int height,
-                                                              bool hasAlpha) {
+                                                              bool hasAlpha,
+                                                              Image::RowLayout layout) {
     if (width <= 0 || height <= 0) {
         return makeErrorResult<std::unique_ptr<ColorImage>>(
             ErrorCode::InvalidParameter, std::format("Invalid dimensions: {}x{}", width, height));
     }
 
     try {
-        auto image = std::make_unique<ColorImage>(width, height, hasAlpha);
+        auto image = std::make_unique<ColorImage>(width, height, hasAlpha, layout);
         return makeSuccessResult(std::move(image));
     } catch (const std::exception& e) {
         return makeErrorResult<std::unique_ptr<ColorImage>>(
@@ -124,31 +219,23 @@ Result<std::unique_ptr<ColorImage>> ImageFactory::createColor(int width,
 
 Result<std::unique_ptr<GrayscaleImage>> ImageFactory::toGrayscale(const ColorImage& image) {
     try {
-        auto result = createGrayscale(image.getWidth(), image.getHeight());
+        auto result = createGrayscale(image.getWidth(), image.getHeight(), image.getRowLayout());
         if (!result) {
             return result;
         }
 
         auto& grayscale = *result.value();
+        const int channels = image.getChannels();
 
         for (int y = 0; y < image.getHeight(); ++y) {
-            for (int x = 0; x < image.getWidth(); ++x) {
-                uint8_t r, g, b, a;
-                auto pixelResult = image.getPixel(x, y, r, g, b, a);
+            auto src = image.getRow(y);
+            auto dst = grayscale.getRow(y);
 
-                if (!pixelResult) {
-                    return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
-                        pixelResult.error().code(), pixelResult.error().message());
-                }
+            for (int x = 0; x < image.getWidth(); ++x) {
+                const uint8_t* px = src.data() + static_cast<size_t>(x) * channels;
 
                 // Standard grayscale conversion formula (luminance)
-                uint8_t gray = static_cast<uint8_t>(0.299f * r + 0.587f * g + 0.114f * b);
-
-                auto setResult = grayscale.setPixel(x, y, gray);
-                if (!setResult) {
-                    return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
-                        setResult.error().code(), setResult.error().message());
-                }
+                dst[x] = static_cast<uint8_t>(0.299f * px[0] + 0.587f * px[1] + 0.114f * px[2]);
             }
         }
 
@@ -162,28 +249,24 @@ Result<std::unique_ptr<GrayscaleImage>> ImageFactory::toGrayscale(const ColorIma
 Result<std::unique_ptr<ColorImage>> ImageFactory::toColor(const GrayscaleImage& image,
                                                           bool hasAlpha) {
     try {
-        auto result = createColor(image.getWidth(), image.getHeight(), hasAlpha);
+        auto result =
+            createColor(image.getWidth(), image.getHeight(), hasAlpha, image.getRowLayout());
         if (!result) {
             return result;
         }
 
         auto& colorImage = *result.value();
+        const int channels = colorImage.getChannels();
 
         for (int y = 0; y < image.getHeight(); ++y) {
-            for (int x = 0; x < image.getWidth(); ++x) {
-                auto pixelResult = image.getPixel(x, y);
-
-                if (!pixelResult) {
-                    return makeErrorResult<std::unique_ptr<ColorImage>>(
-                        pixelResult.error().code(), pixelResult.error().message());
-                }
+            auto src = image.getRow(y);
+            auto dst = colorImage.getRow(y);
 
-                uint8_t gray = pixelResult.value();
-
-                auto setResult = colorImage.setPixel(x, y, gray, gray, gray);
-                if (!setResult) {
-                    return makeErrorResult<std::unique_ptr<ColorImage>>(
-                        setResult.error().code(), setResult.error().message());
+            for (int x = 0; x < image.getWidth(); ++x) {
+                uint8_t* px = dst.data() + static_cast<size_t>(x) * channels;
+                px[0] = px[1] = px[2] = src[x];
+                if (hasAlpha) {
+                    px[3] = 255;
                 }
             }
         }
@@ -205,24 +288,16 @@ Result<std::unique_ptr<GrayscaleImage>> ImageFactory::fromBinary(const BinaryIma
                                                                  uint8_t whiteValue,
                                                                  uint8_t blackValue) {
     try {
-        auto result = std::make_unique<GrayscaleImage>(image.getWidth(), image.getHeight());
+        auto result = std::make_unique<GrayscaleImage>(image.getWidth(), image.getHeight(),
+                                                       image.getRowLayout());
 
         for (int y = 0; y < image.getHeight(); ++y) {
-            for (int x = 0; x < image.getWidth(); ++x) {
-                auto pixelResult = image.getPixel(x, y);
-                if (!pixelResult) {
-                    return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
-                        pixelResult.error().code(), pixelResult.error().message());
-                }
+            auto src = image.getRow(y);
+            auto dst = result->getRow(y);
 
-                bool isWhite = pixelResult.value();
-                uint8_t grayValue = isWhite ? whiteValue : blackValue;
-
-                auto setResult = result->setPixel(x, y, grayValue);
-                if (!setResult) {
-                    return makeErrorResult<std::unique_ptr<GrayscaleImage>>(
-                        setResult.error().code(), setResult.error().message());
-                }
+            for (int x = 0; x < image.getWidth(); ++x) {
+                bool isWhite = (src[x / 8] >> (x % 8)) & 1;
+                dst[x] = isWhite ? whiteValue : blackValue;
             }
         }
 
@@ -234,6 +309,52 @@ Result<std::unique_ptr<GrayscaleImage>> ImageFactory::fromBinary(const BinaryIma
     }
 }
 
+Result<std::unique_ptr<Image>> ImageFactory::convertDepth(const Image& image,
+                                                          Image::Depth depth) {
+    if (image.isEmpty()) {
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
+                                                       "Cannot convert an empty image");
+    }
+    if (image.getType() == Image::Type::Binary) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::UnsupportedFormat, "Binary images only support 8-bit depth");
+    }
+    if (image.getDepth() == depth) {
+        return makeSuccessResult(image.clone());
+    }
+
+    try {
+        auto result =
+            create(image.getWidth(), image.getHeight(), image.getType(), depth, image.getRowLayout());
+        if (!result) {
+            return result;
+        }
+
+        const int height = image.getHeight();
+        const std::size_t samples = static_cast<std::size_t>(image.getWidth()) * image.getChannels();
+
+        visitSampleType(image.getDepth(), [&]<typename From>(std::type_identity<From>) {
+            visitSampleType(depth, [&]<typename To>(std::type_identity<To>) {
+                const PixelAccessor<From> src(image);
+                const MutablePixelAccessor<To> dst(*result.value());
+
+                for (int y = 0; y < height; ++y) {
+                    const From* srcRow = src.row(y);
+                    To* dstRow = dst.row(y);
+                    for (std::size_t i = 0; i < samples; ++i) {
+                        dstRow[i] = convertSample<To>(srcRow[i]);
+                    }
+                }
+            });
+        });
+
+        return result;
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::InternalError, std::format("Failed to convert depth: {}", e.what()));
+    }
+}
+
 Result<std::unique_ptr<Image>> ImageFactory::loadImage(std::string_view filename) {
     try {
         // Check if file exists
@@ -0,0 +1,221 @@
+// src/Image/ImageView.cpp
+#include "../../include/DIPAL/Image/ImageView.hpp"
+
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+
+#include <cstring>
+#include <format>
+
+namespace DIPAL {
+
+namespace {
+
+int channelsFor(Image::Type type) noexcept {
+    switch (type) {
+        case Image::Type::RGB:
+            return 3;
+        case Image::Type::RGBA:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+int bytesPerPixelFor(Image::Type type, Image::Depth depth) noexcept {
+    return type == Image::Type::Binary ? 0 : channelsFor(type) * Image::bytesPerSample(depth);
+}
+
+std::size_t rowBytesFor(Image::Type type, Image::Depth depth, int width) noexcept {
+    if (width <= 0) {
+        return 0;
+    }
+    if (type == Image::Type::Binary) {
+        return (static_cast<std::size_t>(width) + 7) / 8;
+    }
+    return static_cast<std::size_t>(width) * bytesPerPixelFor(type, depth);
+}
+
+// Shared by both view flavours: validate the rect and compute the byte offset of its origin
+Result<std::size_t> cropOffset(const Rect& bounds,
+                               const Rect& rect,
+                               Image::Type type,
+                               Image::Depth depth,
+                               std::size_t stride) {
+    if (rect.isEmpty() || !bounds.contains(rect)) {
+        return makeErrorResult<std::size_t>(
+            ErrorCode::OutOfRange,
+            std::format("Crop region {}x{} at ({}, {}) is outside the {}x{} view",
+                        rect.width, rect.height, rect.x, rect.y, bounds.width, bounds.height));
+    }
+
+    if (type == Image::Type::Binary) {
+        if (rect.x % 8 != 0) {
+            return makeErrorResult<std::size_t>(
+                ErrorCode::InvalidParameter,
+                std::format("Binary views can only be cropped at multiples of 8 (x = {})",
+                            rect.x));
+        }
+        return makeSuccessResult(static_cast<std::size_t>(rect.y) * stride +
+                                 static_cast<std::size_t>(rect.x / 8));
+    }
+
+    return makeSuccessResult(static_cast<std::size_t>(rect.y) * stride +
+                             static_cast<std::size_t>(rect.x) * bytesPerPixelFor(type, depth));
+}
+
+}  // namespace
+
+// ImageView
+
+ImageView::ImageView(const uint8_t* data,
+                     int width,
+                     int height,
+                     std::size_t stride,
+                     Image::Type type,
+                     Image::Depth depth)
+    : m_data(data),
+      m_width(width),
+      m_height(height),
+      m_stride(stride),
+      m_type(type),
+      m_depth(depth) {}
+
+ImageView::ImageView(const Image& image)
+    : ImageView(image.getData(),
+                image.getWidth(),
+                image.getHeight(),
+                image.getStride(),
+                image.getType(),
+                image.getDepth()) {}
+
+int ImageView::getChannels() const noexcept {
+    return channelsFor(m_type);
+}
+
+int ImageView::getBytesPerPixel() const noexcept {
+    return bytesPerPixelFor(m_type, m_depth);
+}
+
+std::size_t ImageView::getRowBytes() const noexcept {
+    return rowBytesFor(m_type, m_depth, m_width);
+}
+
+bool ImageView::isEmpty() const noexcept {
+    return m_data == nullptr || m_width <= 0 || m_height <= 0;
+}
+
+std::span<const uint8_t> ImageView::getRow(int y) const noexcept {
+    if (isEmpty() || y < 0 || y >= m_height) {
+        return std::span<const uint8_t>();
+    }
+    return std::span<const uint8_t>(rowPtr(y), getRowBytes());
+}
+
+Result<ImageView> ImageView::crop(const Rect& rect) const {
+    auto offset = cropOffset(bounds(), rect, m_type, m_depth, m_stride);
+    if (!offset) {
+        return makeErrorResult<ImageView>(offset.error().code(), offset.error().message());
+    }
+    return makeSuccessResult(
+        ImageView(m_data + offset.value(), rect.width, rect.height, m_stride, m_type, m_depth));
+}
+
+Result<std::unique_ptr<Image>> ImageView::toImage(Image::RowLayout layout) const {
+    if (isEmpty()) {
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
+                                                       "Cannot copy an empty view");
+    }
+
+    auto result = ImageFactory::create(m_width, m_height, m_type, m_depth, layout);
+    if (!result) {
+        return result;
+    }
+
+    auto copyResult = MutableImageView(*result.value()).copyFrom(*this);
+    if (!copyResult) {
+        return makeErrorResult<std::unique_ptr<Image>>(copyResult.error().code(),
+                                                       copyResult.error().message());
+    }
+
+    return result;
+}
+
+// MutableImageView
+
+MutableImageView::MutableImageView(uint8_t* data,
+                                   int width,
+                                   int height,
+                                   std::size_t stride,
+                                   Image::Type type,
+                                   Image::Depth depth)
+    : m_data(data),
+      m_width(width),
+      m_height(height),
+      m_stride(stride),
+      m_type(type),
+      m_depth(depth) {}
+
+MutableImageView::MutableImageView(Image& image)
+    : MutableImageView(image.getData(),
+                       image.getWidth(),
+                       image.getHeight(),
+                       image.getStride(),
+                       image.getType(),
+                       image.getDepth()) {}
+
+std::span<uint8_t> MutableImageView::getRow(int y) const noexcept {
+    if (isEmpty() || y < 0 || y >= m_height) {
+        return std::span<uint8_t>();
+    }
+    return std::span<uint8_t>(rowPtr(y), getRowBytes());
+}
+
+Result<MutableImageView> MutableImageView::crop(const Rect& rect) const {
+    auto offset = cropOffset(bounds(), rect, m_type, m_depth, m_stride);
+    if (!offset) {
+        return makeErrorResult<MutableImageView>(offset.error().code(), offset.error().message());
+    }
+    return makeSuccessResult(MutableImageView(
+        m_data + offset.value(), rect.width, rect.height, m_stride, m_type, m_depth));
+}
+
+VoidResult MutableImageView::copyFrom(const ImageView& source) const {
+    if (source.getWidth() != m_width || source.getHeight() != m_height ||
+        source.getType() != m_type || source.getDepth() != m_depth) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("View mismatch: cannot copy {}x{} (type {}, depth {}) into {}x{} "
+                        "(type {}, depth {})",
+                        source.getWidth(), source.getHeight(), static_cast<int>(source.getType()),
+                        static_cast<int>(source.getDepth()), m_width, m_height,
+                        static_cast<int>(m_type), static_cast<int>(m_depth)));
+    }
+
+    if (isEmpty()) {
+        return makeVoidSuccessResult();
+    }
+
+    const std::size_t rowBytes = getRowBytes();
+
+    // Binary rows may end in a partially used byte that is shared with pixels
+    // outside this view; only the bits that belong to the view are replaced.
+    const int tailBits = m_type == Image::Type::Binary ? m_width % 8 : 0;
+    const std::size_t fullBytes = tailBits != 0 ? rowBytes - 1 : rowBytes;
+    const uint8_t tailMask = static_cast<uint8_t>((1u << tailBits) - 1u);
+
+    for (int y = 0; y < m_height; ++y) {
+        const uint8_t* src = source.rowPtr(y);
+        uint8_t* dst = rowPtr(y);
+
+        std::memmove(dst, src, fullBytes);
+
+        if (tailBits != 0) {
+            dst[fullBytes] = static_cast<uint8_t>((dst[fullBytes] & ~tailMask) |
+                                                  (src[fullBytes] & tailMask));
+        }
+    }
+
+    return makeVoidSuccessResult();
+}
+
+}  // namespace DIPAL
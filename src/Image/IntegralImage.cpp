@@ -0,0 +1,213 @@
+// src/Image/IntegralImage.cpp
+#include "../../include/DIPAL/Image/IntegralImage.hpp"
+
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+#include "../../include/DIPAL/Image/TypedImage.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <format>
+#include <type_traits>
+#include <utility>
+
+namespace DIPAL {
+
+namespace {
+
+// Fills table rows y0 + 1 .. y1 from source rows y0 .. y1 - 1 as if row y0
+// of the table were zero; the caller adds the true row y0 afterwards
+template <typename Sum, typename T>
+void buildStrip(const PixelAccessor<T>& src, int y0, int y1, Sum* sums, Sum* squares) {
+    const int channels = src.channels();
+    const std::size_t samples = static_cast<std::size_t>(src.width()) * channels;
+    const std::size_t stride = samples + channels;
+
+    for (int y = y0; y < y1; ++y) {
+        const T* in = src.row(y);
+        const std::size_t offset = static_cast<std::size_t>(y + 1) * stride;
+        Sum* out = sums + offset + channels;
+        Sum* outSquares = squares ? squares + offset + channels : nullptr;
+
+        // Prefix sums along the row; the channels are independent chains
+        Sum running[4] = {};
+        Sum runningSquares[4] = {};
+        for (std::size_t i = 0; i < samples; i += channels) {
+            for (int c = 0; c < channels; ++c) {
+                const auto value = static_cast<Sum>(in[i + c]);
+                running[c] += value;
+                out[i + c] = running[c];
+                if (outSquares) {
+                    runningSquares[c] += value * value;
+                    outSquares[i + c] = runningSquares[c];
+                }
+            }
+        }
+
+        // Plus the row above, unless it belongs to the strip above
+        if (y > y0) {
+            const Sum* above = out - stride;
+            for (std::size_t i = 0; i < samples; ++i) {
+                out[i] += above[i];
+            }
+            if (outSquares) {
+                const Sum* aboveSquares = outSquares - stride;
+                for (std::size_t i = 0; i < samples; ++i) {
+                    outSquares[i] += aboveSquares[i];
+                }
+            }
+        }
+    }
+}
+
+template <typename Sum>
+void addRow(const Sum* carry, Sum* row, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        row[i] += carry[i];
+    }
+}
+
+}  // namespace
+
+template <IntegralSumType Sum>
+IntegralImage<Sum>::IntegralImage(int width, int height, int channels, bool withSquares)
+    : m_width(width),
+      m_height(height),
+      m_channels(channels),
+      m_sums(stride() * static_cast<std::size_t>(height + 1)),
+      m_squares(withSquares ? m_sums.size() : 0) {}
+
+template <IntegralSumType Sum>
+Result<IntegralImage<Sum>> IntegralImage<Sum>::compute(const ImageView& view,
+                                                       bool withSquares,
+                                                       ThreadPool* pool) {
+    if (view.getType() != Image::Type::Grayscale && view.getType() != Image::Type::RGB &&
+        view.getType() != Image::Type::RGBA) {
+        return makeErrorResult<IntegralImage>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Unsupported image type for integral image: {}",
+                        static_cast<int>(view.getType())));
+    }
+    if (!std::is_floating_point_v<Sum> && view.getDepth() == Image::Depth::Float32) {
+        return makeErrorResult<IntegralImage>(ErrorCode::UnsupportedFormat,
+                                              "Float images need a double integral image");
+    }
+
+    try {
+        const int width = view.getWidth();
+        const int height = view.getHeight();
+        IntegralImage table(width, height, view.getChannels(), withSquares);
+        if (view.isEmpty()) {
+            return makeSuccessResult(std::move(table));
+        }
+
+        const std::size_t pixels = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        ThreadPool* workers = pool ? pool : sharedPoolFor(pixels);
+        const std::size_t parts =
+            std::min(workers ? workers->getThreadCount() : 1, static_cast<std::size_t>(height));
+
+        Sum* sums = table.m_sums.data();
+        Sum* squares = withSquares ? table.m_squares.data() : nullptr;
+        const std::size_t stride = table.stride();
+        const auto strip = [&](std::size_t part) {
+            const auto [first, last] = partitionRange(static_cast<std::size_t>(height), parts, part);
+            return std::pair{static_cast<int>(first), static_cast<int>(last)};
+        };
+
+        visitSampleType(view.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            const PixelAccessor<T> src(view);
+            forEachPart(workers, parts, [&](std::size_t part) {
+                const auto [y0, y1] = strip(part);
+                buildStrip(src, y0, y1, sums, squares);
+            });
+        });
+
+        // The last row of each strip becomes final once the final last row of
+        // the strip above is added; that row then offsets the rest of the strip
+        for (std::size_t part = 1; part < parts; ++part) {
+            const auto [y0, y1] = strip(part);
+            const std::size_t carry = static_cast<std::size_t>(y0) * stride;
+            const std::size_t last = static_cast<std::size_t>(y1) * stride;
+            addRow(sums + carry, sums + last, stride);
+            if (squares) {
+                addRow(squares + carry, squares + last, stride);
+            }
+        }
+        forEachPart(workers, parts, [&](std::size_t part) {
+            if (part == 0) {
+                return;
+            }
+            const auto [y0, y1] = strip(part);
+            const std::size_t carry = static_cast<std::size_t>(y0) * stride;
+            for (int y = y0 + 1; y < y1; ++y) {
+                const std::size_t offset = static_cast<std::size_t>(y) * stride;
+                addRow(sums + carry, sums + offset, stride);
+                if (squares) {
+                    addRow(squares + carry, squares + offset, stride);
+                }
+            }
+        });
+
+        return makeSuccessResult(std::move(table));
+    } catch (const std::exception& e) {
+        return makeErrorResult<IntegralImage>(
+            ErrorCode::ProcessingFailed, std::format("Integral image failed: {}", e.what()));
+    }
+}
+
+template <IntegralSumType Sum>
+void IntegralImage<Sum>::windowSums(int y,
+                                    int radius,
+                                    std::span<Sum> sums,
+                                    std::span<Sum> squares) const noexcept {
+    const std::size_t s = stride();
+    const auto channels = static_cast<std::size_t>(m_channels);
+    const std::size_t top = static_cast<std::size_t>(std::max(0, y - radius)) * s;
+    const std::size_t bottom = static_cast<std::size_t>(std::min(m_height, y + radius + 1)) * s;
+
+    const auto fill = [&](const Storage& table, Sum* out) {
+        const Sum* t = table.data() + top;
+        const Sum* b = table.data() + bottom;
+        // Windows clipped on the left or right take their edges from the
+        // clamped columns; the windows in between have fixed offsets
+        const int interiorBegin = std::min(radius, m_width);
+        const int interiorEnd = std::max(interiorBegin, m_width - radius);
+        const auto clipped = [&](int x) {
+            const std::size_t left = static_cast<std::size_t>(std::max(0, x - radius)) * channels;
+            const std::size_t right =
+                static_cast<std::size_t>(std::min(m_width, x + radius + 1)) * channels;
+            for (std::size_t c = 0; c < channels; ++c) {
+                out[x * channels + c] = b[right + c] - b[left + c] - t[right + c] + t[left + c];
+            }
+        };
+
+        for (int x = 0; x < interiorBegin; ++x) {
+            clipped(x);
+        }
+        const std::size_t behind = static_cast<std::size_t>(radius) * channels;
+        const std::size_t ahead = static_cast<std::size_t>(radius + 1) * channels;
+        for (std::size_t i = interiorBegin * channels; i < interiorEnd * channels; ++i) {
+            out[i] = b[i + ahead] - b[i - behind] - t[i + ahead] + t[i - behind];
+        }
+        for (int x = interiorEnd; x < m_width; ++x) {
+            clipped(x);
+        }
+    };
+
+    fill(m_sums, sums.data());
+    if (!squares.empty()) {
+        fill(m_squares, squares.data());
+    }
+}
+
+template <IntegralSumType Sum>
+std::size_t IntegralImage<Sum>::windowArea(int x, int y, int radius) const noexcept {
+    const int columns = std::min(m_width, x + radius + 1) - std::max(0, x - radius);
+    const int rows = std::min(m_height, y + radius + 1) - std::max(0, y - radius);
+    return static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows);
+}
+
+template class IntegralImage<uint32_t>;
+template class IntegralImage<uint64_t>;
+template class IntegralImage<double>;
+
+}  // namespace DIPAL
@@ -0,0 +1,81 @@
+// src/Image/PixelBuffer.cpp
+#include "../../include/DIPAL/Image/PixelBuffer.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Utils/MemoryUtils.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace DIPAL {
+
+namespace {
+
+std::shared_ptr<uint8_t> allocateStorage(std::size_t size) {
+    // Never request zero bytes so that every non-empty image has a unique address
+    void* ptr = MemoryUtils::alignedAlloc(MemoryUtils::alignUp(size == 0 ? 1 : size,
+                                                               PixelBuffer::kAlignment),
+                                          PixelBuffer::kAlignment);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return std::shared_ptr<uint8_t>(static_cast<uint8_t*>(ptr),
+                                    [](uint8_t* p) { MemoryUtils::alignedFree(p); });
+}
+
+}  // namespace
+
+PixelBuffer::PixelBuffer(std::size_t size) : m_storage(allocateStorage(size)), m_size(size) {
+    std::memset(m_storage.get(), 0, size);
+}
+
+PixelBuffer PixelBuffer::uninitialized(std::size_t size) {
+    return PixelBuffer(allocateStorage(size), size);
+}
+
+PixelBuffer::PixelBuffer(std::shared_ptr<uint8_t> storage, std::size_t size) noexcept
+    : m_storage(std::move(storage)), m_size(m_storage ? size : 0) {}
+
+void PixelBuffer::detach() {
+    if (!isShared()) {
+        return;
+    }
+
+    auto copy = allocateStorage(m_size);
+    std::memcpy(copy.get(), m_storage.get(), m_size);
+    m_storage = std::move(copy);
+    m_exclusive = false;
+}
+
+void PixelBuffer::track(MemoryCategory category) {
+    if (!m_storage) {
+        return;
+    }
+
+    // Keeps the original storage alive and reports its release
+    struct TrackedStorage {
+        TrackedStorage(std::shared_ptr<uint8_t> s, MemoryCategory c, std::size_t b) noexcept
+            : storage(std::move(s)), category(c), bytes(b) {
+            MemoryTracker::recordAllocation(category, bytes);
+        }
+        ~TrackedStorage() { MemoryTracker::recordDeallocation(category, bytes); }
+
+        TrackedStorage(const TrackedStorage&) = delete;
+        TrackedStorage& operator=(const TrackedStorage&) = delete;
+
+        std::shared_ptr<uint8_t> storage;
+        MemoryCategory category;
+        std::size_t bytes;
+    };
+
+    auto tracked = std::make_shared<TrackedStorage>(m_storage, category, m_size);
+    m_storage = std::shared_ptr<uint8_t>(tracked, tracked->storage.get());
+}
+
+void PixelBuffer::reset() noexcept {
+    m_storage.reset();
+    m_size = 0;
+    m_exclusive = false;
+}
+
+}  // namespace DIPAL
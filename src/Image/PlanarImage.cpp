@@ -0,0 +1,270 @@
+// src/Image/PlanarImage.cpp
+#include "../../include/DIPAL/Image/PlanarImage.hpp"
+#include "../../include/DIPAL/Image/ColorImage.hpp"
+
+#include <array>
+#include <format>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+namespace DIPAL {
+
+namespace {
+
+#if defined(__SSE2__)
+// Extract the byte at Shift of every 32-bit RGBA pixel in 16 pixels and pack
+// the results into one register
+template <int Shift>
+__m128i gatherChannel4(const __m128i (&pixels)[4]) {
+    const __m128i lowByte = _mm_set1_epi32(0xFF);
+    __m128i lanes[4];
+    for (int i = 0; i < 4; ++i) {
+        lanes[i] = _mm_and_si128(_mm_srli_epi32(pixels[i], Shift), lowByte);
+    }
+    return _mm_packus_epi16(_mm_packs_epi32(lanes[0], lanes[1]),
+                            _mm_packs_epi32(lanes[2], lanes[3]));
+}
+#endif
+
+#if defined(__SSSE3__)
+using ShuffleMask = std::array<int8_t, 16>;
+
+// Deinterleaving 16 RGB pixels: the mask for `channel` picks the bytes of that
+// channel that lie in 16-byte block `part` of the 48 input bytes
+constexpr std::array<ShuffleMask, 9> kDeinterleave3 = [] {
+    std::array<ShuffleMask, 9> masks{};
+    for (int channel = 0; channel < 3; ++channel) {
+        for (int part = 0; part < 3; ++part) {
+            for (int i = 0; i < 16; ++i) {
+                const int source = 3 * i + channel;
+                masks[channel * 3 + part][i] =
+                    static_cast<int8_t>(source / 16 == part ? source % 16 : -128);
+            }
+        }
+    }
+    return masks;
+}();
+
+// Interleaving 16 RGB pixels: the mask for output block `part` picks the
+// samples of plane `channel` that belong in it
+constexpr std::array<ShuffleMask, 9> kInterleave3 = [] {
+    std::array<ShuffleMask, 9> masks{};
+    for (int part = 0; part < 3; ++part) {
+        for (int channel = 0; channel < 3; ++channel) {
+            for (int i = 0; i < 16; ++i) {
+                const int target = 16 * part + i;
+                masks[part * 3 + channel][i] =
+                    static_cast<int8_t>(target % 3 == channel ? target / 3 : -128);
+            }
+        }
+    }
+    return masks;
+}();
+
+inline __m128i shuffle(__m128i value, const ShuffleMask& mask) {
+    return _mm_shuffle_epi8(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask.data())));
+}
+#endif
+
+}  // namespace
+
+PlanarImage::PlanarImage(int width, int height, bool hasAlpha, Image::RowLayout layout)
+    : m_width(width), m_height(height) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Image dimensions must be positive");
+    }
+
+    const int channels = hasAlpha ? 4 : 3;
+    m_planes.reserve(channels);
+    for (int c = 0; c < channels; ++c) {
+        m_planes.emplace_back(width, height, layout);
+    }
+}
+
+Result<std::unique_ptr<PlanarImage>> PlanarImage::fromInterleaved(const ImageView& view,
+                                                                  Image::RowLayout layout) {
+    if (view.getType() != Image::Type::RGB && view.getType() != Image::Type::RGBA) {
+        return makeErrorResult<std::unique_ptr<PlanarImage>>(
+            ErrorCode::UnsupportedFormat,
+            std::format("Planar storage needs an RGB or RGBA image, got type {}",
+                        static_cast<int>(view.getType())));
+    }
+    if (view.getDepth() != Image::Depth::UInt8) {
+        return makeErrorResult<std::unique_ptr<PlanarImage>>(
+            ErrorCode::UnsupportedFormat, "Planar storage supports 8-bit samples only");
+    }
+    if (view.getWidth() <= 0 || view.getHeight() <= 0) {
+        return makeErrorResult<std::unique_ptr<PlanarImage>>(
+            ErrorCode::InvalidParameter, "Cannot split an empty image into planes");
+    }
+
+    try {
+        auto planar = std::make_unique<PlanarImage>(
+            view.getWidth(), view.getHeight(), view.getType() == Image::Type::RGBA, layout);
+        const int channels = planar->getChannels();
+
+        uint8_t* planes[4] = {};
+        for (int y = 0; y < view.getHeight(); ++y) {
+            for (int c = 0; c < channels; ++c) {
+                planes[c] = planar->m_planes[c].getRow(y).data();
+            }
+            deinterleaveRow(view.getRow(y).data(), planes, channels, view.getWidth());
+        }
+
+        return makeSuccessResult(std::move(planar));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<PlanarImage>>(
+            ErrorCode::ProcessingFailed,
+            std::format("Failed to split image into planes: {}", e.what()));
+    }
+}
+
+VoidResult PlanarImage::toInterleaved(const MutableImageView& view) const {
+    if (view.getWidth() != m_width || view.getHeight() != m_height ||
+        view.getType() != getType() || view.getDepth() != Image::Depth::UInt8) {
+        return makeVoidErrorResult(
+            ErrorCode::InvalidParameter,
+            std::format("Destination {}x{} does not match the {}x{} planes",
+                        view.getWidth(), view.getHeight(), m_width, m_height));
+    }
+
+    const int channels = getChannels();
+    const uint8_t* planes[4] = {};
+    for (int y = 0; y < m_height; ++y) {
+        for (int c = 0; c < channels; ++c) {
+            planes[c] = m_planes[c].getRow(y).data();
+        }
+        interleaveRow(planes, view.getRow(y).data(), channels, m_width);
+    }
+
+    return makeVoidSuccessResult();
+}
+
+Result<std::unique_ptr<ColorImage>> PlanarImage::toColorImage(Image::RowLayout layout) const {
+    try {
+        auto image = std::make_unique<ColorImage>(m_width, m_height, hasAlpha(), layout);
+        auto written = toInterleaved(image->mutableView());
+        if (!written) {
+            return makeErrorResult<std::unique_ptr<ColorImage>>(
+                written.error().code(), written.error().message());
+        }
+        return makeSuccessResult(std::move(image));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<ColorImage>>(
+            ErrorCode::ProcessingFailed,
+            std::format("Failed to interleave planes: {}", e.what()));
+    }
+}
+
+void PlanarImage::deinterleaveRow(const uint8_t* src,
+                                  uint8_t* const* planes,
+                                  int channels,
+                                  std::size_t pixels) noexcept {
+    std::size_t x = 0;
+
+#if defined(__SSE2__)
+    if (channels == 4) {
+        for (; x + 16 <= pixels; x += 16) {
+            const auto* block = reinterpret_cast<const __m128i*>(src + 4 * x);
+            const __m128i pixels4[4] = {_mm_loadu_si128(block), _mm_loadu_si128(block + 1),
+                                        _mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3)};
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[0] + x), gatherChannel4<0>(pixels4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[1] + x), gatherChannel4<8>(pixels4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[2] + x), gatherChannel4<16>(pixels4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[3] + x), gatherChannel4<24>(pixels4));
+        }
+    }
+#endif
+
+#if defined(__SSSE3__)
+    if (channels == 3) {
+        for (; x + 16 <= pixels; x += 16) {
+            const auto* block = reinterpret_cast<const __m128i*>(src + 3 * x);
+            const __m128i parts[3] = {_mm_loadu_si128(block), _mm_loadu_si128(block + 1),
+                                      _mm_loadu_si128(block + 2)};
+
+            for (int c = 0; c < 3; ++c) {
+                const __m128i plane =
+                    _mm_or_si128(_mm_or_si128(shuffle(parts[0], kDeinterleave3[c * 3]),
+                                              shuffle(parts[1], kDeinterleave3[c * 3 + 1])),
+                                 shuffle(parts[2], kDeinterleave3[c * 3 + 2]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[c] + x), plane);
+            }
+        }
+    }
+#endif
+
+    // Remaining pixels, and targets without the vector paths
+    for (; x < pixels; ++x) {
+        const uint8_t* pixel = src + x * channels;
+        for (int c = 0; c < channels; ++c) {
+            planes[c][x] = pixel[c];
+        }
+    }
+}
+
+void PlanarImage::interleaveRow(const uint8_t* const* planes,
+                                uint8_t* dst,
+                                int channels,
+                                std::size_t pixels) noexcept {
+    std::size_t x = 0;
+
+#if defined(__SSE2__)
+    if (channels == 4) {
+        for (; x + 16 <= pixels; x += 16) {
+            const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + x));
+            const __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + x));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[2] + x));
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[3] + x));
+
+            // Pair the bytes (rg, ba), then the pairs into 32-bit pixels
+            const __m128i rgLow = _mm_unpacklo_epi8(r, g);
+            const __m128i rgHigh = _mm_unpackhi_epi8(r, g);
+            const __m128i baLow = _mm_unpacklo_epi8(b, a);
+            const __m128i baHigh = _mm_unpackhi_epi8(b, a);
+
+            auto* block = reinterpret_cast<__m128i*>(dst + 4 * x);
+            _mm_storeu_si128(block, _mm_unpacklo_epi16(rgLow, baLow));
+            _mm_storeu_si128(block + 1, _mm_unpackhi_epi16(rgLow, baLow));
+            _mm_storeu_si128(block + 2, _mm_unpacklo_epi16(rgHigh, baHigh));
+            _mm_storeu_si128(block + 3, _mm_unpackhi_epi16(rgHigh, baHigh));
+        }
+    }
+#endif
+
+#if defined(__SSSE3__)
+    if (channels == 3) {
+        for (; x + 16 <= pixels; x += 16) {
+            const __m128i sources[3] = {
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + x)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + x)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[2] + x))};
+
+            auto* block = reinterpret_cast<__m128i*>(dst + 3 * x);
+            for (int part = 0; part < 3; ++part) {
+                const __m128i merged =
+                    _mm_or_si128(_mm_or_si128(shuffle(sources[0], kInterleave3[part * 3]),
+                                              shuffle(sources[1], kInterleave3[part * 3 + 1])),
+                                 shuffle(sources[2], kInterleave3[part * 3 + 2]));
+                _mm_storeu_si128(block + part, merged);
+            }
+        }
+    }
+#endif
+
+    for (; x < pixels; ++x) {
+        uint8_t* pixel = dst + x * channels;
+        for (int c = 0; c < channels; ++c) {
+            pixel[c] = planes[c][x];
+        }
+    }
+}
+
+}  // namespace DIPAL
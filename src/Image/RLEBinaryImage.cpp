@@ -0,0 +1,302 @@
+// src/Image/RLEBinaryImage.cpp
+#include "../../include/DIPAL/Image/RLEBinaryImage.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <stdexcept>
+
+namespace DIPAL {
+
+namespace {
+
+// Sets pixels [start, end) of a bit-packed row: partial bytes at the ends, memset between
+void setBits(uint8_t* row, int start, int end) noexcept {
+    int firstByte = start / 8;
+    const int lastByte = (end - 1) / 8;
+    const auto headMask = static_cast<uint8_t>(0xFF << (start % 8));
+    const auto tailMask = static_cast<uint8_t>(0xFF >> (7 - (end - 1) % 8));
+
+    if (firstByte == lastByte) {
+        row[firstByte] |= static_cast<uint8_t>(headMask & tailMask);
+        return;
+    }
+    row[firstByte++] |= headMask;
+    if (lastByte > firstByte) {
+        std::memset(row + firstByte, 0xFF, static_cast<std::size_t>(lastByte - firstByte));
+    }
+    row[lastByte] |= tailMask;
+}
+
+struct AndOp {
+    static bool apply(bool a, bool b) noexcept { return a && b; }
+};
+
+struct OrOp {
+    static bool apply(bool a, bool b) noexcept { return a || b; }
+};
+
+struct XorOp {
+    static bool apply(bool a, bool b) noexcept { return a != b; }
+};
+
+struct DifferenceOp {
+    static bool apply(bool a, bool b) noexcept { return a && !b; }
+};
+
+// Merges two sorted run lists by sweeping over their boundaries; the output
+// is white wherever Op holds for the inputs
+template <typename Op, typename Out>
+void combineRow(std::span<const RLEBinaryImage::Run> a,
+                std::span<const RLEBinaryImage::Run> b,
+                Out& out,
+                std::size_t rowBegin) {
+    constexpr int kNone = std::numeric_limits<int>::max();
+    std::size_t i = 0;
+    std::size_t j = 0;
+    bool inA = false;
+    bool inB = false;
+    bool inOut = false;
+    int outStart = 0;
+
+    while (true) {
+        const int nextA = i < a.size() ? (inA ? a[i].end : a[i].start) : kNone;
+        const int nextB = j < b.size() ? (inB ? b[j].end : b[j].start) : kNone;
+        const int x = std::min(nextA, nextB);
+        if (x == kNone) {
+            break;
+        }
+        if (nextA == x) {
+            i += inA ? 1 : 0;
+            inA = !inA;
+        }
+        if (nextB == x) {
+            j += inB ? 1 : 0;
+            inB = !inB;
+        }
+
+        const bool now = Op::apply(inA, inB);
+        if (now && !inOut) {
+            outStart = x;
+        } else if (!now && inOut) {
+            // A run starting where the previous one of this row ended
+            // continues it; out[0, rowBegin) holds the earlier rows
+            if (out.size() > rowBegin && out.back().end == outStart) {
+                out.back().end = x;
+            } else {
+                out.push_back({outStart, x});
+            }
+        }
+        inOut = now;
+    }
+}
+
+}  // namespace
+
+RLEBinaryImage::RLEBinaryImage(int width, int height) : m_width(width), m_height(height) {
+    if (width < 0 || height < 0) {
+        throw std::invalid_argument("Image dimensions must not be negative");
+    }
+    m_rowOffsets.assign(static_cast<std::size_t>(height) + 1, 0);
+}
+
+Result<RLEBinaryImage> RLEBinaryImage::fromBinaryImage(const BinaryImage& image) {
+    try {
+        RLEBinaryImage result(image.getWidth(), image.getHeight());
+        const auto width = static_cast<std::size_t>(image.getWidth());
+        for (int y = 0; y < image.getHeight(); ++y) {
+            BinaryImage::forEachRun(image.getRow(y).data(), width,
+                                    [&](std::size_t start, std::size_t end) {
+                                        result.m_runs.push_back(
+                                            {static_cast<int>(start), static_cast<int>(end)});
+                                    });
+            result.m_rowOffsets[static_cast<std::size_t>(y) + 1] =
+                static_cast<uint32_t>(result.m_runs.size());
+        }
+        return makeSuccessResult(std::move(result));
+    } catch (const std::exception& e) {
+        return makeErrorResult<RLEBinaryImage>(
+            ErrorCode::ProcessingFailed,
+            std::format("Failed to run-length encode binary image: {}", e.what()));
+    }
+}
+
+Result<std::unique_ptr<BinaryImage>> RLEBinaryImage::toBinaryImage(Image::RowLayout layout) const {
+    try {
+        auto image = std::make_unique<BinaryImage>(m_width, m_height, layout);
+        for (int y = 0; y < m_height; ++y) {
+            const auto runs = getRow(y);
+            if (runs.empty()) {
+                continue;
+            }
+            uint8_t* row = image->getRow(y).data();
+            for (const Run& run : runs) {
+                setBits(row, run.start, run.end);
+            }
+        }
+        return makeSuccessResult(std::move(image));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<BinaryImage>>(
+            ErrorCode::ProcessingFailed,
+            std::format("Failed to decode run-length encoded image: {}", e.what()));
+    }
+}
+
+std::span<const RLEBinaryImage::Run> RLEBinaryImage::getRow(int y) const {
+    if (y < 0 || y >= m_height) {
+        throw std::out_of_range("Row index out of range");
+    }
+    const uint32_t first = m_rowOffsets[static_cast<std::size_t>(y)];
+    const uint32_t last = m_rowOffsets[static_cast<std::size_t>(y) + 1];
+    return {m_runs.data() + first, last - first};
+}
+
+VoidResult RLEBinaryImage::setRow(int y, std::span<const Run> runs) {
+    if (y < 0 || y >= m_height) {
+        return makeVoidErrorResult(ErrorCode::OutOfRange, "Row index out of range");
+    }
+
+    RunStorage merged;
+    for (const Run& run : runs) {
+        if (run.start < 0 || run.end > m_width || run.start >= run.end) {
+            return makeVoidErrorResult(
+                ErrorCode::InvalidParameter,
+                std::format("Run [{}, {}) is empty or outside the row", run.start, run.end));
+        }
+        if (!merged.empty() && run.start < merged.back().end) {
+            return makeVoidErrorResult(ErrorCode::InvalidParameter,
+                                       "Runs must be sorted and must not overlap");
+        }
+        if (!merged.empty() && run.start == merged.back().end) {
+            merged.back().end = run.end;
+        } else {
+            merged.push_back(run);
+        }
+    }
+
+    try {
+        const std::size_t begin = m_rowOffsets[static_cast<std::size_t>(y)];
+        const std::size_t removed = m_rowOffsets[static_cast<std::size_t>(y) + 1] - begin;
+
+        // Build the new run list aside and swap it in, so a failed
+        // allocation leaves the image unchanged
+        RunStorage runsAfter;
+        runsAfter.reserve(m_runs.size() - removed + merged.size());
+        runsAfter.insert(runsAfter.end(), m_runs.begin(),
+                         m_runs.begin() + static_cast<std::ptrdiff_t>(begin));
+        runsAfter.insert(runsAfter.end(), merged.begin(), merged.end());
+        runsAfter.insert(runsAfter.end(),
+                         m_runs.begin() + static_cast<std::ptrdiff_t>(begin + removed),
+                         m_runs.end());
+        m_runs.swap(runsAfter);
+
+        const auto delta = static_cast<int64_t>(merged.size()) - static_cast<int64_t>(removed);
+        for (std::size_t row = static_cast<std::size_t>(y) + 1; row < m_rowOffsets.size(); ++row) {
+            m_rowOffsets[row] = static_cast<uint32_t>(m_rowOffsets[row] + delta);
+        }
+    } catch (const std::exception& e) {
+        return makeVoidErrorResult(ErrorCode::ProcessingFailed,
+                                   std::format("Failed to set row: {}", e.what()));
+    }
+    return makeVoidSuccessResult();
+}
+
+Result<bool> RLEBinaryImage::getPixel(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        return makeErrorResult<bool>(ErrorCode::OutOfRange, "Pixel coordinates out of range");
+    }
+    const auto runs = getRow(y);
+    // First run ending after x; x is white if that run starts at or before it
+    const auto it = std::upper_bound(runs.begin(), runs.end(), x,
+                                     [](int value, const Run& run) { return value < run.end; });
+    return makeSuccessResult(it != runs.end() && it->start <= x);
+}
+
+std::size_t RLEBinaryImage::getRunCount() const noexcept {
+    return m_runs.size();
+}
+
+std::size_t RLEBinaryImage::area() const noexcept {
+    std::size_t total = 0;
+    for (const Run& run : m_runs) {
+        total += static_cast<std::size_t>(run.end - run.start);
+    }
+    return total;
+}
+
+std::optional<Rect> RLEBinaryImage::boundingBox() const noexcept {
+    int top = -1;
+    int bottom = -1;
+    int left = m_width;
+    int right = 0;
+    for (int y = 0; y < m_height; ++y) {
+        const uint32_t first = m_rowOffsets[static_cast<std::size_t>(y)];
+        const uint32_t last = m_rowOffsets[static_cast<std::size_t>(y) + 1];
+        if (first == last) {
+            continue;
+        }
+        // Runs are sorted, so only the first and last run of a row matter
+        top = top < 0 ? y : top;
+        bottom = y;
+        left = std::min(left, m_runs[first].start);
+        right = std::max(right, m_runs[last - 1].end);
+    }
+    if (top < 0) {
+        return std::nullopt;
+    }
+    return Rect(left, top, right - left, bottom - top + 1);
+}
+
+std::size_t RLEBinaryImage::getDataSize() const noexcept {
+    return m_runs.size() * sizeof(Run) + m_rowOffsets.size() * sizeof(uint32_t);
+}
+
+template <typename Op>
+Result<RLEBinaryImage> RLEBinaryImage::combine(const RLEBinaryImage& a,
+                                               const RLEBinaryImage& b,
+                                               const char* name) {
+    if (a.m_width != b.m_width || a.m_height != b.m_height) {
+        return makeErrorResult<RLEBinaryImage>(
+            ErrorCode::InvalidParameter,
+            std::format("Cannot {} images of different sizes ({}x{} and {}x{})", name, a.m_width,
+                        a.m_height, b.m_width, b.m_height));
+    }
+
+    try {
+        RLEBinaryImage result(a.m_width, a.m_height);
+        result.m_runs.reserve(std::max(a.m_runs.size(), b.m_runs.size()));
+        for (int y = 0; y < a.m_height; ++y) {
+            combineRow<Op>(a.getRow(y), b.getRow(y), result.m_runs, result.m_runs.size());
+            result.m_rowOffsets[static_cast<std::size_t>(y) + 1] =
+                static_cast<uint32_t>(result.m_runs.size());
+        }
+        return makeSuccessResult(std::move(result));
+    } catch (const std::exception& e) {
+        return makeErrorResult<RLEBinaryImage>(
+            ErrorCode::ProcessingFailed, std::format("Failed to {} images: {}", name, e.what()));
+    }
+}
+
+Result<RLEBinaryImage> RLEBinaryImage::logicalAnd(const RLEBinaryImage& a, const RLEBinaryImage& b) {
+    return combine<AndOp>(a, b, "AND");
+}
+
+Result<RLEBinaryImage> RLEBinaryImage::logicalOr(const RLEBinaryImage& a, const RLEBinaryImage& b) {
+    return combine<OrOp>(a, b, "OR");
+}
+
+Result<RLEBinaryImage> RLEBinaryImage::logicalXor(const RLEBinaryImage& a, const RLEBinaryImage& b) {
+    return combine<XorOp>(a, b, "XOR");
+}
+
+Result<RLEBinaryImage> RLEBinaryImage::difference(const RLEBinaryImage& a, const RLEBinaryImage& b) {
+    return combine<DifferenceOp>(a, b, "subtract");
+}
+
+bool RLEBinaryImage::operator==(const RLEBinaryImage& other) const noexcept {
+    return m_width == other.m_width && m_height == other.m_height && m_runs == other.m_runs &&
+           m_rowOffsets == other.m_rowOffsets;
+}
+
+}  // namespace DIPAL
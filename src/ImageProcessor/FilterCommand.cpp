@@ -24,4 +24,8 @@ bool FilterCommand::isUndoable() const {
     return false;  // Filters are generally not undoable
 }
 
+const FilterStrategy& FilterCommand::getFilter() const noexcept {
+    return *m_filter;
+}
+
 } // namespace DIPAL
@@ -1,6 +1,7 @@
 // src/ImageProcessor/ImageProcessor.cpp
 #include "../../include/DIPAL/ImageProcessor/ImageProcessor.hpp"
 #include "../../include/DIPAL/ImageProcessor/FilterCommand.hpp"
+#include "../../include/DIPAL/Filters/FilterPipeline.hpp"
 
 #include <algorithm>
 #include <format>
@@ -91,8 +92,8 @@ Result<std::unique_ptr<Image>> ImageProcessor::processAll(
     notifyProgressUpdated(progress);
 
     try {
-        for (auto& command : commands) {
-            if (!command) {
+        for (size_t i = 0; i < commands.size();) {
+            if (!commands[i]) {
                 notifyError("Null command in pipeline");
                 notifyProcessingCompleted("Processing Pipeline", false);
                 return makeErrorResult<std::unique_ptr<Image>>(
@@ -101,6 +102,28 @@ Result<std::unique_ptr<Image>> ImageProcessor::processAll(
                 );
             }
 
+            // Consecutive filters run as one tiled pipeline, without a
+            // full-size intermediate image between them
+            size_t end = i + 1;
+            while (end < commands.size() &&
+                   dynamic_cast<const FilterCommand*>(commands[i].get()) &&
+                   dynamic_cast<const FilterCommand*>(commands[end].get())) {
+                ++end;
+            }
+
+            std::unique_ptr<ProcessingCommand> command;
+            if (end - i > 1) {
+                auto pipeline = std::make_unique<FilterPipeline>();
+                for (size_t j = i; j < end; ++j) {
+                    pipeline->addStage(
+                        static_cast<const FilterCommand&>(*commands[j]).getFilter().clone());
+                    commands[j].reset();
+                }
+                command = std::make_unique<FilterCommand>(std::move(pipeline));
+            } else {
+                command = std::move(commands[i]);
+            }
+
             auto result = process(*currentImage, std::move(command));
             if (!result) {
                 notifyProcessingCompleted("Processing Pipeline", false);
@@ -108,7 +131,8 @@ Result<std::unique_ptr<Image>> ImageProcessor::processAll(
             }
 
             currentImage = std::move(result.value());
-            progress += stepSize;
+            progress += stepSize * static_cast<float>(end - i);
+            i = end;
             notifyProgressUpdated(progress);
         }
 
@@ -1,10 +1,12 @@
 // src/ImageProcessor/ParallelProcessor.cpp
 #include "../../include/DIPAL/ImageProcessor/ParallelProcessor.hpp"
 
-#include "../../include/DIPAL/Image/ColorImage.hpp"
-#include "../../include/DIPAL/Image/GrayscaleImage.hpp"
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+
+#include "../../include/DIPAL/Image/ImageView.hpp"
 #include "../../include/DIPAL/Utils/Concurrency.hpp"
 
+#include <algorithm>
 #include <format>
 #include <future>
 #include <vector>
@@ -17,171 +19,97 @@ Result<std::unique_ptr<Image>> ParallelProcessor::applyFilter(const Image& image
     notifyProgressUpdated(0.0f);
 
     try {
-        // For small images, delegate to the base class implementation
-        if (image.getWidth() * image.getHeight() < 100000) {  // Arbitrary threshold
-            return ImageProcessor::applyFilter(image, filter);
-        }
-
-        // For larger images, divide the work among threads
-        auto result = image.clone();
         int width = image.getWidth();
         int height = image.getHeight();
 
         if (width == 0 || height == 0) {
+            notifyError(std::format("Filter '{}' failed: empty image", filter.getName()));
+            notifyProcessingCompleted(filter.getName(), false);
             return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
                                                            "Cannot apply filter to an empty image");
         }
 
-        // Process the image in horizontal strips
+        // For small images, and filters that need the whole image at once,
+        // delegate to the base class implementation
+        const FilterFootprint footprint = filter.getFootprint();
+        if (static_cast<size_t>(width) * static_cast<size_t>(height) < kParallelPixels ||
+            !footprint.local) {
+            return ImageProcessor::applyFilter(image, filter);
+        }
+
+        // For larger images, divide the work among threads. The output type
+        // and depth follow the filter (e.g. Sobel turns color into grayscale)
+        const ImageView source = image.view();
+        auto created = createFilterOutput(filter, source, width, height, image.getRowLayout());
+        if (!created) {
+            notifyError(std::format("Filter '{}' failed: {}", filter.getName(),
+                                    created.error().message()));
+            notifyProcessingCompleted(filter.getName(), false);
+            return created;
+        }
+        std::unique_ptr<Image> result = std::move(created.value());
+        const MutableImageView destination = result->mutableView();
+
+        // Process the image in horizontal strips. Each strip reads a zero-copy
+        // view of the source that includes the rows the filter reads above and
+        // below it, so strip borders match a whole-image run, and writes
+        // straight into its rows of the result. Strip i always goes to worker
+        // i so it runs where its memory was first touched.
         size_t numStrips = m_threadPool->getThreadCount();
-        std::vector<std::future<Result<void>>> futures;
-
-        // Different processing based on image type
-        if (image.getType() == Image::Type::Grayscale) {
-            auto& srcGray = static_cast<const GrayscaleImage&>(image);
-            auto& dstGray = static_cast<GrayscaleImage&>(*result);
-
-            for (size_t i = 0; i < numStrips; ++i) {
-                int startY = static_cast<int>((height * i) / numStrips);
-                int endY = static_cast<int>((height * (i + 1)) / numStrips);
-
-                futures.push_back(m_threadPool->submit(
-                    [&srcGray, &dstGray, startY, endY, width, &filter]() -> Result<void> {
-                        // Create a temporary image for this strip
-                        auto stripImage = std::make_unique<GrayscaleImage>(width, endY - startY);
-
-                        // Copy data from source to strip
-                        for (int y = 0; y < endY - startY; ++y) {
-                            for (int x = 0; x < width; ++x) {
-                                auto pixelResult = srcGray.getPixel(x, y + startY);
-                                if (!pixelResult) {
-                                    return makeVoidErrorResult(pixelResult.error().code(),
-                                                               pixelResult.error().message());
-                                }
-
-                                auto setResult = stripImage->setPixel(x, y, pixelResult.value());
-                                if (!setResult) {
-                                    return makeVoidErrorResult(setResult.error().code(),
-                                                               setResult.error().message());
-                                }
-                            }
-                        }
-
-                        // Apply filter to the strip
-                        auto processedResult = filter.apply(*stripImage);
-                        if (!processedResult) {
-                            return makeVoidErrorResult(processedResult.error().code(),
-                                                       processedResult.error().message());
-                        }
-
-                        // Copy result back
-                        auto& processedStrip =
-                            static_cast<GrayscaleImage&>(*processedResult.value());
-                        for (int y = 0; y < endY - startY; ++y) {
-                            for (int x = 0; x < width; ++x) {
-                                auto pixelResult = processedStrip.getPixel(x, y);
-                                if (!pixelResult) {
-                                    return makeVoidErrorResult(pixelResult.error().code(),
-                                                               pixelResult.error().message());
-                                }
-
-                                auto setResult =
-                                    dstGray.setPixel(x, y + startY, pixelResult.value());
-                                if (!setResult) {
-                                    return makeVoidErrorResult(setResult.error().code(),
-                                                               setResult.error().message());
-                                }
-                            }
-                        }
-
-                        return makeVoidSuccessResult();
-                    }));
-            }
-        } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
-            auto& srcColor = static_cast<const ColorImage&>(image);
-            auto& dstColor = static_cast<ColorImage&>(*result);
-            bool hasAlpha = srcColor.hasAlpha();
-
-            for (size_t i = 0; i < numStrips; ++i) {
-                int startY = static_cast<int>((height * i) / numStrips);
-                int endY = static_cast<int>((height * (i + 1)) / numStrips);
-
-                futures.push_back(m_threadPool->submit(
-                    [&srcColor, &dstColor, startY, endY, width, hasAlpha, &filter]()
-                        -> Result<void> {
-                        // Create a temporary image for this strip
-                        auto stripImage =
-                            std::make_unique<ColorImage>(width, endY - startY, hasAlpha);
-
-                        // Copy data from source to strip
-                        for (int y = 0; y < endY - startY; ++y) {
-                            for (int x = 0; x < width; ++x) {
-                                uint8_t r, g, b, a;
-                                auto pixelResult = srcColor.getPixel(x, y + startY, r, g, b, a);
-                                if (!pixelResult) {
-                                    return makeVoidErrorResult(pixelResult.error().code(),
-                                                               pixelResult.error().message());
-                                }
-
-                                auto setResult = stripImage->setPixel(x, y, r, g, b, a);
-                                if (!setResult) {
-                                    return makeVoidErrorResult(setResult.error().code(),
-                                                               setResult.error().message());
-                                }
-                            }
-                        }
-
-                        // Apply filter to the strip
-                        auto processedResult = filter.apply(*stripImage);
-                        if (!processedResult) {
-                            return makeVoidErrorResult(processedResult.error().code(),
-                                                       processedResult.error().message());
-                        }
-
-                        // Copy result back
-                        auto& processedStrip = static_cast<ColorImage&>(*processedResult.value());
-                        for (int y = 0; y < endY - startY; ++y) {
-                            for (int x = 0; x < width; ++x) {
-                                uint8_t r, g, b, a;
-                                auto pixelResult = processedStrip.getPixel(x, y, r, g, b, a);
-                                if (!pixelResult) {
-                                    return makeVoidErrorResult(pixelResult.error().code(),
-                                                               pixelResult.error().message());
-                                }
-
-                                auto setResult = dstColor.setPixel(x, y + startY, r, g, b, a);
-                                if (!setResult) {
-                                    return makeVoidErrorResult(setResult.error().code(),
-                                                               setResult.error().message());
-                                }
-                            }
-                        }
-
-                        return makeVoidSuccessResult();
-                    }));
+        std::vector<std::future<VoidResult>> futures;
+
+        for (size_t i = 0; i < numStrips; ++i) {
+            const auto [first, last] =
+                partitionRange(static_cast<size_t>(height), numStrips, i);
+            const int startY = static_cast<int>(first);
+            const int endY = static_cast<int>(last);
+            if (endY <= startY) {
+                continue;
             }
-        } else {
-            return makeErrorResult<std::unique_ptr<Image>>(
-                ErrorCode::UnsupportedFormat,
-                std::format("Unsupported image type: {}", static_cast<int>(image.getType())));
+
+            const Rect strip(0, startY, width, endY - startY);
+            const int haloTop = std::min(footprint.top, startY);
+            const int haloBottom = std::min(footprint.bottom, height - endY);
+            const Rect input(0, startY - haloTop, width, strip.height + haloTop + haloBottom);
+            futures.push_back(m_threadPool->submitTo(
+                i,
+                [source, destination, strip, input, haloTop, &filter]() -> VoidResult {
+                    auto stripView = source.crop(input);
+                    if (!stripView) {
+                        return makeVoidErrorResult(stripView.error().code(),
+                                                   stripView.error().message());
+                    }
+                    auto target = destination.crop(strip);
+                    if (!target) {
+                        return makeVoidErrorResult(target.error().code(),
+                                                   target.error().message());
+                    }
+                    MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+                    return filter.applyTile(stripView.value(),
+                                            Rect(0, haloTop, strip.width, strip.height),
+                                            target.value());
+                }));
         }
 
         // Wait for all strips to be processed
         for (size_t i = 0; i < futures.size(); ++i) {
-            auto& future = futures[i];
-            auto stripResult = future.get();
+            auto status = futures[i].get();
 
             // Update progress after each strip is completed
-            notifyProgressUpdated(static_cast<float>(i + 1) / numStrips);
+            notifyProgressUpdated(static_cast<float>(i + 1) / futures.size());
 
-            if (!stripResult) {
+            if (!status) {
+                // Drain the remaining strips so no task outlives the filter reference
+                for (size_t j = i + 1; j < futures.size(); ++j) {
+                    futures[j].wait();
+                }
                 notifyError(std::format("Filter '{}' failed on strip {}: {}",
                                         filter.getName(),
                                         i,
-                                        stripResult.error().message()));
+                                        status.error().message()));
                 notifyProcessingCompleted(filter.getName(), false);
-                return makeErrorResult<std::unique_ptr<Image>>(stripResult.error().code(),
-                                                               stripResult.error().message());
+                return makeErrorResult<std::unique_ptr<Image>>(status.error().code(),
+                                                               status.error().message());
             }
         }
 
@@ -199,11 +127,15 @@ Result<std::unique_ptr<Image>> ParallelProcessor::applyFilter(const Image& image
 
 void ParallelProcessor::setThreadCount(size_t numThreads) {
     // If m_numThreads isn't available, just store the value in the ThreadPool
-    m_threadPool = std::make_unique<ThreadPool>(numThreads);
+    m_threadPool = std::make_shared<ThreadPool>(numThreads);
 }
 
 size_t ParallelProcessor::getThreadCount() const {
     return m_threadPool ? m_threadPool->getThreadCount() : 0;
 }
 
+std::shared_ptr<ThreadPool> ParallelProcessor::getThreadPool() const {
+    return m_threadPool;
+}
+
 }  // namespace DIPAL
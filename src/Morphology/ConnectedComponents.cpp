@@ -0,0 +1,299 @@
+// src/Morphology/ConnectedComponents.cpp
+#include "../../include/DIPAL/Morphology/ConnectedComponents.hpp"
+
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace DIPAL {
+
+// LabelImage
+
+LabelImage::LabelImage(int width, int height) : m_width(width), m_height(height) {
+    if (width < 0 || height < 0) {
+        throw std::invalid_argument("Label image dimensions must not be negative");
+    }
+    m_labels.assign(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), 0);
+}
+
+uint32_t LabelImage::at(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        throw std::out_of_range("Label coordinates out of range");
+    }
+    return m_labels[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_width) +
+                    static_cast<std::size_t>(x)];
+}
+
+std::span<const uint32_t> LabelImage::getRow(int y) const {
+    if (y < 0 || y >= m_height) {
+        throw std::out_of_range("Label row out of range");
+    }
+    return {m_labels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(m_width),
+            static_cast<std::size_t>(m_width)};
+}
+
+std::span<uint32_t> LabelImage::getRow(int y) {
+    if (y < 0 || y >= m_height) {
+        throw std::out_of_range("Label row out of range");
+    }
+    return {m_labels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(m_width),
+            static_cast<std::size_t>(m_width)};
+}
+
+// ConnectedComponents
+
+namespace {
+
+inline std::size_t pixelCount(const BinaryImage& image) noexcept {
+    return static_cast<std::size_t>(image.getWidth()) * static_cast<std::size_t>(image.getHeight());
+}
+
+// A horizontal run of foreground pixels, [start, end] inclusive
+struct Run {
+    int y;
+    int start;
+    int end;
+};
+
+inline uint32_t findRoot(uint32_t* parent, uint32_t i) noexcept {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];  // path halving
+        i = parent[i];
+    }
+    return i;
+}
+
+// The smaller index becomes the root, so every root is its set's first run in raster order
+inline void unite(uint32_t* parent, uint32_t a, uint32_t b) noexcept {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a < b) {
+        parent[b] = a;
+    } else if (b < a) {
+        parent[a] = b;
+    }
+}
+
+// Calls unite for every pair of overlapping runs of two consecutive rows
+// (runs are sorted by start within a row)
+template <typename Unite>
+void connectRows(const Run* above, std::size_t aboveCount, uint32_t aboveFirst,
+                 const Run* below, std::size_t belowCount, uint32_t belowFirst,
+                 int reach, Unite&& uniteRuns) {
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < aboveCount && j < belowCount) {
+        const Run& a = above[i];
+        const Run& b = below[j];
+        if (a.end + reach < b.start) {
+            ++i;
+        } else if (b.end + reach < a.start) {
+            ++j;
+        } else {
+            uniteRuns(aboveFirst + static_cast<uint32_t>(i), belowFirst + static_cast<uint32_t>(j));
+            // Advance the run that ends first; the other may overlap more runs
+            if (a.end < b.end) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+    }
+}
+
+// Runs and union-find forest of one strip of rows, with strip-local indices
+struct Strip {
+    int firstRow = 0;
+    int endRow = 0;
+    TemporaryBuffer<Run> runs;
+    TemporaryBuffer<uint32_t> parent;
+    TemporaryBuffer<uint32_t> rowFirstRun;  // endRow - firstRow + 1 entries
+};
+
+void labelStrip(const BinaryImage& image, int reach, Strip& strip) {
+    const int width = image.getWidth();
+    const int rows = strip.endRow - strip.firstRow;
+    strip.rowFirstRun.assign(static_cast<std::size_t>(rows) + 1, 0);
+
+    for (int r = 0; r < rows; ++r) {
+        const int y = strip.firstRow + r;
+        const auto first = static_cast<uint32_t>(strip.runs.size());
+        strip.rowFirstRun[static_cast<std::size_t>(r)] = first;
+        BinaryImage::forEachRun(image.getRow(y).data(), static_cast<std::size_t>(width),
+                                [&](std::size_t start, std::size_t end) {
+                                    strip.runs.push_back(
+                                        {y, static_cast<int>(start), static_cast<int>(end) - 1});
+                                });
+
+        for (auto i = first; i < strip.runs.size(); ++i) {
+            strip.parent.push_back(i);
+        }
+        if (r > 0) {
+            const uint32_t previous = strip.rowFirstRun[static_cast<std::size_t>(r - 1)];
+            connectRows(strip.runs.data() + previous, first - previous, previous,
+                        strip.runs.data() + first, strip.runs.size() - first, first, reach,
+                        [&](uint32_t a, uint32_t b) { unite(strip.parent.data(), a, b); });
+        }
+    }
+    strip.rowFirstRun[static_cast<std::size_t>(rows)] = static_cast<uint32_t>(strip.runs.size());
+}
+
+// Runs of the whole image with their final labels
+struct Labeled {
+    std::vector<Strip> strips;
+    std::vector<uint32_t> offsets;       // global index of each strip's first run
+    TemporaryBuffer<uint32_t> runLabel;  // label of every run, global order
+    uint32_t count = 0;
+};
+
+Labeled labelRuns(const BinaryImage& image, Connectivity connectivity, ThreadPool* pool) {
+    const int height = image.getHeight();
+    const int reach = connectivity == Connectivity::Eight ? 1 : 0;
+    const std::size_t stripCount =
+        std::clamp<std::size_t>(pool ? pool->getThreadCount() : 1, 1,
+                                static_cast<std::size_t>(std::max(height, 1)));
+
+    Labeled result;
+    result.strips.resize(stripCount);
+    for (std::size_t i = 0; i < stripCount; ++i) {
+        const auto [first, last] = partitionRange(static_cast<std::size_t>(height), stripCount, i);
+        result.strips[i].firstRow = static_cast<int>(first);
+        result.strips[i].endRow = static_cast<int>(last);
+    }
+
+    forEachPart(pool, stripCount,
+                [&](std::size_t i) { labelStrip(image, reach, result.strips[i]); });
+
+    // Global forest: strip-local parents shifted by the strip's run offset
+    std::size_t total = 0;
+    result.offsets.resize(stripCount);
+    for (std::size_t i = 0; i < stripCount; ++i) {
+        result.offsets[i] = static_cast<uint32_t>(total);
+        total += result.strips[i].runs.size();
+    }
+    if (total >= std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Too many runs to label");
+    }
+
+    TemporaryBuffer<uint32_t> parent(total);
+    for (std::size_t i = 0; i < stripCount; ++i) {
+        const auto& strip = result.strips[i];
+        for (std::size_t k = 0; k < strip.parent.size(); ++k) {
+            parent[result.offsets[i] + k] = strip.parent[k] + result.offsets[i];
+        }
+    }
+
+    // Border merge: last row of each strip against the first row of the next
+    for (std::size_t i = 0; i + 1 < stripCount; ++i) {
+        const Strip& upper = result.strips[i];
+        const Strip& lower = result.strips[i + 1];
+        if (upper.endRow <= upper.firstRow || lower.endRow <= lower.firstRow) {
+            continue;
+        }
+        const uint32_t upperRows = static_cast<uint32_t>(upper.endRow - upper.firstRow);
+        const uint32_t aboveBegin = upper.rowFirstRun[upperRows - 1];
+        const uint32_t aboveEnd = upper.rowFirstRun[upperRows];
+        const uint32_t belowEnd = lower.rowFirstRun[1];
+        connectRows(upper.runs.data() + aboveBegin, aboveEnd - aboveBegin,
+                    result.offsets[i] + aboveBegin, lower.runs.data(), belowEnd,
+                    result.offsets[i + 1], reach,
+                    [&](uint32_t a, uint32_t b) { unite(parent.data(), a, b); });
+    }
+
+    // Roots are first runs in raster order, so numbering roots in run order
+    // numbers components by their first pixel
+    result.runLabel.resize(total);
+    for (uint32_t i = 0; i < total; ++i) {
+        const uint32_t root = findRoot(parent.data(), i);
+        result.runLabel[i] = root == i ? ++result.count : result.runLabel[root];
+    }
+    return result;
+}
+
+}  // namespace
+
+Result<ComponentLabeling> ConnectedComponents::label(const BinaryImage& image,
+                                                     Connectivity connectivity,
+                                                     ThreadPool* pool) {
+    try {
+        ThreadPool* workers = pool ? pool : sharedPoolFor(pixelCount(image));
+
+        const Labeled labeled = labelRuns(image, connectivity, workers);
+
+        ComponentLabeling result{LabelImage(image.getWidth(), image.getHeight()), {}};
+
+        // Paint the runs strip by strip; strips own disjoint rows
+        forEachPart(workers, labeled.strips.size(), [&](std::size_t i) {
+            const Strip& strip = labeled.strips[i];
+            for (std::size_t k = 0; k < strip.runs.size(); ++k) {
+                const Run& run = strip.runs[k];
+                auto row = result.labels.getRow(run.y);
+                std::fill(row.begin() + run.start, row.begin() + run.end + 1,
+                          labeled.runLabel[labeled.offsets[i] + k]);
+            }
+        });
+
+        // Statistics accumulate per run: O(runs), not O(pixels)
+        struct Accumulator {
+            std::size_t area = 0;
+            double sumX = 0;
+            double sumY = 0;
+            int minX = std::numeric_limits<int>::max();
+            int minY = std::numeric_limits<int>::max();
+            int maxX = -1;
+            int maxY = -1;
+        };
+        std::vector<Accumulator> accumulators(labeled.count);
+        for (std::size_t i = 0; i < labeled.strips.size(); ++i) {
+            const Strip& strip = labeled.strips[i];
+            for (std::size_t k = 0; k < strip.runs.size(); ++k) {
+                const Run& run = strip.runs[k];
+                auto& acc = accumulators[labeled.runLabel[labeled.offsets[i] + k] - 1];
+                const auto length = static_cast<std::size_t>(run.end - run.start + 1);
+                acc.area += length;
+                acc.sumX += static_cast<double>(length) * (run.start + run.end) / 2.0;
+                acc.sumY += static_cast<double>(length) * run.y;
+                acc.minX = std::min(acc.minX, run.start);
+                acc.maxX = std::max(acc.maxX, run.end);
+                acc.minY = std::min(acc.minY, run.y);
+                acc.maxY = std::max(acc.maxY, run.y);
+            }
+        }
+
+        result.components.resize(labeled.count);
+        for (uint32_t c = 0; c < labeled.count; ++c) {
+            const auto& acc = accumulators[c];
+            auto& stats = result.components[c];
+            stats.label = c + 1;
+            stats.area = acc.area;
+            stats.boundingBox =
+                Rect(acc.minX, acc.minY, acc.maxX - acc.minX + 1, acc.maxY - acc.minY + 1);
+            stats.centroidX = acc.sumX / static_cast<double>(acc.area);
+            stats.centroidY = acc.sumY / static_cast<double>(acc.area);
+        }
+
+        return makeSuccessResult(std::move(result));
+    } catch (const std::exception& e) {
+        return makeErrorResult<ComponentLabeling>(
+            ErrorCode::ProcessingFailed,
+            std::format("Connected-component labeling failed: {}", e.what()));
+    }
+}
+
+Result<std::size_t> ConnectedComponents::count(const BinaryImage& image,
+                                               Connectivity connectivity) {
+    try {
+        return makeSuccessResult(static_cast<std::size_t>(
+            labelRuns(image, connectivity, sharedPoolFor(pixelCount(image))).count));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::size_t>(
+            ErrorCode::ProcessingFailed,
+            std::format("Connected-component counting failed: {}", e.what()));
+    }
+}
+
+}  // namespace DIPAL
@@ -0,0 +1,181 @@
+// src/Morphology/DistanceTransform.cpp
+#include "../../include/DIPAL/Morphology/DistanceTransform.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+#include "../../include/DIPAL/Utils/Concurrency.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+
+namespace DIPAL {
+
+namespace {
+
+// Columns per unit of the column pass: one 64-bit word of source pixels
+constexpr int kBandColumns = 64;
+
+// Vertical distances of every pixel to the nearest target pixel in its column,
+// row-major; columns without a target hold infinity
+struct ColumnDistances {
+    TemporaryBuffer<int32_t> values;
+    int32_t infinity = 0;
+};
+
+// Column pass over columns [x0, x1): a downward then an upward scan. Walking
+// rows keeps the accesses sequential even though the distances are vertical.
+void columnPass(const BinaryImage& image, bool targetValue, int x0, int x1,
+                ColumnDistances& distances) {
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+    const int32_t infinity = distances.infinity;
+    int32_t* values = distances.values.data();
+
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* bits = image.getRow(y).data();
+        int32_t* row = values + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+        const int32_t* above = y > 0 ? row - width : row;
+        for (int x = x0; x < x1; ++x) {
+            const bool white = ((bits[x >> 3] >> (x & 7)) & 1) != 0;
+            if (white == targetValue) {
+                row[x] = 0;
+            } else {
+                row[x] = y == 0 ? infinity : std::min(above[x] + 1, infinity);
+            }
+        }
+    }
+    for (int y = height - 2; y >= 0; --y) {
+        int32_t* row = values + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+        const int32_t* below = row + width;
+        for (int x = x0; x < x1; ++x) {
+            row[x] = std::min(row[x], below[x] + 1);
+        }
+    }
+}
+
+// Floor of n / d for d > 0
+inline int64_t floorDiv(int64_t n, int64_t d) noexcept {
+    return n >= 0 ? n / d : -((-n + d - 1) / d);
+}
+
+// Row pass over rows [y0, y1): squared distance of every pixel as the lower
+// envelope of the parabolas (x - i)^2 + g(i)^2 of the row's column distances,
+// stored through convert(squared distance, squared infinity)
+template <typename Output, typename Convert>
+void rowPass(const ColumnDistances& distances, int y0, int y1, Output& output, Convert& convert) {
+    const int width = output.getWidth();
+    const int64_t infinity = int64_t{distances.infinity} * distances.infinity;
+    TemporaryBuffer<int32_t> sites(static_cast<std::size_t>(width));   // s: parabola apexes
+    TemporaryBuffer<int32_t> starts(static_cast<std::size_t>(width));  // t: where each takes over
+
+    for (int y = y0; y < y1; ++y) {
+        const int32_t* g =
+            distances.values.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+        auto* out = output.row(y);
+        const auto f = [g](int64_t x, int64_t i) { return (x - i) * (x - i) + int64_t{g[i]} * g[i]; };
+
+        int q = 0;
+        sites[0] = 0;
+        starts[0] = 0;
+        for (int u = 1; u < width; ++u) {
+            while (q >= 0 && f(starts[q], sites[q]) > f(starts[q], u)) {
+                --q;
+            }
+            if (q < 0) {
+                q = 0;
+                sites[0] = u;
+            } else {
+                // First x at which parabola u lies strictly below parabola s[q]
+                const int64_t i = sites[q];
+                const int64_t separation =
+                    floorDiv(int64_t{u} * u - i * i + int64_t{g[u]} * g[u] - int64_t{g[i]} * g[i],
+                             2 * (u - i));
+                const int64_t w = separation + 1;
+                if (w < width) {
+                    ++q;
+                    sites[q] = u;
+                    starts[q] = static_cast<int32_t>(w);
+                }
+            }
+        }
+        for (int u = width - 1; u >= 0; --u) {
+            out[u] = convert(f(u, sites[q]), infinity);
+            if (u == starts[q]) {
+                --q;
+            }
+        }
+    }
+}
+
+template <typename Output, typename Convert>
+Result<std::unique_ptr<Output>> run(const BinaryImage& image, DistanceTarget target,
+                                    ThreadPool* pool, Convert convert) {
+    try {
+        const int width = image.getWidth();
+        const int height = image.getHeight();
+        const std::size_t pixels = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+
+        ThreadPool* workers = pool ? pool : sharedPoolFor(pixels);
+        const std::size_t threads = workers ? workers->getThreadCount() : 1;
+
+        auto output = std::make_unique<Output>(width, height, image.getRowLayout());
+        if (pixels == 0) {
+            return makeSuccessResult(std::move(output));
+        }
+
+        // No real distance reaches width + height, so its square marks "no target"
+        ColumnDistances distances;
+        distances.infinity = width + height;
+        distances.values.resize(pixels);
+        const bool targetValue = target == DistanceTarget::Foreground;
+
+        const auto bands = static_cast<std::size_t>((width + kBandColumns - 1) / kBandColumns);
+        const std::size_t bandParts = std::min(threads, bands);
+        forEachPart(workers, bandParts, [&](std::size_t i) {
+            const auto [first, last] = partitionRange(bands, bandParts, i);
+            const int x0 = static_cast<int>(first) * kBandColumns;
+            const int x1 = std::min(width, static_cast<int>(last) * kBandColumns);
+            columnPass(image, targetValue, x0, x1, distances);
+        });
+
+        const std::size_t rowParts = std::min(threads, static_cast<std::size_t>(height));
+        forEachPart(workers, rowParts, [&](std::size_t i) {
+            const auto [first, last] = partitionRange(static_cast<std::size_t>(height), rowParts, i);
+            rowPass(distances, static_cast<int>(first), static_cast<int>(last), *output, convert);
+        });
+
+        return makeSuccessResult(std::move(output));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<Output>>(
+            ErrorCode::ProcessingFailed,
+            std::format("Distance transform failed: {}", e.what()));
+    }
+}
+
+}  // namespace
+
+Result<std::unique_ptr<GrayFloatImage>> DistanceTransform::compute(const BinaryImage& image,
+                                                                   DistanceTarget target,
+                                                                   ThreadPool* pool) {
+    return run<GrayFloatImage>(image, target, pool, [](int64_t squared, int64_t infinity) {
+        return squared >= infinity ? std::numeric_limits<float>::infinity()
+                                   : static_cast<float>(std::sqrt(static_cast<double>(squared)));
+    });
+}
+
+Result<std::unique_ptr<Gray16Image>> DistanceTransform::compute16(const BinaryImage& image,
+                                                                  DistanceTarget target,
+                                                                  ThreadPool* pool) {
+    return run<Gray16Image>(image, target, pool, [](int64_t squared, int64_t infinity) {
+        constexpr uint16_t kMax = std::numeric_limits<uint16_t>::max();
+        if (squared >= infinity) {
+            return kMax;
+        }
+        const double distance = std::round(std::sqrt(static_cast<double>(squared)));
+        return distance >= kMax ? kMax : static_cast<uint16_t>(distance);
+    });
+}
+
+}  // namespace DIPAL
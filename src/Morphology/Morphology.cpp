@@ -0,0 +1,389 @@
+// src/Morphology/Morphology.cpp
+#include "../../include/DIPAL/Morphology/Morphology.hpp"
+
+#include "../../include/DIPAL/Core/MemoryTracker.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <string_view>
+#include <utility>
+
+namespace DIPAL {
+
+namespace {
+
+using Word = uint64_t;
+constexpr int kWordBits = 64;
+constexpr Word kAllSet = ~Word{0};
+
+// Image as rows of 64-bit words, pixel x in bit x % 64 of word x / 64
+struct BitPlane {
+    BitPlane(int w, int h)
+        : width(w),
+          height(h),
+          words((w + kWordBits - 1) / kWordBits),
+          bits(static_cast<std::size_t>(words) * static_cast<std::size_t>(h), 0) {}
+
+    Word* row(int y) { return bits.data() + static_cast<std::size_t>(y) * words; }
+    const Word* row(int y) const { return bits.data() + static_cast<std::size_t>(y) * words; }
+
+    // Valid bits of the last word of a row
+    Word lastMask() const {
+        const int used = width % kWordBits;
+        return used == 0 ? kAllSet : kAllSet >> (kWordBits - used);
+    }
+
+    int width;
+    int height;
+    int words;
+    TemporaryBuffer<Word> bits;
+};
+
+struct AndOp {
+    static Word apply(Word a, Word b) noexcept { return a & b; }
+};
+
+struct OrOp {
+    static Word apply(Word a, Word b) noexcept { return a | b; }
+};
+
+BitPlane load(const BinaryImage& image) {
+    BitPlane plane(image.getWidth(), image.getHeight());
+    const std::size_t rowBytes = image.getRowBytes();
+    for (int y = 0; y < plane.height; ++y) {
+        const uint8_t* src = image.getRow(y).data();
+        Word* dst = plane.row(y);
+        if constexpr (std::endian::native == std::endian::little) {
+            std::memcpy(dst, src, rowBytes);
+        } else {
+            for (std::size_t i = 0; i < rowBytes; ++i) {
+                dst[i / 8] |= static_cast<Word>(src[i]) << (8 * (i % 8));
+            }
+        }
+        dst[plane.words - 1] &= plane.lastMask();
+    }
+    return plane;
+}
+
+std::unique_ptr<BinaryImage> store(const BitPlane& plane, Image::RowLayout layout) {
+    auto image = std::make_unique<BinaryImage>(plane.width, plane.height, layout);
+    const std::size_t rowBytes = image->getRowBytes();
+    const Word lastMask = plane.lastMask();
+    for (int y = 0; y < plane.height; ++y) {
+        uint8_t* dst = image->getRow(y).data();
+        const Word* src = plane.row(y);
+        for (std::size_t i = 0; i < rowBytes; ++i) {
+            Word word = src[i / 8];
+            if (i / 8 == static_cast<std::size_t>(plane.words - 1)) {
+                word &= lastMask;
+            }
+            dst[i] = static_cast<uint8_t>(word >> (8 * (i % 8)));
+        }
+    }
+    return image;
+}
+
+// Word i of a row, with pixels outside [0, width) reading as pad
+inline Word fetch(const Word* row, const BitPlane& plane, int i, Word pad) noexcept {
+    if (i < 0 || i >= plane.words) {
+        return pad;
+    }
+    if (i == plane.words - 1) {
+        const Word mask = plane.lastMask();
+        return (row[i] & mask) | (pad & ~mask);
+    }
+    return row[i];
+}
+
+// out(x) = row(x + dx) for every word of the row
+void shiftRow(const Word* row, const BitPlane& plane, int dx, Word pad, Word* out) noexcept {
+    // Floor division keeps the bit offset in [0, 64) for negative shifts
+    const int q = dx >= 0 ? dx / kWordBits : -((-dx + kWordBits - 1) / kWordBits);
+    const int r = dx - q * kWordBits;
+
+    // Words whose sources are interior words need no bounds handling
+    const int fastBegin = std::clamp(-q, 0, plane.words);
+    const int fastEnd = std::clamp(plane.words - 2 - q, fastBegin, plane.words);
+
+    auto shifted = [r](Word lo, Word hi) noexcept {
+        return r == 0 ? lo : (lo >> r) | (hi << (kWordBits - r));
+    };
+    for (int w = 0; w < fastBegin; ++w) {
+        out[w] = shifted(fetch(row, plane, w + q, pad), fetch(row, plane, w + q + 1, pad));
+    }
+    for (int w = fastBegin; w < fastEnd; ++w) {
+        out[w] = shifted(row[w + q], row[w + q + 1]);
+    }
+    for (int w = fastEnd; w < plane.words; ++w) {
+        out[w] = shifted(fetch(row, plane, w + q, pad), fetch(row, plane, w + q + 1, pad));
+    }
+}
+
+// Combines `length` consecutive pixels in place by doubling:
+// afterwards plane(x) = op of source(x + direction * k) for k in [0, length)
+template <typename Op>
+void horizontalDoubling(BitPlane& plane, int length, int direction, Word pad) {
+    TemporaryBuffer<Word> shifted(static_cast<std::size_t>(plane.words));
+    auto step = [&](int distance) {
+        for (int y = 0; y < plane.height; ++y) {
+            Word* row = plane.row(y);
+            shiftRow(row, plane, direction * distance, pad, shifted.data());
+            for (int w = 0; w < plane.words; ++w) {
+                row[w] = Op::apply(row[w], shifted[static_cast<std::size_t>(w)]);
+            }
+        }
+    };
+
+    int covered = 1;
+    while (covered * 2 <= length) {
+        step(covered);
+        covered *= 2;
+    }
+    // The two overlapping halves [0, covered) and [length - covered, length) cover the run
+    if (covered < length) {
+        step(length - covered);
+    }
+}
+
+// Vertical counterpart of horizontalDoubling; rows outside the image read as pad
+template <typename Op>
+void verticalDoubling(BitPlane& plane, int length, int direction, Word pad) {
+    auto step = [&](int distance) {
+        const int offset = direction * distance;
+        // Rows are updated in the order that leaves their sources untouched
+        for (int i = 0; i < plane.height; ++i) {
+            const int y = direction > 0 ? i : plane.height - 1 - i;
+            const int source = y + offset;
+            Word* row = plane.row(y);
+            if (source < 0 || source >= plane.height) {
+                for (int w = 0; w < plane.words; ++w) {
+                    row[w] = Op::apply(row[w], pad);
+                }
+            } else {
+                const Word* other = plane.row(source);
+                for (int w = 0; w < plane.words; ++w) {
+                    row[w] = Op::apply(row[w], other[w]);
+                }
+            }
+        }
+    };
+
+    int covered = 1;
+    while (covered * 2 <= length) {
+        step(covered);
+        covered *= 2;
+    }
+    if (covered < length) {
+        step(length - covered);
+    }
+}
+
+// result(x) = op of source(x + k) for k in [first, first + length)
+//
+// Offsets on each side of zero are handled separately: doubling towards the
+// run keeps every value read from outside the image equal to pad.
+template <typename Op>
+BitPlane horizontalRun(const BitPlane& source, int first, int length, Word pad) {
+    BitPlane result(source.width, source.height);
+    bool hasResult = false;
+
+    auto part = [&](int start, int count, int direction) {
+        BitPlane line = source;
+        horizontalDoubling<Op>(line, count, direction, pad);
+        TemporaryBuffer<Word> shifted(static_cast<std::size_t>(source.words));
+        for (int y = 0; y < source.height; ++y) {
+            shiftRow(line.row(y), line, start, pad, shifted.data());
+            Word* out = result.row(y);
+            for (int w = 0; w < source.words; ++w) {
+                out[w] = hasResult ? Op::apply(out[w], shifted[static_cast<std::size_t>(w)])
+                                   : shifted[static_cast<std::size_t>(w)];
+            }
+        }
+        hasResult = true;
+    };
+
+    const int last = first + length - 1;
+    if (last >= 0) {
+        const int start = std::max(first, 0);
+        part(start, last - start + 1, 1);
+    }
+    if (first < 0) {
+        const int end = std::min(last, -1);
+        part(end, end - first + 1, -1);
+    }
+    return result;
+}
+
+// result(y) = op of source(y + k) for k in [first, first + length)
+template <typename Op>
+BitPlane verticalRun(const BitPlane& source, int first, int length, Word pad) {
+    BitPlane result(source.width, source.height);
+    bool hasResult = false;
+
+    auto part = [&](int start, int count, int direction) {
+        BitPlane line = source;
+        verticalDoubling<Op>(line, count, direction, pad);
+        for (int y = 0; y < source.height; ++y) {
+            const int from = y + start;
+            Word* out = result.row(y);
+            for (int w = 0; w < source.words; ++w) {
+                const Word value = (from < 0 || from >= source.height) ? pad : line.row(from)[w];
+                out[w] = hasResult ? Op::apply(out[w], value) : value;
+            }
+        }
+        hasResult = true;
+    };
+
+    const int last = first + length - 1;
+    if (last >= 0) {
+        const int start = std::max(first, 0);
+        part(start, last - start + 1, 1);
+    }
+    if (first < 0) {
+        const int end = std::min(last, -1);
+        part(end, end - first + 1, -1);
+    }
+    return result;
+}
+
+// result(p) = op of source(p + offset) over every member offset of the element
+template <typename Op>
+BitPlane combine(const BitPlane& source, const StructuringElement& element, Word pad) {
+    if (element.isRectangle()) {
+        const Point anchor = element.getAnchor();
+        BitPlane rows = horizontalRun<Op>(source, -anchor.x, element.getWidth(), pad);
+        return verticalRun<Op>(rows, -anchor.y, element.getHeight(), pad);
+    }
+
+    BitPlane result(source.width, source.height);
+    bool hasResult = false;
+    const auto runs = element.getRuns();
+
+    for (std::size_t i = 0; i < runs.size();) {
+        // Runs of one element row are combined before the single vertical shift
+        const int dy = runs[i].dy;
+        BitPlane rowResult = horizontalRun<Op>(source, runs[i].dx, runs[i].length, pad);
+        for (++i; i < runs.size() && runs[i].dy == dy; ++i) {
+            BitPlane more = horizontalRun<Op>(source, runs[i].dx, runs[i].length, pad);
+            for (std::size_t k = 0; k < rowResult.bits.size(); ++k) {
+                rowResult.bits[k] = Op::apply(rowResult.bits[k], more.bits[k]);
+            }
+        }
+
+        for (int y = 0; y < source.height; ++y) {
+            const int from = y + dy;
+            Word* out = result.row(y);
+            for (int w = 0; w < source.words; ++w) {
+                const Word value =
+                    (from < 0 || from >= source.height) ? pad : rowResult.row(from)[w];
+                out[w] = hasResult ? Op::apply(out[w], value) : value;
+            }
+        }
+        hasResult = true;
+    }
+    return result;
+}
+
+BitPlane erodePlane(const BitPlane& source, const StructuringElement& element, Word pad) {
+    return combine<AndOp>(source, element, pad);
+}
+
+// Dilation by B is the union of the source shifted by the members of B, i.e.
+// an OR over the offsets of the reflected element
+BitPlane dilatePlane(const BitPlane& source, const StructuringElement& element) {
+    return combine<OrOp>(source, element.reflected(), 0);
+}
+
+void invertPlane(BitPlane& plane) {
+    for (auto& word : plane.bits) {
+        word = ~word;
+    }
+}
+
+// a = a AND NOT b
+void subtractPlane(BitPlane& a, const BitPlane& b) {
+    for (std::size_t i = 0; i < a.bits.size(); ++i) {
+        a.bits[i] &= ~b.bits[i];
+    }
+}
+
+template <typename Operation>
+Result<std::unique_ptr<BinaryImage>> run(const BinaryImage& image,
+                                         std::string_view name,
+                                         Operation operation) {
+    try {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        BitPlane result = operation(load(image));
+        MemoryTracker::Scope output(MemoryCategory::Images);
+        return makeSuccessResult(store(result, image.getRowLayout()));
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<BinaryImage>>(
+            ErrorCode::ProcessingFailed, std::format("Morphological {} failed: {}", name, e.what()));
+    }
+}
+
+}  // namespace
+
+Result<std::unique_ptr<BinaryImage>> Morphology::erode(const BinaryImage& image,
+                                                       const StructuringElement& element) {
+    return run(image, "erosion",
+               [&](const BitPlane& source) { return erodePlane(source, element, kAllSet); });
+}
+
+Result<std::unique_ptr<BinaryImage>> Morphology::dilate(const BinaryImage& image,
+                                                        const StructuringElement& element) {
+    return run(image, "dilation",
+               [&](const BitPlane& source) { return dilatePlane(source, element); });
+}
+
+Result<std::unique_ptr<BinaryImage>> Morphology::open(const BinaryImage& image,
+                                                      const StructuringElement& element) {
+    return run(image, "opening", [&](const BitPlane& source) {
+        return dilatePlane(erodePlane(source, element, kAllSet), element);
+    });
+}
+
+Result<std::unique_ptr<BinaryImage>> Morphology::close(const BinaryImage& image,
+                                                       const StructuringElement& element) {
+    return run(image, "closing", [&](const BitPlane& source) {
+        return erodePlane(dilatePlane(source, element), element, kAllSet);
+    });
+}
+
+Result<std::unique_ptr<BinaryImage>> Morphology::hitOrMiss(const BinaryImage& image,
+                                                           const StructuringElement& foreground,
+                                                           const StructuringElement& background) {
+    return run(image, "hit-or-miss", [&](const BitPlane& source) {
+        // Outside the image is background: 0 in the source, 1 in its complement
+        BitPlane hits = erodePlane(source, foreground, 0);
+        BitPlane complement = source;
+        invertPlane(complement);
+        BitPlane misses = erodePlane(complement, background, kAllSet);
+        for (std::size_t i = 0; i < hits.bits.size(); ++i) {
+            hits.bits[i] &= misses.bits[i];
+        }
+        return hits;
+    });
+}
+
+Result<std::unique_ptr<BinaryImage>> Morphology::topHat(const BinaryImage& image,
+                                                        const StructuringElement& element) {
+    return run(image, "top-hat", [&](const BitPlane& source) {
+        BitPlane result = source;
+        subtractPlane(result, dilatePlane(erodePlane(source, element, kAllSet), element));
+        return result;
+    });
+}
+
+Result<std::unique_ptr<BinaryImage>> Morphology::blackTopHat(const BinaryImage& image,
+                                                             const StructuringElement& element) {
+    return run(image, "black top-hat", [&](const BitPlane& source) {
+        BitPlane result = erodePlane(dilatePlane(source, element), element, kAllSet);
+        subtractPlane(result, source);
+        return result;
+    });
+}
+
+}  // namespace DIPAL
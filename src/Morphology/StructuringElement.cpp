@@ -0,0 +1,146 @@
+// src/Morphology/StructuringElement.cpp
+#include "../../include/DIPAL/Morphology/StructuringElement.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace DIPAL {
+
+StructuringElement::StructuringElement(int width, int height, const std::vector<uint8_t>& mask)
+    : StructuringElement(width, height, mask, Point(width / 2, height / 2)) {}
+
+StructuringElement::StructuringElement(int width,
+                                       int height,
+                                       const std::vector<uint8_t>& mask,
+                                       Point anchor)
+    : m_width(width), m_height(height), m_anchor(anchor) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Structuring element dimensions must be positive");
+    }
+    if (mask.size() != static_cast<std::size_t>(width) * static_cast<std::size_t>(height)) {
+        throw std::invalid_argument("Structuring element mask must have width * height entries");
+    }
+    if (anchor.x < 0 || anchor.x >= width || anchor.y < 0 || anchor.y >= height) {
+        throw std::invalid_argument("Structuring element anchor must lie inside the grid");
+    }
+
+    m_mask.reserve(mask.size());
+    for (uint8_t cell : mask) {
+        m_mask.push_back(cell != 0 ? 1 : 0);
+    }
+    if (getMemberCount() == 0) {
+        throw std::invalid_argument("Structuring element must have at least one member");
+    }
+}
+
+StructuringElement StructuringElement::rectangle(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Structuring element dimensions must be positive");
+    }
+    return StructuringElement(
+        width, height,
+        std::vector<uint8_t>(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), 1));
+}
+
+StructuringElement StructuringElement::cross(int size) {
+    if (size <= 0) {
+        throw std::invalid_argument("Structuring element size must be positive");
+    }
+    std::vector<uint8_t> mask(static_cast<std::size_t>(size) * static_cast<std::size_t>(size), 0);
+    const int centre = size / 2;
+    for (int i = 0; i < size; ++i) {
+        mask[static_cast<std::size_t>(centre * size + i)] = 1;
+        mask[static_cast<std::size_t>(i * size + centre)] = 1;
+    }
+    return StructuringElement(size, size, mask);
+}
+
+StructuringElement StructuringElement::ellipse(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Structuring element dimensions must be positive");
+    }
+    std::vector<uint8_t> mask(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), 0);
+
+    // Cell centres inside the ellipse inscribed in the box
+    const double rx = width / 2.0;
+    const double ry = height / 2.0;
+    for (int y = 0; y < height; ++y) {
+        const double dy = (y + 0.5 - ry) / ry;
+        for (int x = 0; x < width; ++x) {
+            const double dx = (x + 0.5 - rx) / rx;
+            if (dx * dx + dy * dy <= 1.0) {
+                mask[static_cast<std::size_t>(y * width + x)] = 1;
+            }
+        }
+    }
+    // Very thin boxes can miss every cell centre; keep the middle row
+    if (std::none_of(mask.begin(), mask.end(), [](uint8_t cell) { return cell != 0; })) {
+        std::fill_n(mask.begin() + static_cast<std::ptrdiff_t>((height / 2) * width), width, 1);
+    }
+    return StructuringElement(width, height, mask);
+}
+
+StructuringElement StructuringElement::diamond(int radius) {
+    if (radius < 0) {
+        throw std::invalid_argument("Structuring element radius must not be negative");
+    }
+    const int size = 2 * radius + 1;
+    std::vector<uint8_t> mask(static_cast<std::size_t>(size) * static_cast<std::size_t>(size), 0);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            if (std::abs(x - radius) + std::abs(y - radius) <= radius) {
+                mask[static_cast<std::size_t>(y * size + x)] = 1;
+            }
+        }
+    }
+    return StructuringElement(size, size, mask);
+}
+
+bool StructuringElement::contains(int x, int y) const noexcept {
+    if (x < 0 || x >= m_width || y < 0 || y >= m_height) {
+        return false;
+    }
+    return m_mask[static_cast<std::size_t>(y * m_width + x)] != 0;
+}
+
+int StructuringElement::getMemberCount() const noexcept {
+    return static_cast<int>(std::count(m_mask.begin(), m_mask.end(), uint8_t{1}));
+}
+
+bool StructuringElement::isRectangle() const noexcept {
+    return std::all_of(m_mask.begin(), m_mask.end(), [](uint8_t cell) { return cell != 0; });
+}
+
+StructuringElement StructuringElement::reflected() const {
+    std::vector<uint8_t> mask(m_mask.size());
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            mask[static_cast<std::size_t>((m_height - 1 - y) * m_width + (m_width - 1 - x))] =
+                m_mask[static_cast<std::size_t>(y * m_width + x)];
+        }
+    }
+    return StructuringElement(m_width, m_height, mask,
+                              Point(m_width - 1 - m_anchor.x, m_height - 1 - m_anchor.y));
+}
+
+std::vector<StructuringElement::Run> StructuringElement::getRuns() const {
+    std::vector<Run> runs;
+    for (int y = 0; y < m_height; ++y) {
+        int x = 0;
+        while (x < m_width) {
+            if (!contains(x, y)) {
+                ++x;
+                continue;
+            }
+            const int start = x;
+            while (x < m_width && contains(x, y)) {
+                ++x;
+            }
+            runs.push_back({y - m_anchor.y, start - m_anchor.x, x - start});
+        }
+    }
+    return runs;
+}
+
+}  // namespace DIPAL
@@ -1,6 +1,9 @@
 // src/Transformation/Interpolation.cpp
 #include "../../include/DIPAL/Transformation/Interpolation.hpp"
 
+#include "../../include/DIPAL/Image/ImageFactory.hpp"
+#include "../../include/DIPAL/Image/PixelAccessor.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <format>
@@ -57,6 +60,108 @@ VoidResult Interpolation::interpolateColor(const ColorImage& image,
     }
 }
 
+Result<std::unique_ptr<Image>> Interpolation::resample(
+    const Image& image,
+    int dstWidth,
+    int dstHeight,
+    const std::function<std::pair<float, float>(int, int)>& mapping,
+    InterpolationMethod method) {
+    return resample(image.view(), dstWidth, dstHeight, mapping, method, image.getRowLayout());
+}
+
+Result<std::unique_ptr<Image>> Interpolation::resample(
+    const ImageView& view,
+    int dstWidth,
+    int dstHeight,
+    const std::function<std::pair<float, float>(int, int)>& mapping,
+    InterpolationMethod method,
+    Image::RowLayout layout) {
+    if (view.isEmpty()) {
+        return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
+                                                       "Cannot resample an empty image");
+    }
+    if (view.getType() == Image::Type::Binary) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::UnsupportedFormat, "Binary images cannot be resampled");
+    }
+
+    try {
+        auto result =
+            ImageFactory::create(dstWidth, dstHeight, view.getType(), view.getDepth(), layout);
+        if (!result) {
+            return result;
+        }
+
+        visitSampleType(view.getDepth(), [&]<typename T>(std::type_identity<T>) {
+            const PixelAccessor<T> src(view);
+            const MutablePixelAccessor<T> dst(*result.value());
+            const int srcWidth = src.width();
+            const int srcHeight = src.height();
+            const int channels = src.channels();
+
+            // Out-of-bounds neighbours are black, as in getPixelSafe()
+            auto sample = [&](int x, int y, int c) -> float {
+                if (x < 0 || x >= srcWidth || y < 0 || y >= srcHeight) {
+                    return 0.0f;
+                }
+                return static_cast<float>(src(x, y, c));
+            };
+
+            for (int y = 0; y < dstHeight; ++y) {
+                T* dstRow = dst.row(y);
+
+                for (int x = 0; x < dstWidth; ++x) {
+                    T* px = dstRow + static_cast<std::size_t>(x) * channels;
+                    auto [srcX, srcY] = mapping(x, y);
+
+                    // The result view is zero-filled, so skipped pixels stay black
+                    if (srcX < 0 || srcX >= srcWidth || srcY < 0 || srcY >= srcHeight) {
+                        continue;
+                    }
+
+                    if (method == InterpolationMethod::NearestNeighbor) {
+                        const int nx = static_cast<int>(std::round(srcX));
+                        const int ny = static_cast<int>(std::round(srcY));
+                        for (int c = 0; c < channels; ++c) {
+                            px[c] = saturateSample<T>(sample(nx, ny, c));
+                        }
+                        continue;
+                    }
+
+                    const int ix = static_cast<int>(std::floor(srcX));
+                    const int iy = static_cast<int>(std::floor(srcY));
+                    const float fracX = srcX - ix;
+                    const float fracY = srcY - iy;
+
+                    for (int c = 0; c < channels; ++c) {
+                        float value;
+                        if (method == InterpolationMethod::Bicubic) {
+                            std::array<std::array<float, 4>, 4> grid;
+                            for (int j = 0; j < 4; ++j) {
+                                for (int i = 0; i < 4; ++i) {
+                                    grid[j][i] = sample(ix - 1 + i, iy - 1 + j, c);
+                                }
+                            }
+                            value = bicubicInterpolate(grid, fracX, fracY);
+                        } else {
+                            value = sample(ix, iy, c) * (1 - fracX) * (1 - fracY) +
+                                    sample(ix + 1, iy, c) * fracX * (1 - fracY) +
+                                    sample(ix, iy + 1, c) * (1 - fracX) * fracY +
+                                    sample(ix + 1, iy + 1, c) * fracX * fracY;
+                        }
+                        px[c] = saturateSample<T>(value);
+                    }
+                }
+            }
+        });
+
+        return result;
+    } catch (const std::exception& e) {
+        return makeErrorResult<std::unique_ptr<Image>>(
+            ErrorCode::ProcessingFailed, std::format("Resampling failed: {}", e.what()));
+    }
+}
+
 std::function<std::pair<float, float>(int, int)> Interpolation::createMapping(
     int srcWidth,
     int srcHeight,
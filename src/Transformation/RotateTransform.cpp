@@ -1,9 +1,6 @@
 // src/Transformation/RotateTransform.cpp
 #include "../../include/DIPAL/Transformation/RotateTransform.hpp"
 
-#include "../../include/DIPAL/Image/ColorImage.hpp"
-#include "../../include/DIPAL/Image/GrayscaleImage.hpp"
-#include "../../include/DIPAL/Image/ImageFactory.hpp"
 #include "../../include/DIPAL/Transformation/Interpolation.hpp"
 #include "DIPAL/Core/Error.hpp"
 
@@ -39,8 +36,17 @@ RotateTransform::RotateTransform(float angle,
       m_resizeOutput(resizeOutput) {}
 
 Result<std::unique_ptr<Image>> RotateTransform::apply(const Image& image) const {
+    return transform(image.view(), image.getRowLayout());
+}
+
+Result<std::unique_ptr<Image>> RotateTransform::apply(const ImageView& view) const {
+    return transform(view, Image::RowLayout::Packed);
+}
+
+Result<std::unique_ptr<Image>> RotateTransform::transform(const ImageView& view,
+                                                          Image::RowLayout layout) const {
     // Check for empty image
-    if (image.isEmpty()) {
+    if (view.isEmpty()) {
         return makeErrorResult<std::unique_ptr<Image>>(ErrorCode::InvalidParameter,
                                                        "Cannot rotate an empty image");
     }
@@ -50,8 +56,8 @@ Result<std::unique_ptr<Image>> RotateTransform::apply(const Image& image) const
         float angleRadians = m_angle * (M_PI / 180.0f);
 
         // Determine source image dimensions
-        int srcWidth = image.getWidth();
-        int srcHeight = image.getHeight();
+        int srcWidth = view.getWidth();
+        int srcHeight = view.getHeight();
 
         // Calculate rotation center in source image
         float centerX, centerY;
@@ -91,119 +97,8 @@ Result<std::unique_ptr<Image>> RotateTransform::apply(const Image& image) const
         auto mappingFunc =
             Interpolation::createMapping(srcWidth, srcHeight, dstWidth, dstHeight, rotationFunc);
 
-        // Create output image of the appropriate type
-        std::unique_ptr<Image> outputImage;
-
-        switch (image.getType()) {
-            case Image::Type::Grayscale: {
-                // Create grayscale output image
-                auto result = ImageFactory::createGrayscale(dstWidth, dstHeight);
-                if (!result) {
-                    return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
-                                                                   result.error().message());
-                }
-
-                auto& output = static_cast<GrayscaleImage&>(*result.value());
-                const auto& input = static_cast<const GrayscaleImage&>(image);
-
-                // Apply rotation with interpolation
-                for (int y = 0; y < dstHeight; ++y) {
-                    for (int x = 0; x < dstWidth; ++x) {
-                        // Get source coordinates
-                        auto [srcX, srcY] = mappingFunc(x, y);
-
-                        // Skip if source coordinates are outside image bounds
-                        if (srcX < 0 || srcX >= srcWidth || srcY < 0 || srcY >= srcHeight) {
-                            continue;
-                        }
-
-                        // Get interpolated value
-                        auto valueResult =
-                            Interpolation::interpolateGray(input, srcX, srcY, m_method);
-
-                        if (!valueResult) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                valueResult.error().code(), valueResult.error().message());
-                        }
-
-                        // Set output pixel
-                        auto setResult = output.setPixel(x, y, valueResult.value());
-                        if (!setResult) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                setResult.error().code(), setResult.error().message());
-                        }
-                    }
-                }
-
-                outputImage = std::move(result.value());
-                break;
-            }
-
-            case Image::Type::RGB:
-            case Image::Type::RGBA: {
-                // Create color output image
-                bool hasAlpha = (image.getType() == Image::Type::RGBA);
-                auto result = ImageFactory::createColor(dstWidth, dstHeight, hasAlpha);
-                if (!result) {
-                    return makeErrorResult<std::unique_ptr<Image>>(result.error().code(),
-                                                                   result.error().message());
-                }
-
-                auto& output = static_cast<ColorImage&>(*result.value());
-                const auto& input = static_cast<const ColorImage&>(image);
-
-                // Apply rotation with interpolation
-                for (int y = 0; y < dstHeight; ++y) {
-                    for (int x = 0; x < dstWidth; ++x) {
-                        // Get source coordinates
-                        auto [srcX, srcY] = mappingFunc(x, y);
-
-                        // Skip if source coordinates are outside image bounds
-                        if (srcX < 0 || srcX >= srcWidth || srcY < 0 || srcY >= srcHeight) {
-                            // For transparent images, set fully transparent
-                            if (hasAlpha) {
-                                auto setResult = output.setPixel(x, y, 0, 0, 0, 0);
-                                if (!setResult) {
-                                    return makeErrorResult<std::unique_ptr<Image>>(
-                                        setResult.error().code(), setResult.error().message());
-                                }
-                            }
-                            continue;
-                        }
-
-                        // Get interpolated value
-                        uint8_t r, g, b, a;
-                        auto interpolateResult = Interpolation::interpolateColor(
-                            input, srcX, srcY, r, g, b, a, m_method);
-
-                        if (!interpolateResult) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                interpolateResult.error().code(),
-                                interpolateResult.error().message());
-                        }
-
-                        // Set output pixel
-                        auto setResult = output.setPixel(x, y, r, g, b, a);
-                        if (!setResult) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                setResult.error().code(), setResult.error().message());
-                        }
-                    }
-                }
-
-                outputImage = std::move(result.value());
-                break;
-            }
-
-            case Image::Type::Binary:
-            default:
-                return makeErrorResult<std::unique_ptr<Image>>(
-                    ErrorCode::UnsupportedFormat,
-                    std::format("Unsupported image type for rotation: {}",
-                                static_cast<int>(image.getType())));
-        }
-
-        return makeSuccessResult(std::move(outputImage));
+        // Resampled straight from the view's rows, at every sample depth
+        return Interpolation::resample(view, dstWidth, dstHeight, mappingFunc, m_method, layout);
     } catch (const std::exception& e) {
         return makeErrorResult<std::unique_ptr<Image>>(
             ErrorCode::ProcessingFailed, std::format("Rotation failed: {}", e.what()));
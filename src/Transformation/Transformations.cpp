@@ -0,0 +1,14 @@
+// src/Transformation/Transformations.cpp
+#include "../../include/DIPAL/Transformation/Transformations.hpp"
+
+namespace DIPAL {
+
+Result<std::unique_ptr<Image>> ImageTransform::apply(const ImageView& view) const {
+    auto imageResult = view.toImage();
+    if (!imageResult) {
+        return imageResult;
+    }
+    return apply(*imageResult.value());
+}
+
+}  // namespace DIPAL
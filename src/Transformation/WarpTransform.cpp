@@ -1,9 +1,6 @@
 // src/Transformation/WarpTransform.cpp
 #include "../../include/DIPAL/Transformation/WarpTransform.hpp"
 
-#include "../../include/DIPAL/Image/ColorImage.hpp"
-#include "../../include/DIPAL/Image/GrayscaleImage.hpp"
-#include "../../include/DIPAL/Image/ImageFactory.hpp"
 #include "../../include/DIPAL/Transformation/Interpolation.hpp"
 
 #include <algorithm>
@@ -86,8 +83,17 @@ WarpTransform WarpTransform::createThinPlateSpline(const std::vector<Point>& sou
 }
 
 Result<std::unique_ptr<Image>> WarpTransform::apply(const Image& image) const {
+    return transform(image.view(), image.getRowLayout());
+}
+
+Result<std::unique_ptr<Image>> WarpTransform::apply(const ImageView& view) const {
+    return transform(view, Image::RowLayout::Packed);
+}
+
+Result<std::unique_ptr<Image>> WarpTransform::transform(const ImageView& view,
+                                                        Image::RowLayout layout) const {
     // Check for empty image
-    if (image.isEmpty()) {
+    if (view.isEmpty()) {
         return makeErrorResult<std::unique_ptr<Image>>(
             ErrorCode::InvalidParameter, "Cannot apply warp transform to an empty image");
     }
@@ -96,11 +102,11 @@ Result<std::unique_ptr<Image>> WarpTransform::apply(const Image& image) const {
         // Apply the appropriate warping algorithm
         switch (m_warpMethod) {
             case WarpMethod::ThinPlateSpline:
-                return applyThinPlateSpline(image);
+                return applyThinPlateSpline(view, layout);
             case WarpMethod::MeshWarp:
-                return applyMeshWarp(image);
+                return applyMeshWarp(view, layout);
             case WarpMethod::Triangulation:
-                return applyTriangulation(image);
+                return applyTriangulation(view, layout);
             default:
                 return makeErrorResult<std::unique_ptr<Image>>(
                     ErrorCode::InvalidParameter,
@@ -132,7 +138,8 @@ InterpolationMethod WarpTransform::getInterpolationMethod() const noexcept {
     return m_interpolationMethod;
 }
 
-Result<std::unique_ptr<Image>> WarpTransform::applyThinPlateSpline(const Image& image) const {
+Result<std::unique_ptr<Image>> WarpTransform::applyThinPlateSpline(const ImageView& view,
+                                                                   Image::RowLayout layout) const {
     // Thin-plate spline implementation
 
     // Check if we have the special marker for stiffness
@@ -149,11 +156,8 @@ Result<std::unique_ptr<Image>> WarpTransform::applyThinPlateSpline(const Image&
         dstPoints.pop_back();
     }
 
-    int srcWidth = image.getWidth();
-    int srcHeight = image.getHeight();
-
-    // Create output image with same dimensions
-    std::unique_ptr<Image> outputImage;
+    int srcWidth = view.getWidth();
+    int srcHeight = view.getHeight();
 
     // In a real implementation, we would compute the TPS coefficients here
     // For this simplified version, we'll implement a basic approximation
@@ -182,32 +186,6 @@ Result<std::unique_ptr<Image>> WarpTransform::applyThinPlateSpline(const Image&
         dstHeight = srcHeight;
     }
 
-    // Create the output image based on type
-    Result<std::unique_ptr<Image>> result;
-
-    switch (image.getType()) {
-        case Image::Type::Grayscale:
-            result = ImageFactory::createGrayscale(dstWidth, dstHeight);
-            break;
-        case Image::Type::RGB:
-            result = ImageFactory::createColor(dstWidth, dstHeight, false);
-            break;
-        case Image::Type::RGBA:
-            result = ImageFactory::createColor(dstWidth, dstHeight, true);
-            break;
-        default:
-            return makeErrorResult<std::unique_ptr<Image>>(
-                ErrorCode::UnsupportedFormat,
-                std::format("Unsupported image type for warping: {}",
-                            static_cast<int>(image.getType())));
-    }
-
-    if (!result) {
-        return result;
-    }
-
-    outputImage = std::move(result.value());
-
     // Implement a simplified inverse warping (backward mapping)
     // For each pixel in the destination, find its position in the source
 
@@ -227,131 +205,48 @@ Result<std::unique_ptr<Image>> WarpTransform::applyThinPlateSpline(const Image&
         dstPts.emplace_back(static_cast<float>(dstPoints[i].x), static_cast<float>(dstPoints[i].y));
     }
 
-    // Apply the warping based on image type
-    if (image.getType() == Image::Type::Grayscale) {
-        auto& output = static_cast<GrayscaleImage&>(*outputImage);
-        const auto& input = static_cast<const GrayscaleImage&>(image);
-
-        // Process each pixel in the output image
-        for (int y = 0; y < dstHeight; y++) {
-            for (int x = 0; x < dstWidth; x++) {
-                // For each output pixel, calculate the corresponding input pixel
-                float totalWeight = 0.0f;
-                float srcXWeighted = 0.0f;
-                float srcYWeighted = 0.0f;
-
-                // Simple inverse distance weighting for demonstration
-                for (size_t i = 0; i < dstPts.size(); i++) {
-                    float dx = static_cast<float>(x) - dstPts[i].first;
-                    float dy = static_cast<float>(y) - dstPts[i].second;
-                    float distance = std::sqrt(dx * dx + dy * dy);
-
-                    // Apply radial basis function
-                    float weight = rbf(distance);
-
-                    // Add weighted contribution
-                    srcXWeighted += srcPts[i].first * weight;
-                    srcYWeighted += srcPts[i].second * weight;
-                    totalWeight += weight;
-                }
-
-                // Normalize by total weight
-                float srcX, srcY;
-                if (totalWeight > 1e-10f) {
-                    srcX = srcXWeighted / totalWeight;
-                    srcY = srcYWeighted / totalWeight;
-                } else {
-                    // If all control points are too far, use direct mapping
-                    srcX = static_cast<float>(x) * srcWidth / dstWidth;
-                    srcY = static_cast<float>(y) * srcHeight / dstHeight;
-                }
-
-                // Check if source coordinates are valid
-                if (srcX >= 0 && srcX < srcWidth && srcY >= 0 && srcY < srcHeight) {
-                    // Use interpolation to get the pixel value
-                    auto valueResult =
-                        Interpolation::interpolateGray(input, srcX, srcY, m_interpolationMethod);
-
-                    if (valueResult) {
-                        output.setPixel(x, y, valueResult.value());
-                    }
-                }
-            }
+    // For each output pixel, calculate the corresponding input pixel
+    auto mapping = [&](int x, int y) -> std::pair<float, float> {
+        float totalWeight = 0.0f;
+        float srcXWeighted = 0.0f;
+        float srcYWeighted = 0.0f;
+
+        // Simple inverse distance weighting for demonstration
+        for (size_t i = 0; i < dstPts.size(); i++) {
+            float dx = static_cast<float>(x) - dstPts[i].first;
+            float dy = static_cast<float>(y) - dstPts[i].second;
+            float distance = std::sqrt(dx * dx + dy * dy);
+
+            // Apply radial basis function
+            float weight = rbf(distance);
+
+            // Add weighted contribution
+            srcXWeighted += srcPts[i].first * weight;
+            srcYWeighted += srcPts[i].second * weight;
+            totalWeight += weight;
         }
-    } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
-        auto& output = static_cast<ColorImage&>(*outputImage);
-        const auto& input = static_cast<const ColorImage&>(image);
-        bool hasAlpha = (image.getType() == Image::Type::RGBA);
-
-        // Process each pixel in the output image
-        for (int y = 0; y < dstHeight; y++) {
-            for (int x = 0; x < dstWidth; x++) {
-                // For each output pixel, calculate the corresponding input pixel
-                float totalWeight = 0.0f;
-                float srcXWeighted = 0.0f;
-                float srcYWeighted = 0.0f;
-
-                // Simple inverse distance weighting for demonstration
-                for (size_t i = 0; i < dstPts.size(); i++) {
-                    float dx = static_cast<float>(x) - dstPts[i].first;
-                    float dy = static_cast<float>(y) - dstPts[i].second;
-                    float distance = std::sqrt(dx * dx + dy * dy);
-
-                    // Apply radial basis function
-                    float weight = rbf(distance);
-
-                    // Add weighted contribution
-                    srcXWeighted += srcPts[i].first * weight;
-                    srcYWeighted += srcPts[i].second * weight;
-                    totalWeight += weight;
-                }
-
-                // Normalize by total weight
-                float srcX, srcY;
-                if (totalWeight > 1e-10f) {
-                    srcX = srcXWeighted / totalWeight;
-                    srcY = srcYWeighted / totalWeight;
-                } else {
-                    // If all control points are too far, use direct mapping
-                    srcX = static_cast<float>(x) * srcWidth / dstWidth;
-                    srcY = static_cast<float>(y) * srcHeight / dstHeight;
-                }
-
-                // Check if source coordinates are valid
-                if (srcX >= 0 && srcX < srcWidth && srcY >= 0 && srcY < srcHeight) {
-                    // Use interpolation to get the pixel value
-                    uint8_t r, g, b, a;
-                    auto colorResult = Interpolation::interpolateColor(
-                        input, srcX, srcY, r, g, b, a, m_interpolationMethod);
-
-                    if (colorResult) {
-                        auto setResult1 = output.setPixel(x, y, r, g, b, hasAlpha ? a : 255);
-                        if (!setResult1) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                setResult1.error().code(), setResult1.error().message());
-                        }
-                    }
-                } else if (hasAlpha) {
-                    // Set transparent pixel for out-of-bounds coordinates
-                    auto setResult = output.setPixel(x, y, 0, 0, 0, 0);
-                    if (!setResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(setResult.error().code(),
-                                                                       setResult.error().message());
-                    }
-                }
-            }
+
+        // Normalize by total weight
+        if (totalWeight > 1e-10f) {
+            return {srcXWeighted / totalWeight, srcYWeighted / totalWeight};
         }
-    }
 
-    return makeSuccessResult(std::move(outputImage));
+        // If all control points are too far, use direct mapping
+        return {static_cast<float>(x) * srcWidth / dstWidth,
+                static_cast<float>(y) * srcHeight / dstHeight};
+    };
+
+    return Interpolation::resample(
+        view, dstWidth, dstHeight, mapping, m_interpolationMethod, layout);
 }
 
-Result<std::unique_ptr<Image>> WarpTransform::applyMeshWarp(const Image& image) const {
+Result<std::unique_ptr<Image>> WarpTransform::applyMeshWarp(const ImageView& view,
+                                                            Image::RowLayout layout) const {
     // For this simplified implementation, we'll just create a grid-based warping
     // where each grid cell is defined by four control points
 
-    int srcWidth = image.getWidth();
-    int srcHeight = image.getHeight();
+    int srcWidth = view.getWidth();
+    int srcHeight = view.getHeight();
 
     // Determine grid dimensions from control points
     // This should be passed in from the createMeshWarp method
@@ -360,163 +255,57 @@ Result<std::unique_ptr<Image>> WarpTransform::applyMeshWarp(const Image& image)
 
     // If we can't determine a proper grid, fall back to TPS
     if (meshWidth * meshHeight != static_cast<int>(m_sourcePoints.size())) {
-        return applyThinPlateSpline(image);
+        return applyThinPlateSpline(view, layout);
     }
 
     // Create output image with same dimensions as input
     int dstWidth = srcWidth;
     int dstHeight = srcHeight;
 
-    // Create the output image based on type
-    Result<std::unique_ptr<Image>> result;
-
-    switch (image.getType()) {
-        case Image::Type::Grayscale:
-            result = ImageFactory::createGrayscale(dstWidth, dstHeight);
-            break;
-        case Image::Type::RGB:
-            result = ImageFactory::createColor(dstWidth, dstHeight, false);
-            break;
-        case Image::Type::RGBA:
-            result = ImageFactory::createColor(dstWidth, dstHeight, true);
-            break;
-        default:
-            return makeErrorResult<std::unique_ptr<Image>>(
-                ErrorCode::UnsupportedFormat,
-                std::format("Unsupported image type for warping: {}",
-                            static_cast<int>(image.getType())));
-    }
-
-    if (!result) {
-        return result;
-    }
-
-    auto outputImage = std::move(result.value());
-
     // For each pixel in the destination image, find its position in the source image
-    if (image.getType() == Image::Type::Grayscale) {
-        auto& output = static_cast<GrayscaleImage&>(*outputImage);
-        const auto& input = static_cast<const GrayscaleImage&>(image);
-
-        // Process each pixel in the output image
-        for (int y = 0; y < dstHeight; y++) {
-            for (int x = 0; x < dstWidth; x++) {
-                // Find which mesh cell this destination point is in
-                int cellX = x * (meshWidth - 1) / dstWidth;
-                int cellY = y * (meshHeight - 1) / dstHeight;
-
-                // Get normalized position within this cell
-                float u = static_cast<float>(x * (meshWidth - 1) % dstWidth) / dstWidth;
-                float v = static_cast<float>(y * (meshHeight - 1) % dstHeight) / dstHeight;
-
-                // Get the four corners of this cell in the destination mesh
-                int idx00 = cellY * meshWidth + cellX;
-                int idx10 = cellY * meshWidth + cellX + 1;
-                int idx01 = (cellY + 1) * meshWidth + cellX;
-                int idx11 = (cellY + 1) * meshWidth + cellX + 1;
-
-                // Make sure indices are valid
-                idx00 = std::min(idx00, static_cast<int>(m_destPoints.size() - 1));
-                idx10 = std::min(idx10, static_cast<int>(m_destPoints.size() - 1));
-                idx01 = std::min(idx01, static_cast<int>(m_destPoints.size() - 1));
-                idx11 = std::min(idx11, static_cast<int>(m_destPoints.size() - 1));
-
-                // Get the corresponding points in the source mesh
-                auto& src00 = m_sourcePoints[idx00];
-                auto& src10 = m_sourcePoints[idx10];
-                auto& src01 = m_sourcePoints[idx01];
-                auto& src11 = m_sourcePoints[idx11];
-
-                // Bilinear interpolation to find the source position
-                float srcX = (1 - u) * (1 - v) * src00.x + u * (1 - v) * src10.x +
-                             (1 - u) * v * src01.x + u * v * src11.x;
-
-                float srcY = (1 - u) * (1 - v) * src00.y + u * (1 - v) * src10.y +
-                             (1 - u) * v * src01.y + u * v * src11.y;
-
-                // Check if source coordinates are valid
-                if (srcX >= 0 && srcX < srcWidth && srcY >= 0 && srcY < srcHeight) {
-                    // Use interpolation to get the pixel value
-                    auto valueResult =
-                        Interpolation::interpolateGray(input, srcX, srcY, m_interpolationMethod);
-
-                    if (valueResult) {
-                        output.setPixel(x, y, valueResult.value());
-                    }
-                }
-            }
-        }
-    } else if (image.getType() == Image::Type::RGB || image.getType() == Image::Type::RGBA) {
-        auto& output = static_cast<ColorImage&>(*outputImage);
-        const auto& input = static_cast<const ColorImage&>(image);
-        bool hasAlpha = (image.getType() == Image::Type::RGBA);
-
-        // Process each pixel in the output image
-        for (int y = 0; y < dstHeight; y++) {
-            for (int x = 0; x < dstWidth; x++) {
-                // Find which mesh cell this destination point is in
-                int cellX = x * (meshWidth - 1) / dstWidth;
-                int cellY = y * (meshHeight - 1) / dstHeight;
-
-                // Get normalized position within this cell
-                float u = static_cast<float>(x * (meshWidth - 1) % dstWidth) / dstWidth;
-                float v = static_cast<float>(y * (meshHeight - 1) % dstHeight) / dstHeight;
-
-                // Get the four corners of this cell in the destination mesh
-                int idx00 = cellY * meshWidth + cellX;
-                int idx10 = cellY * meshWidth + cellX + 1;
-                int idx01 = (cellY + 1) * meshWidth + cellX;
-                int idx11 = (cellY + 1) * meshWidth + cellX + 1;
-
-                // Make sure indices are valid
-                idx00 = std::min(idx00, static_cast<int>(m_destPoints.size() - 1));
-                idx10 = std::min(idx10, static_cast<int>(m_destPoints.size() - 1));
-                idx01 = std::min(idx01, static_cast<int>(m_destPoints.size() - 1));
-                idx11 = std::min(idx11, static_cast<int>(m_destPoints.size() - 1));
-
-                // Get the corresponding points in the source mesh
-                auto& src00 = m_sourcePoints[idx00];
-                auto& src10 = m_sourcePoints[idx10];
-                auto& src01 = m_sourcePoints[idx01];
-                auto& src11 = m_sourcePoints[idx11];
-
-                // Bilinear interpolation to find the source position
-                float srcX = (1 - u) * (1 - v) * src00.x + u * (1 - v) * src10.x +
-                             (1 - u) * v * src01.x + u * v * src11.x;
-
-                float srcY = (1 - u) * (1 - v) * src00.y + u * (1 - v) * src10.y +
-                             (1 - u) * v * src01.y + u * v * src11.y;
-
-                // Check if source coordinates are valid
-                if (srcX >= 0 && srcX < srcWidth && srcY >= 0 && srcY < srcHeight) {
-                    // Use interpolation to get the pixel value
-                    uint8_t r, g, b, a;
-                    auto colorResult = Interpolation::interpolateColor(
-                        input, srcX, srcY, r, g, b, a, m_interpolationMethod);
-
-                    if (colorResult) {
-                        auto setResult = output.setPixel(x, y, r, g, b, hasAlpha ? a : 255);
-                        if (!setResult) {
-                            return makeErrorResult<std::unique_ptr<Image>>(
-                                setResult.error().code(), setResult.error().message());
-                        }
-                    }
-                } else if (hasAlpha) {
-                    // Set transparent pixel for out-of-bounds coordinates
-                    auto setResult = output.setPixel(x, y, 0, 0, 0, 0);
-                    if (!setResult) {
-                        return makeErrorResult<std::unique_ptr<Image>>(setResult.error().code(),
-                                                                       setResult.error().message());
-                    }
-                }
-            }
-        }
-    }
+    auto mapping = [&](int x, int y) -> std::pair<float, float> {
+        // Find which mesh cell this destination point is in
+        int cellX = x * (meshWidth - 1) / dstWidth;
+        int cellY = y * (meshHeight - 1) / dstHeight;
+
+        // Get normalized position within this cell
+        float u = static_cast<float>(x * (meshWidth - 1) % dstWidth) / dstWidth;
+        float v = static_cast<float>(y * (meshHeight - 1) % dstHeight) / dstHeight;
+
+        // Get the four corners of this cell in the destination mesh
+        int idx00 = cellY * meshWidth + cellX;
+        int idx10 = cellY * meshWidth + cellX + 1;
+        int idx01 = (cellY + 1) * meshWidth + cellX;
+        int idx11 = (cellY + 1) * meshWidth + cellX + 1;
+
+        // Make sure indices are valid
+        idx00 = std::min(idx00, static_cast<int>(m_destPoints.size() - 1));
+        idx10 = std::min(idx10, static_cast<int>(m_destPoints.size() - 1));
+        idx01 = std::min(idx01, static_cast<int>(m_destPoints.size() - 1));
+        idx11 = std::min(idx11, static_cast<int>(m_destPoints.size() - 1));
+
+        // Get the corresponding points in the source mesh
+        auto& src00 = m_sourcePoints[idx00];
+        auto& src10 = m_sourcePoints[idx10];
+        auto& src01 = m_sourcePoints[idx01];
+        auto& src11 = m_sourcePoints[idx11];
+
+        // Bilinear interpolation to find the source position
+        float srcX = (1 - u) * (1 - v) * src00.x + u * (1 - v) * src10.x +
+                     (1 - u) * v * src01.x + u * v * src11.x;
+
+        float srcY = (1 - u) * (1 - v) * src00.y + u * (1 - v) * src10.y +
+                     (1 - u) * v * src01.y + u * v * src11.y;
+
+        return {srcX, srcY};
+    };
 
-    return makeSuccessResult(std::move(outputImage));
+    return Interpolation::resample(
+        view, dstWidth, dstHeight, mapping, m_interpolationMethod, layout);
 }
 
-Result<std::unique_ptr<Image>> WarpTransform::applyTriangulation(const Image& image) const {
+Result<std::unique_ptr<Image>> WarpTransform::applyTriangulation(const ImageView& view,
+                                                                 Image::RowLayout layout) const {
     // This is a simplified placeholder for triangulation-based warping
     // A full implementation would involve:
     // 1. Creating a Delaunay triangulation of the control points
@@ -524,7 +313,7 @@ Result<std::unique_ptr<Image>> WarpTransform::applyTriangulation(const Image& im
     // 3. Using the appropriate transformation for each pixel based on which triangle it's in
 
     // For this implementation, we'll just fall back to thin-plate spline warping
-    return applyThinPlateSpline(image);
+    return applyThinPlateSpline(view, layout);
 }
 
 }  // namespace DIPAL
@@ -1,10 +1,109 @@
 // src/Utils/Concurrency.cpp
 #include "../../include/DIPAL/Utils/Concurrency.hpp"
 
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace DIPAL {
 
-ThreadPool::ThreadPool(size_t numThreads)
-    : m_stop(false), m_activeThreads(0) {
+namespace {
+
+// Parses a sysfs CPU list such as "0-3,8,10-11"
+std::vector<int> parseCpuList(const std::string& text) {
+    std::vector<int> cpus;
+    std::stringstream stream(text);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        try {
+            const auto dash = range.find('-');
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return cpus;
+}
+
+std::vector<std::vector<int>> detectNodes() {
+    std::vector<std::vector<int>> nodes;
+#ifdef __linux__
+    for (int node = 0;; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file) {
+            break;
+        }
+        std::string text;
+        std::getline(file, text);
+        nodes.push_back(parseCpuList(text));
+    }
+    // Memory-only nodes have no CPUs to run workers on
+    std::erase_if(nodes, [](const std::vector<int>& cpus) { return cpus.empty(); });
+#endif
+    if (nodes.empty()) {
+        std::vector<int> all(std::max(std::thread::hardware_concurrency(), 1u));
+        for (size_t i = 0; i < all.size(); ++i) {
+            all[i] = static_cast<int>(i);
+        }
+        nodes.push_back(std::move(all));
+    }
+    return nodes;
+}
+
+const std::vector<std::vector<int>>& nodes() {
+    static const std::vector<std::vector<int>> detected = detectNodes();
+    return detected;
+}
+
+// Pins the calling thread; failures (e.g. CPUs outside the process cpuset) are ignored
+void bindCurrentThread([[maybe_unused]] const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    if (CPU_COUNT(&set) > 0) {
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#endif
+}
+
+struct WorkerIdentity {
+    const ThreadPool* pool = nullptr;
+    size_t index = 0;
+};
+
+thread_local WorkerIdentity t_worker;
+
+}  // namespace
+
+size_t NumaTopology::getNodeCount() {
+    return nodes().size();
+}
+
+const std::vector<int>& NumaTopology::getNodeCpus(size_t node) {
+    static const std::vector<int> none;
+    return node < nodes().size() ? nodes()[node] : none;
+}
+
+ThreadPool::ThreadPool(size_t numThreads, ThreadBinding binding)
+    : m_binding(binding), m_stop(false), m_activeThreads(0) {
     // Use hardware concurrency if numThreads is 0
     if (numThreads == 0) {
         numThreads = std::thread::hardware_concurrency();
@@ -12,47 +111,21 @@ ThreadPool::ThreadPool(size_t numThreads)
     
     // At least one thread
     numThreads = std::max(numThreads, size_t(1));
+    m_workerTasks.resize(numThreads);
+
+    // Workers are spread over the nodes in contiguous groups, matching the
+    // strip partition: neighbouring strips share a node
+    if (m_binding != ThreadBinding::None) {
+        const size_t nodeCount = NumaTopology::getNodeCount();
+        m_workerNodes.resize(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            m_workerNodes[i] = static_cast<int>(i * nodeCount / numThreads);
+        }
+    }
     
     // Create worker threads
     for (size_t i = 0; i < numThreads; ++i) {
-        m_workers.emplace_back([this]() {
-            while (true) {
-                std::function<void()> task;
-                
-                {
-                    std::unique_lock<std::mutex> lock(m_queueMutex);
-                    
-                    // Wait for a task or stop signal
-                    m_condition.wait(lock, [this]() {
-                        return m_stop || !m_tasks.empty();
-                    });
-                    
-                    // Exit if stopped and no more tasks
-                    if (m_stop && m_tasks.empty()) {
-                        return;
-                    }
-                    
-                    // Get task from the queue
-                    task = std::move(m_tasks.front());
-                    m_tasks.pop();
-                }
-                
-                // Execute task
-                m_activeThreads++;
-                try {
-                    task();
-                } catch (...) {
-                    // Log error in a real implementation
-                }
-                m_activeThreads--;
-                
-                // Notify completion if queue is empty and no active threads
-                if (m_tasks.empty() && m_activeThreads == 0) {
-                    std::lock_guard<std::mutex> lock(m_completionMutex);
-                    m_completionCondition.notify_all();
-                }
-            }
-        });
+        m_workers.emplace_back([this, i]() { workerLoop(i); });
     }
 }
 
@@ -73,13 +146,83 @@ ThreadPool::~ThreadPool() {
     }
 }
 
+void ThreadPool::workerLoop(size_t index) {
+    t_worker = {this, index};
+
+    if (m_binding != ThreadBinding::None) {
+        const size_t node = static_cast<size_t>(m_workerNodes[index]);
+        const auto& cpus = NumaTopology::getNodeCpus(node);
+        if (m_binding == ThreadBinding::Core) {
+            // Position of this worker among the workers of its node
+            const size_t rank = index - static_cast<size_t>(
+                std::find(m_workerNodes.begin(), m_workerNodes.end(), m_workerNodes[index]) -
+                m_workerNodes.begin());
+            bindCurrentThread({cpus[rank % cpus.size()]});
+        } else {
+            bindCurrentThread(cpus);
+        }
+    }
+
+    auto& ownTasks = m_workerTasks[index];
+    while (true) {
+        std::function<void()> task;
+        
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            
+            // Wait for a task or stop signal
+            m_condition.wait(lock, [this, &ownTasks]() {
+                return m_stop || !m_tasks.empty() || !ownTasks.empty();
+            });
+            
+            // Exit if stopped and no more tasks
+            if (m_stop && m_tasks.empty() && ownTasks.empty()) {
+                return;
+            }
+            
+            // Get a task from the worker's own queue first, then the shared one.
+            // Counting it as active under the lock keeps waitForCompletion()
+            // from seeing an empty pool in between.
+            auto& queue = ownTasks.empty() ? m_tasks : ownTasks;
+            task = std::move(queue.front());
+            queue.pop();
+            m_activeThreads++;
+        }
+        
+        // Execute task
+        try {
+            task();
+        } catch (...) {
+            // Log error in a real implementation
+        }
+        m_activeThreads--;
+        
+        // Notify completion if queue is empty and no active threads
+        if (m_activeThreads == 0 && !hasPendingTasks()) {
+            std::lock_guard<std::mutex> lock(m_completionMutex);
+            m_completionCondition.notify_all();
+        }
+    }
+}
+
+bool ThreadPool::hasPendingTasks() const {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    return !m_tasks.empty() ||
+           std::any_of(m_workerTasks.begin(), m_workerTasks.end(),
+                       [](const auto& queue) { return !queue.empty(); });
+}
+
 size_t ThreadPool::getThreadCount() const {
     return m_workers.size();
 }
 
 size_t ThreadPool::getQueueSize() const {
     std::lock_guard<std::mutex> lock(m_queueMutex);
-    return m_tasks.size();
+    size_t size = m_tasks.size();
+    for (const auto& queue : m_workerTasks) {
+        size += queue.size();
+    }
+    return size;
 }
 
 void ThreadPool::waitForCompletion() {
@@ -87,9 +230,31 @@ void ThreadPool::waitForCompletion() {
     
     // Wait until there are no tasks in the queue and no active threads
     m_completionCondition.wait(lock, [this]() {
-        std::lock_guard<std::mutex> queueLock(m_queueMutex);
-        return m_tasks.empty() && m_activeThreads == 0;
+        return !hasPendingTasks() && m_activeThreads == 0;
     });
 }
 
+ThreadBinding ThreadPool::getBinding() const noexcept {
+    return m_binding;
+}
+
+int ThreadPool::getWorkerNode(size_t worker) const noexcept {
+    return worker < m_workerNodes.size() ? m_workerNodes[worker] : -1;
+}
+
+std::optional<size_t> ThreadPool::currentWorkerIndex() const noexcept {
+    if (t_worker.pool == this) {
+        return t_worker.index;
+    }
+    return std::nullopt;
+}
+
+ThreadPool* sharedPoolFor(size_t work, size_t minimumWork) {
+    if (work < minimumWork || std::thread::hardware_concurrency() < 2 || t_worker.pool) {
+        return nullptr;
+    }
+    static ThreadPool pool;
+    return &pool;
+}
+
 } // namespace DIPAL
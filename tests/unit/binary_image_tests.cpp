@@ -318,6 +318,93 @@ TEST_F(BinaryImageTest, NonByteAlignedWidth) {
     EXPECT_EQ(image.countWhitePixels(), 25);
 }
 
+// Test bit-packed rows on an aligned layout
+TEST_F(BinaryImageTest, AlignedLayoutTailHandling) {
+    auto result = DIPAL::ImageFactory::createBinary(13, 6, DIPAL::Image::RowLayout::Aligned);
+    ASSERT_TRUE(result) << "Failed to create aligned binary image: " << result.error().toString();
+
+    auto& image = *result.value();
+    EXPECT_EQ(image.getBytesPerRow(), 2);
+    EXPECT_EQ(image.getStride() % DIPAL::Image::kRowAlignment, 0u);
+
+    ASSERT_TRUE(image.fill(true));
+    EXPECT_EQ(image.countWhitePixels(), 13u * 6u);
+
+    for (int y = 0; y < 6; ++y) {
+        // Unused tail bits of the last byte must stay zero
+        EXPECT_EQ(image.getRow(y)[1], 0x1F);
+    }
+
+    ASSERT_TRUE(image.setPixel(12, 5, false));
+    ASSERT_TRUE(image.invert());
+    EXPECT_EQ(image.countWhitePixels(), 1u);
+    EXPECT_TRUE(image.getPixel(12, 5).value());
+
+    auto clone = image.clone();
+    auto& cloned = static_cast<DIPAL::BinaryImage&>(*clone);
+    EXPECT_EQ(cloned.getRowLayout(), DIPAL::Image::RowLayout::Aligned);
+    EXPECT_EQ(cloned.countWhitePixels(), 1u);
+}
+
+// Word kernels must match per-pixel semantics for every tail length
+TEST_F(BinaryImageTest, WordKernelsMatchPerPixelResults) {
+    for (int width : {1, 7, 8, 9, 60, 63, 64, 65, 127, 128, 130, 200}) {
+        for (auto layout : {DIPAL::Image::RowLayout::Packed, DIPAL::Image::RowLayout::Aligned}) {
+            DIPAL::GrayscaleImage gray(width, 3, layout);
+            for (int y = 0; y < 3; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    ASSERT_TRUE(gray.setPixel(x, y, static_cast<uint8_t>((x * 37 + y * 101) % 256)));
+                }
+            }
+
+            for (bool invert : {false, true}) {
+                auto binary = DIPAL::BinaryImage::fromGrayscale(gray, 100, invert);
+                ASSERT_TRUE(binary);
+                auto& image = *binary.value();
+
+                size_t expectedWhite = 0;
+                for (int y = 0; y < 3; ++y) {
+                    for (int x = 0; x < width; ++x) {
+                        const bool white = (gray.getPixel(x, y).value() >= 100) != invert;
+                        expectedWhite += white ? 1 : 0;
+                        ASSERT_EQ(image.getPixel(x, y).value(), white)
+                            << "width " << width << ", x " << x << ", y " << y;
+                    }
+                    if (width % 8 != 0) {
+                        const uint8_t unused = static_cast<uint8_t>(0xFF << (width % 8));
+                        EXPECT_EQ(image.getRow(y).back() & unused, 0) << "width " << width;
+                    }
+                }
+                EXPECT_EQ(image.countWhitePixels(), expectedWhite) << "width " << width;
+
+                ASSERT_TRUE(image.invert());
+                EXPECT_EQ(image.countWhitePixels(), static_cast<size_t>(width) * 3 - expectedWhite)
+                    << "width " << width;
+            }
+        }
+    }
+}
+
+// Packed rows start at arbitrary byte offsets; word operations must not spill into neighbours
+TEST_F(BinaryImageTest, WordOperationsStayInsideRows) {
+    DIPAL::BinaryImage image(70, 4);  // 9 bytes per packed row
+    ASSERT_TRUE(image.setPixel(0, 0, true));
+    ASSERT_TRUE(image.setPixel(69, 3, true));
+
+    ASSERT_TRUE(image.invert());
+    EXPECT_EQ(image.countWhitePixels(), 70u * 4u - 2u);
+    EXPECT_FALSE(image.getPixel(0, 0).value());
+    EXPECT_FALSE(image.getPixel(69, 3).value());
+
+    ASSERT_TRUE(image.fill(false));
+    EXPECT_EQ(image.countWhitePixels(), 0u);
+    EXPECT_EQ(DIPAL::BinaryImage::countRow(image.getRow(2).data(), 70), 0u);
+
+    const uint8_t bytes[9] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    EXPECT_EQ(DIPAL::BinaryImage::countRow(bytes, 70), 70u);
+    EXPECT_EQ(DIPAL::BinaryImage::countRow(bytes, 60), 60u);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -4,7 +4,11 @@
 
 #include <gtest/gtest.h>
 #include <DIPAL/DIPAL.hpp>
+#include <atomic>
+#include <future>
+#include <optional>
 #include <thread>
+#include <vector>
 
 using namespace DIPAL;
 
@@ -83,6 +87,83 @@ TEST_F(ConcurrencyTest, Integration) {
     EXPECT_TRUE(true) << "Integration test not implemented";
 }
 
+TEST_F(ConcurrencyTest, SubmitToRunsOnTheChosenWorker) {
+    ThreadPool pool(3);
+    EXPECT_FALSE(pool.currentWorkerIndex());
+
+    std::vector<std::future<std::optional<size_t>>> futures;
+    for (size_t i = 0; i < 9; ++i) {
+        futures.push_back(pool.submitTo(i, [&pool]() { return pool.currentWorkerIndex(); }));
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+        auto worker = futures[i].get();
+        ASSERT_TRUE(worker);
+        EXPECT_EQ(*worker, i % 3);
+    }
+
+    // Shared and targeted tasks are both waited for
+    std::atomic<int> done{0};
+    for (int i = 0; i < 6; ++i) {
+        pool.submit([&done]() { ++done; });
+        pool.submitTo(static_cast<size_t>(i), [&done]() { ++done; });
+    }
+    pool.waitForCompletion();
+    EXPECT_EQ(done.load(), 12);
+    EXPECT_EQ(pool.getQueueSize(), 0u);
+}
+
+TEST_F(ConcurrencyTest, BoundPoolsSpreadWorkersOverNodes) {
+    ASSERT_GE(NumaTopology::getNodeCount(), 1u);
+    EXPECT_FALSE(NumaTopology::getNodeCpus(0).empty());
+    EXPECT_TRUE(NumaTopology::getNodeCpus(NumaTopology::getNodeCount()).empty());
+
+    ThreadPool unbound(2);
+    EXPECT_EQ(unbound.getWorkerNode(0), -1);
+
+    for (auto binding : {ThreadBinding::NumaNode, ThreadBinding::Core}) {
+        ThreadPool pool(4, binding);
+        EXPECT_EQ(pool.getBinding(), binding);
+        int previous = 0;
+        for (size_t i = 0; i < pool.getThreadCount(); ++i) {
+            const int node = pool.getWorkerNode(i);
+            EXPECT_GE(node, previous);
+            EXPECT_LT(node, static_cast<int>(NumaTopology::getNodeCount()));
+            previous = node;
+        }
+        EXPECT_EQ(pool.submitTo(3, []() { return 7; }).get(), 7);
+    }
+}
+
+TEST_F(ConcurrencyTest, PartitionRangeCoversEveryElementOnce) {
+    size_t expectedStart = 0;
+    for (size_t i = 0; i < 7; ++i) {
+        const auto [first, last] = partitionRange(100, 7, i);
+        EXPECT_EQ(first, expectedStart);
+        EXPECT_GE(last, first);
+        expectedStart = last;
+    }
+    EXPECT_EQ(expectedStart, 100u);
+    EXPECT_EQ(partitionRange(2, 4, 0).first, partitionRange(2, 4, 0).second);
+}
+
+TEST_F(ConcurrencyTest, SharedPoolIsReusedAcrossOperations) {
+    EXPECT_EQ(sharedPoolFor(kParallelPixels - 1), nullptr);
+    EXPECT_EQ(sharedPoolFor(100, 101), nullptr);
+    if (std::thread::hardware_concurrency() < 2) {
+        GTEST_SKIP() << "No shared pool on a single-core machine";
+    }
+
+    ThreadPool* pool = sharedPoolFor(kParallelPixels);
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(sharedPoolFor(kParallelPixels * 4), pool);
+    EXPECT_EQ(pool->getThreadCount(), std::thread::hardware_concurrency());
+
+    // Workers of any pool run nested operations on their own thread
+    EXPECT_EQ(pool->submit([]() { return sharedPoolFor(kParallelPixels); }).get(), nullptr);
+    ThreadPool other(2);
+    EXPECT_EQ(other.submit([]() { return sharedPoolFor(kParallelPixels); }).get(), nullptr);
+}
+
 // Additional test cases should be added based on specific functionality
 // of the class under test
 
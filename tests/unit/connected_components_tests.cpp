@@ -0,0 +1,150 @@
+// tests/unit/connected_components_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+// Flood fill in raster order: labels numbered by each component's first pixel
+std::vector<uint32_t> referenceLabels(const BinaryImage& image, Connectivity connectivity) {
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+    std::vector<uint32_t> labels(static_cast<size_t>(width) * height, 0);
+    uint32_t next = 0;
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (!image.getPixel(x, y).value() || labels[y * width + x] != 0) {
+                continue;
+            }
+            ++next;
+            std::queue<std::pair<int, int>> pending;
+            pending.push({x, y});
+            labels[y * width + x] = next;
+            while (!pending.empty()) {
+                auto [px, py] = pending.front();
+                pending.pop();
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        if ((dx == 0 && dy == 0) ||
+                            (connectivity == Connectivity::Four && dx != 0 && dy != 0)) {
+                            continue;
+                        }
+                        const int nx = px + dx;
+                        const int ny = py + dy;
+                        if (nx < 0 || ny < 0 || nx >= width || ny >= height ||
+                            labels[ny * width + nx] != 0 || !image.getPixel(nx, ny).value()) {
+                            continue;
+                        }
+                        labels[ny * width + nx] = next;
+                        pending.push({nx, ny});
+                    }
+                }
+            }
+        }
+    }
+    return labels;
+}
+
+void expectLabelsMatch(const ComponentLabeling& result, const std::vector<uint32_t>& expected,
+                       int width, int height) {
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            ASSERT_EQ(result.labels.at(x, y), expected[y * width + x])
+                << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ConnectedComponentsTest, MatchesFloodFillForBothConnectivities) {
+    unsigned seed = 11;
+    for (int width : {1, 9, 64, 65, 150}) {
+        const BinaryImage image = makeRandomImage(width, 37, 0.45, seed++);
+        for (auto connectivity : {Connectivity::Four, Connectivity::Eight}) {
+            const auto expected = referenceLabels(image, connectivity);
+            auto result = ConnectedComponents::label(image, connectivity);
+            ASSERT_TRUE(result) << result.error().toString();
+            expectLabelsMatch(result.value(), expected, width, 37);
+
+            const uint32_t components =
+                expected.empty() ? 0 : *std::max_element(expected.begin(), expected.end());
+            EXPECT_EQ(result.value().components.size(), components);
+            auto counted = ConnectedComponents::count(image, connectivity);
+            ASSERT_TRUE(counted);
+            EXPECT_EQ(counted.value(), components);
+        }
+    }
+}
+
+TEST(ConnectedComponentsTest, StripCountDoesNotChangeLabels) {
+    const BinaryImage image = makeRandomImage(203, 61, 0.55, 5);
+    const auto expected = referenceLabels(image, Connectivity::Eight);
+
+    for (size_t threads : {1u, 2u, 3u, 8u, 100u}) {
+        ThreadPool pool(threads);
+        auto result = ConnectedComponents::label(image, Connectivity::Eight, &pool);
+        ASSERT_TRUE(result);
+        expectLabelsMatch(result.value(), expected, 203, 61);
+    }
+}
+
+TEST(ConnectedComponentsTest, ComputesComponentStatistics) {
+    BinaryImage image(130, 10);
+    // A 3x2 block and an L spanning the 64-pixel word boundary
+    for (int y = 1; y <= 2; ++y) {
+        for (int x = 2; x <= 4; ++x) {
+            ASSERT_TRUE(image.setPixel(x, y, true));
+        }
+    }
+    for (int x = 60; x <= 70; ++x) {
+        ASSERT_TRUE(image.setPixel(x, 5, true));
+    }
+    for (int y = 5; y <= 9; ++y) {
+        ASSERT_TRUE(image.setPixel(70, y, true));
+    }
+
+    auto result = ConnectedComponents::label(image, Connectivity::Four);
+    ASSERT_TRUE(result);
+    const auto& components = result.value().components;
+    ASSERT_EQ(components.size(), 2u);
+
+    EXPECT_EQ(components[0].label, 1u);
+    EXPECT_EQ(components[0].area, 6u);
+    EXPECT_EQ(components[0].boundingBox, Rect(2, 1, 3, 2));
+    EXPECT_DOUBLE_EQ(components[0].centroidX, 3.0);
+    EXPECT_DOUBLE_EQ(components[0].centroidY, 1.5);
+
+    EXPECT_EQ(components[1].area, 15u);
+    EXPECT_EQ(components[1].boundingBox, Rect(60, 5, 11, 5));
+    EXPECT_DOUBLE_EQ(components[1].centroidX, (65.0 * 11 + 70.0 * 4) / 15.0);
+    EXPECT_DOUBLE_EQ(components[1].centroidY, (5.0 * 11 + 6 + 7 + 8 + 9) / 15.0);
+    EXPECT_EQ(result.value().labels.at(70, 9), 2u);
+    EXPECT_EQ(result.value().labels.at(0, 0), 0u);
+}
+
+TEST(ConnectedComponentsTest, DiagonalsDependOnConnectivity) {
+    BinaryImage image(4, 4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(image.setPixel(i, i, true));
+    }
+    EXPECT_EQ(ConnectedComponents::count(image, Connectivity::Four).value(), 4u);
+    EXPECT_EQ(ConnectedComponents::count(image, Connectivity::Eight).value(), 1u);
+
+    BinaryImage empty(10, 10);
+    auto result = ConnectedComponents::label(empty);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result.value().components.empty());
+
+    EXPECT_THROW(static_cast<void>(result.value().labels.at(10, 0)), std::out_of_range);
+    EXPECT_THROW(LabelImage(-1, 2), std::invalid_argument);
+}
@@ -0,0 +1,215 @@
+// tests/unit/convolution_filter_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+using Method = ConvolutionFilter::Method;
+using Gray8Image = TypedImage<uint8_t, 1>;
+using RGB8Image = TypedImage<uint8_t, 3>;
+using RGBA16Image = TypedImage<uint16_t, 4>;
+using GrayFImage = TypedImage<float, 1>;
+
+std::vector<float> makeRandomKernel(int width, int height, unsigned seed) {
+    std::vector<float> kernel(static_cast<std::size_t>(width) * height);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> weight(-0.5f, 1.0f);
+    float sum = 0.0f;
+    for (float& k : kernel) {
+        k = weight(rng);
+        sum += k;
+    }
+    for (float& k : kernel) {
+        k /= sum;
+    }
+    return kernel;
+}
+
+// Correlation with replicated borders, by the definition, in double
+template <typename ImageT>
+double referenceSample(const ImageT& image, const std::vector<float>& kernel, int kernelWidth,
+                       int kernelHeight, int x, int y, int c) {
+    double sum = 0.0;
+    for (int j = 0; j < kernelHeight; ++j) {
+        const int sy = std::clamp(y + j - kernelHeight / 2, 0, image.getHeight() - 1);
+        for (int i = 0; i < kernelWidth; ++i) {
+            const int sx = std::clamp(x + i - kernelWidth / 2, 0, image.getWidth() - 1);
+            sum += kernel[j * kernelWidth + i] *
+                   static_cast<double>(image.row(sy)[sx * ImageT::kChannels + c]);
+        }
+    }
+    return sum;
+}
+
+// Integer results may differ from the rounded reference by one level where
+// float sums fall next to a rounding boundary
+template <typename ImageT>
+void expectMatchesReference(const ImageT& source, const Image& result,
+                            const std::vector<float>& kernel, int kernelWidth, int kernelHeight) {
+    using T = typename ImageT::Sample;
+    ASSERT_EQ(result.getWidth(), source.getWidth());
+    ASSERT_EQ(result.getHeight(), source.getHeight());
+    const PixelAccessor<T> out(result);
+    const double tolerance = std::is_floating_point_v<T> ? 1e-4 : 1.0;
+    for (int y = 0; y < source.getHeight(); ++y) {
+        for (int x = 0; x < source.getWidth(); ++x) {
+            for (int c = 0; c < ImageT::kChannels; ++c) {
+                double expected =
+                    referenceSample(source, kernel, kernelWidth, kernelHeight, x, y, c);
+                if constexpr (!std::is_floating_point_v<T>) {
+                    expected = std::clamp(std::round(expected), 0.0,
+                                          static_cast<double>(SampleTraits<T>::maxValue));
+                }
+                ASSERT_NEAR(out(x, y, c), expected, tolerance)
+                    << "at (" << x << ", " << y << ", " << c << ")";
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ConvolutionFilterTest, EveryMethodMatchesReference) {
+    const auto gray = makeRandomImage<Gray8Image>(37, 23, 1);
+    const auto rgba = makeRandomImage<RGBA16Image>(20, 17, 2);
+    const auto grayF = makeRandomImage<GrayFImage>(19, 26, 3);
+
+    for (auto [kernelWidth, kernelHeight] : {std::pair{1, 1}, {3, 3}, {5, 3}, {1, 7}, {9, 9}}) {
+        const auto kernel = makeRandomKernel(kernelWidth, kernelHeight, kernelWidth * 10 + kernelHeight);
+        for (Method method : {Method::Direct, Method::FFT, Method::Auto}) {
+            SCOPED_TRACE(testing::Message() << kernelWidth << "x" << kernelHeight << " method "
+                                            << static_cast<int>(method));
+            const ConvolutionFilter filter(kernel, kernelWidth, kernelHeight, method);
+
+            auto result = filter.apply(gray);
+            ASSERT_TRUE(result);
+            expectMatchesReference(gray, *result.value(), kernel, kernelWidth, kernelHeight);
+
+            result = filter.apply(rgba);
+            ASSERT_TRUE(result);
+            expectMatchesReference(rgba, *result.value(), kernel, kernelWidth, kernelHeight);
+
+            result = filter.apply(grayF);
+            ASSERT_TRUE(result);
+            expectMatchesReference(grayF, *result.value(), kernel, kernelWidth, kernelHeight);
+        }
+    }
+}
+
+TEST(ConvolutionFilterTest, KernelsWiderThanTheImage) {
+    const auto image = makeRandomImage<RGB8Image>(6, 4, 4);
+    const auto kernel = makeRandomKernel(11, 9, 5);
+    for (Method method : {Method::Direct, Method::FFT}) {
+        const ConvolutionFilter filter(kernel, 11, 9, method);
+        auto result = filter.apply(image);
+        ASSERT_TRUE(result);
+        expectMatchesReference(image, *result.value(), kernel, 11, 9);
+    }
+}
+
+TEST(ConvolutionFilterTest, DetectsSeparableKernels) {
+    // Outer product of a column and a row kernel
+    const std::vector<float> column = {1.0f, -2.0f, 0.5f, 3.0f, 1.0f};
+    const std::vector<float> row = {0.25f, 0.5f, 0.25f};
+    std::vector<float> kernel;
+    for (float u : column) {
+        for (float v : row) {
+            kernel.push_back(u * v);
+        }
+    }
+
+    const ConvolutionFilter separable(kernel, 3, 5);
+    EXPECT_TRUE(separable.isSeparable());
+    EXPECT_EQ(separable.getMethodFor(640, 480), Method::Separable);
+
+    const auto image = makeRandomImage<RGB8Image>(31, 29, 6);
+    auto result = separable.apply(image);
+    ASSERT_TRUE(result);
+    expectMatchesReference(image, *result.value(), kernel, 3, 5);
+
+    const std::vector<float> zeros(9, 0.0f);
+    EXPECT_TRUE(ConvolutionFilter(zeros, 3, 3).isSeparable());
+
+    // Perturbing one weight raises the rank
+    kernel[4] += 0.01f;
+    const ConvolutionFilter full(kernel, 3, 5);
+    EXPECT_FALSE(full.isSeparable());
+    EXPECT_NE(full.getMethodFor(640, 480), Method::Separable);
+    EXPECT_THROW(ConvolutionFilter(kernel, 3, 5, Method::Separable), std::invalid_argument);
+}
+
+TEST(ConvolutionFilterTest, ChoosesFFTForLargeKernels) {
+    const ConvolutionFilter small(makeRandomKernel(3, 3, 7), 3, 3);
+    const ConvolutionFilter large(makeRandomKernel(31, 31, 8), 31, 31);
+
+    EXPECT_EQ(small.getMethodFor(1920, 1080), Method::Direct);
+    EXPECT_EQ(large.getMethodFor(1920, 1080), Method::FFT);
+    EXPECT_EQ(ConvolutionFilter(makeRandomKernel(31, 31, 8), 31, 31, Method::Direct)
+                  .getMethodFor(1920, 1080),
+              Method::Direct);
+
+    // Large enough to run the transforms on several threads
+    const auto image = makeRandomImage<Gray8Image>(700, 500, 9);
+    const ConvolutionFilter direct(std::vector<float>(large.getKernel().begin(), large.getKernel().end()),
+                                   31, 31, Method::Direct);
+    auto expected = direct.apply(image);
+    auto actual = large.apply(image);
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(actual);
+    const PixelAccessor<uint8_t> a(*expected.value());
+    const PixelAccessor<uint8_t> b(*actual.value());
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            ASSERT_LE(std::abs(a(x, y, 0) - b(x, y, 0)), 1) << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+TEST(ConvolutionFilterTest, FiltersInPlace) {
+    const auto kernel = makeRandomKernel(5, 5, 10);
+    const auto source = makeRandomImage<RGB8Image>(40, 30, 11);
+    for (Method method : {Method::Direct, Method::FFT}) {
+        const ConvolutionFilter filter(kernel, 5, 5, method);
+        auto expected = filter.apply(source);
+        ASSERT_TRUE(expected);
+
+        auto image = source;
+        ASSERT_TRUE(filter.applyTo(image.view(), image.mutableView()));
+        const PixelAccessor<uint8_t> a(*expected.value());
+        for (int y = 0; y < image.getHeight(); ++y) {
+            for (int x = 0; x < image.getWidth() * 3; ++x) {
+                ASSERT_EQ(image.row(y)[x], a.row(y)[x]) << "at (" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
+TEST(ConvolutionFilterTest, ErrorHandling) {
+    EXPECT_THROW(ConvolutionFilter(std::vector<float>(4, 0.25f), 2, 2), std::invalid_argument);
+    EXPECT_THROW(ConvolutionFilter(std::vector<float>(9, 0.1f), 3, 5), std::invalid_argument);
+    EXPECT_THROW(ConvolutionFilter({}, 0, 0), std::invalid_argument);
+
+    const ConvolutionFilter filter(makeRandomKernel(3, 3, 12), 3, 3);
+    EXPECT_EQ(filter.getName(), "Convolution");
+    const FilterFootprint footprint = filter.getFootprint();
+    EXPECT_EQ(footprint.left, 1);
+    EXPECT_EQ(footprint.bottom, 1);
+
+    auto copy = filter.clone();
+    EXPECT_EQ(copy->getName(), "Convolution");
+
+    const auto image = makeRandomImage<Gray8Image>(8, 8, 13);
+    Gray8Image wrongSize(7, 8);
+    EXPECT_EQ(filter.applyTo(image.view(), wrongSize.mutableView()).error().code(),
+              ErrorCode::InvalidParameter);
+}
@@ -0,0 +1,129 @@
+// tests/unit/distance_transform_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+// Brute force: distance to the nearest target pixel, checking every one
+std::vector<double> referenceDistances(const BinaryImage& image, bool targetValue) {
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+    std::vector<std::pair<int, int>> targets;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (image.getPixel(x, y).value() == targetValue) {
+                targets.push_back({x, y});
+            }
+        }
+    }
+
+    std::vector<double> distances(static_cast<size_t>(width) * height,
+                                  std::numeric_limits<double>::infinity());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            long best = std::numeric_limits<long>::max();
+            for (auto [tx, ty] : targets) {
+                const long dx = tx - x;
+                const long dy = ty - y;
+                best = std::min(best, dx * dx + dy * dy);
+            }
+            if (!targets.empty()) {
+                distances[y * width + x] = std::sqrt(static_cast<double>(best));
+            }
+        }
+    }
+    return distances;
+}
+
+}  // namespace
+
+TEST(DistanceTransformTest, MatchesBruteForce) {
+    unsigned seed = 40;
+    for (int width : {1, 13, 64, 97}) {
+        for (double density : {0.02, 0.5, 0.97}) {
+            const BinaryImage image = makeRandomImage(width, 23, density, seed++);
+            for (auto target : {DistanceTarget::Background, DistanceTarget::Foreground}) {
+                const auto expected =
+                    referenceDistances(image, target == DistanceTarget::Foreground);
+                auto result = DistanceTransform::compute(image, target);
+                ASSERT_TRUE(result) << result.error().toString();
+                const auto& distances = *result.value();
+                for (int y = 0; y < 23; ++y) {
+                    for (int x = 0; x < width; ++x) {
+                        ASSERT_FLOAT_EQ(distances.at(x, y),
+                                        static_cast<float>(expected[y * width + x]))
+                            << "at (" << x << ", " << y << ")";
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(DistanceTransformTest, PartitioningDoesNotChangeResult) {
+    const BinaryImage image = makeRandomImage(300, 71, 0.03, 9);
+    auto serial = DistanceTransform::compute(image, DistanceTarget::Foreground);
+    ASSERT_TRUE(serial);
+
+    for (size_t threads : {2u, 3u, 8u, 200u}) {
+        ThreadPool pool(threads);
+        auto parallel = DistanceTransform::compute(image, DistanceTarget::Foreground, &pool);
+        ASSERT_TRUE(parallel);
+        for (int y = 0; y < 71; ++y) {
+            for (int x = 0; x < 300; ++x) {
+                ASSERT_EQ(parallel.value()->at(x, y), serial.value()->at(x, y));
+            }
+        }
+    }
+}
+
+TEST(DistanceTransformTest, SixteenBitOutputRoundsAndMarksMissingTargets) {
+    BinaryImage image(10, 5);
+    ASSERT_TRUE(image.setPixel(0, 0, true));
+
+    auto result = DistanceTransform::compute16(image, DistanceTarget::Foreground);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value()->at(0, 0), 0);
+    EXPECT_EQ(result.value()->at(3, 0), 3);
+    EXPECT_EQ(result.value()->at(1, 1), 1);  // sqrt(2)
+    EXPECT_EQ(result.value()->at(9, 4), 10); // sqrt(97)
+
+    // An all-black image has no white pixel to reach
+    BinaryImage empty(6, 4);
+    auto none = DistanceTransform::compute16(empty, DistanceTarget::Foreground);
+    ASSERT_TRUE(none);
+    EXPECT_EQ(none.value()->at(5, 3), 65535);
+    auto infinite = DistanceTransform::compute(empty, DistanceTarget::Foreground);
+    ASSERT_TRUE(infinite);
+    EXPECT_TRUE(std::isinf(infinite.value()->at(2, 2)));
+
+    auto zero = DistanceTransform::compute(empty, DistanceTarget::Background);
+    ASSERT_TRUE(zero);
+    EXPECT_EQ(zero.value()->at(2, 2), 0.0f);
+}
+
+TEST(DistanceTransformTest, LongDistancesAreExact) {
+    // Single seed in a corner of a large image: every distance is sqrt(x^2 + y^2)
+    BinaryImage image(1500, 800);
+    ASSERT_TRUE(image.setPixel(1499, 799, true));
+    auto result = DistanceTransform::compute(image, DistanceTarget::Foreground);
+    ASSERT_TRUE(result);
+    for (int y : {0, 1, 400, 799}) {
+        for (int x : {0, 7, 750, 1499}) {
+            const double dx = 1499 - x;
+            const double dy = 799 - y;
+            EXPECT_FLOAT_EQ(result.value()->at(x, y),
+                            static_cast<float>(std::sqrt(dx * dx + dy * dy)));
+        }
+    }
+}
@@ -0,0 +1,150 @@
+// tests/unit/fft_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+
+namespace {
+
+using Complex = FFTPlan::Complex;
+
+std::vector<float> makeRandomSamples(int width, int height, unsigned seed) {
+    std::vector<float> samples(static_cast<std::size_t>(width) * height);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    for (float& sample : samples) {
+        sample = value(rng);
+    }
+    return samples;
+}
+
+// Half spectrum by the definition, in double precision
+std::vector<std::complex<double>> naiveSpectrum(const std::vector<float>& samples, int width,
+                                                int height) {
+    const int bins = width / 2 + 1;
+    std::vector<std::complex<double>> spectrum(static_cast<std::size_t>(bins) * height);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < bins; ++u) {
+            std::complex<double> sum = 0.0;
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    const double turns =
+                        static_cast<double>(u) * x / width + static_cast<double>(v) * y / height;
+                    sum += static_cast<double>(samples[y * width + x]) *
+                           std::polar(1.0, -2.0 * std::numbers::pi * turns);
+                }
+            }
+            spectrum[v * bins + u] = sum;
+        }
+    }
+    return spectrum;
+}
+
+void expectMatchesDefinition(int width, int height) {
+    SCOPED_TRACE(testing::Message() << width << "x" << height);
+    const auto samples = makeRandomSamples(width, height, width * 131 + height);
+    const auto expected = naiveSpectrum(samples, width, height);
+
+    auto plan = FFTPlan::get(width, height);
+    std::vector<Complex> spectrum(expected.size());
+    ASSERT_TRUE(plan->forward(samples, spectrum));
+
+    // Errors grow with log(size) times the magnitude of the sums, about sqrt(size)
+    const double tolerance = 1e-5 * std::sqrt(static_cast<double>(width) * height) *
+                             std::log2(2.0 * width * height);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(spectrum[i].real(), expected[i].real(), tolerance) << "bin " << i;
+        ASSERT_NEAR(spectrum[i].imag(), expected[i].imag(), tolerance) << "bin " << i;
+    }
+
+    std::vector<float> restored(samples.size());
+    ASSERT_TRUE(plan->inverse(spectrum, restored));
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        ASSERT_NEAR(restored[i], samples[i], 1e-5) << "sample " << i;
+    }
+}
+
+}  // namespace
+
+TEST(FFTTest, MatchesDefinitionForMixedRadixSizes) {
+    // Powers of two and four, 3 and 5 factors, odd widths, primes above 5
+    // and single rows or columns
+    for (auto [width, height] : {std::pair{1, 1}, {2, 1}, {1, 8}, {8, 8}, {16, 4}, {32, 2},
+                                 {12, 9}, {30, 10}, {10, 25}, {15, 6}, {7, 11}, {14, 13},
+                                 {49, 3}, {6, 45}, {22, 17}}) {
+        expectMatchesDefinition(width, height);
+    }
+}
+
+TEST(FFTTest, RoundTripsLargeImagesInParallel) {
+    constexpr int kWidth = 480;
+    constexpr int kHeight = 270;
+    const auto samples = makeRandomSamples(kWidth, kHeight, 5);
+    auto plan = FFTPlan::get(kWidth, kHeight);
+    ThreadPool pool(4);
+
+    std::vector<Complex> serial(static_cast<std::size_t>(plan->getSpectrumWidth()) * kHeight);
+    std::vector<Complex> parallel(serial.size());
+    ASSERT_TRUE(plan->forward(samples, serial));
+    ASSERT_TRUE(plan->forward(samples, parallel, &pool));
+    EXPECT_EQ(serial, parallel);
+
+    // A constant image transforms into a single DC bin
+    const std::vector<float> constant(samples.size(), 0.5f);
+    ASSERT_TRUE(plan->forward(constant, serial, &pool));
+    EXPECT_NEAR(serial[0].real(), 0.5 * kWidth * kHeight, 1e-2);
+    for (std::size_t i = 1; i < serial.size(); ++i) {
+        ASSERT_LT(std::abs(serial[i]), 1e-2) << "bin " << i;
+    }
+
+    std::vector<float> restored(samples.size());
+    ASSERT_TRUE(plan->inverse(parallel, restored, &pool));
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        ASSERT_NEAR(restored[i], samples[i], 1e-5) << "sample " << i;
+    }
+}
+
+TEST(FFTTest, PlansAreCachedPerSize) {
+    auto first = FFTPlan::get(64, 48);
+    auto second = FFTPlan::get(64, 48);
+    auto other = FFTPlan::get(48, 64);
+
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_NE(first.get(), other.get());
+    EXPECT_EQ(first->getWidth(), 64);
+    EXPECT_EQ(first->getHeight(), 48);
+    EXPECT_EQ(first->getSpectrumWidth(), 33);
+
+    EXPECT_THROW((void)FFTPlan::get(0, 4), std::invalid_argument);
+    EXPECT_THROW((void)FFTPlan::get(4, -1), std::invalid_argument);
+}
+
+TEST(FFTTest, GoodSizes) {
+    EXPECT_EQ(FFTPlan::goodSize(1), 2);
+    EXPECT_EQ(FFTPlan::goodSize(7), 8);
+    EXPECT_EQ(FFTPlan::goodSize(11), 12);
+    EXPECT_EQ(FFTPlan::goodSize(31), 32);
+    EXPECT_EQ(FFTPlan::goodSize(97), 100);
+    EXPECT_EQ(FFTPlan::goodSize(1001), 1024);
+    EXPECT_EQ(FFTPlan::goodSize(1025), 1080);
+}
+
+TEST(FFTTest, ErrorHandling) {
+    auto plan = FFTPlan::get(8, 4);
+    std::vector<float> samples(32);
+    std::vector<Complex> spectrum(20);
+
+    EXPECT_TRUE(plan->forward(samples, spectrum));
+    std::vector<float> shortImage(31);
+    std::vector<Complex> shortSpectrum(19);
+    EXPECT_EQ(plan->forward(shortImage, spectrum).error().code(), ErrorCode::InvalidParameter);
+    EXPECT_EQ(plan->forward(samples, shortSpectrum).error().code(), ErrorCode::InvalidParameter);
+    EXPECT_EQ(plan->inverse(shortSpectrum, samples).error().code(), ErrorCode::InvalidParameter);
+}
@@ -4,9 +4,73 @@
 
 #include <gtest/gtest.h>
 #include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+#include <memory>
+#include <random>
 #include <vector>
 
 using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+// Five-stage denoise / sharpen chain with footprints from 1 to 3
+std::vector<std::unique_ptr<FilterStrategy>> makeDenoiseChain() {
+    std::vector<std::unique_ptr<FilterStrategy>> stages;
+    stages.push_back(std::make_unique<MedianFilter>(3));
+    stages.push_back(std::make_unique<GaussianBlurFilter>(1.2f, 7));
+    stages.push_back(std::make_unique<BoxBlurFilter>(1));
+    stages.push_back(std::make_unique<UnsharpMaskFilter>(1.5f, 1.0f));
+    stages.push_back(std::make_unique<MedianFilter>(5));
+    return stages;
+}
+
+// Runs the stages one after another on whole images
+std::unique_ptr<Image> applyInSequence(const Image& image,
+                                       const std::vector<std::unique_ptr<FilterStrategy>>& stages) {
+    std::unique_ptr<Image> current = image.clone();
+    for (const auto& stage : stages) {
+        auto result = stage->apply(*current);
+        EXPECT_TRUE(result) << result.error().toString();
+        if (!result) {
+            return nullptr;
+        }
+        current = std::move(result.value());
+    }
+    return current;
+}
+
+void expectSameImage(const Image& actual, const Image& expected) {
+    ASSERT_EQ(actual.getWidth(), expected.getWidth());
+    ASSERT_EQ(actual.getHeight(), expected.getHeight());
+    ASSERT_EQ(actual.getType(), expected.getType());
+    ASSERT_EQ(actual.getDepth(), expected.getDepth());
+    for (int y = 0; y < expected.getHeight(); ++y) {
+        const auto a = actual.view().getRow(y);
+        const auto b = expected.view().getRow(y);
+        ASSERT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end())) << "row " << y;
+    }
+}
+
+// Applies the chain fused with the given tiles and compares it with the
+// stages run one by one
+template <typename ImageT>
+void expectFusedMatchesSequence(const ImageT& image,
+                                std::vector<std::unique_ptr<FilterStrategy>> stages,
+                                int tileWidth,
+                                int tileHeight) {
+    SCOPED_TRACE(testing::Message() << "tiles " << tileWidth << "x" << tileHeight);
+    auto expected = applyInSequence(image, stages);
+    ASSERT_NE(expected, nullptr);
+
+    FilterPipeline pipeline(std::move(stages));
+    pipeline.setTileSize(tileWidth, tileHeight);
+    auto result = pipeline.apply(image);
+    ASSERT_TRUE(result) << result.error().toString();
+    expectSameImage(*result.value(), *expected);
+}
+
+}  // namespace
 
 /**
  * @brief Test fixture for FilterPipeline
@@ -32,15 +96,72 @@ protected:
 // ============================================================================
 
 TEST_F(FilterPipelineTest, DefaultConstruction) {
-    // Test default construction/creation
-    // TODO: Implement basic construction test
-    EXPECT_TRUE(true) << "Default construction test not implemented";
+    FilterPipeline pipeline;
+    EXPECT_EQ(pipeline.getStageCount(), 0u);
+    EXPECT_EQ(pipeline.getName(), "FilterPipeline");
+    EXPECT_EQ(pipeline.getTileWidth(), 0);
+    EXPECT_EQ(pipeline.getTileHeight(), 0);
+
+    const FilterFootprint footprint = pipeline.getFootprint();
+    EXPECT_EQ(footprint.left + footprint.top + footprint.right + footprint.bottom, 0);
+    EXPECT_TRUE(footprint.local);
+
+    // No stages pass the image through
+    const auto image = makeRandomImage<TypedImage<uint8_t, 3>>(9, 7, 1);
+    auto result = pipeline.apply(image);
+    ASSERT_TRUE(result);
+    expectSameImage(*result.value(), image);
 }
 
 TEST_F(FilterPipelineTest, BasicOperations) {
-    // Test basic operations
-    // TODO: Implement basic operations test
-    EXPECT_TRUE(true) << "Basic operations test not implemented";
+    FilterPipeline pipeline(makeDenoiseChain());
+    ASSERT_EQ(pipeline.getStageCount(), 5u);
+    EXPECT_EQ(pipeline.getStage(0).getName(), "MedianFilter");
+
+    // Footprints add up along the chain
+    const FilterFootprint footprint = pipeline.getFootprint();
+    EXPECT_EQ(footprint.left, 1 + 3 + 1 + 1 + 2);
+    EXPECT_EQ(footprint.bottom, footprint.left);
+    EXPECT_TRUE(footprint.local);
+
+    const auto gray = makeRandomImage<TypedImage<uint8_t, 1>>(97, 61, 2);
+    const auto rgb = makeRandomImage<TypedImage<uint8_t, 3>>(53, 40, 3);
+    const auto rgba16 = makeRandomImage<TypedImage<uint16_t, 4>>(45, 38, 4);
+    for (auto [tileWidth, tileHeight] : {std::pair{16, 16}, {23, 9}, {0, 0}}) {
+        expectFusedMatchesSequence(gray, makeDenoiseChain(), tileWidth, tileHeight);
+        expectFusedMatchesSequence(rgb, makeDenoiseChain(), tileWidth, tileHeight);
+        expectFusedMatchesSequence(rgba16, makeDenoiseChain(), tileWidth, tileHeight);
+    }
+}
+
+TEST_F(FilterPipelineTest, StagesThatChangeTheTypeOrNeedTheWholeImage) {
+    const auto rgb = makeRandomImage<TypedImage<uint8_t, 3>>(70, 45, 5);
+
+    // Sobel turns color into grayscale; later stages work on its output
+    std::vector<std::unique_ptr<FilterStrategy>> edges;
+    edges.push_back(std::make_unique<GaussianBlurFilter>(1.0f, 5));
+    edges.push_back(std::make_unique<SobelFilter>(false));
+    edges.push_back(std::make_unique<MedianFilter>(3));
+    expectFusedMatchesSequence(rgb, std::move(edges), 16, 12);
+
+    // A normalized Sobel scales by the strongest edge of the whole image,
+    // so the chain is split around it
+    EXPECT_FALSE(SobelFilter(true).getFootprint().local);
+    std::vector<std::unique_ptr<FilterStrategy>> normalized;
+    normalized.push_back(std::make_unique<MedianFilter>(3));
+    normalized.push_back(std::make_unique<BoxBlurFilter>(2));
+    normalized.push_back(std::make_unique<SobelFilter>(true));
+    normalized.push_back(std::make_unique<GaussianBlurFilter>(1.0f, 3));
+    normalized.push_back(std::make_unique<BoxBlurFilter>(1));
+    EXPECT_FALSE(FilterPipeline(std::move(normalized)).getFootprint().local);
+
+    normalized.clear();
+    normalized.push_back(std::make_unique<MedianFilter>(3));
+    normalized.push_back(std::make_unique<BoxBlurFilter>(2));
+    normalized.push_back(std::make_unique<SobelFilter>(true));
+    normalized.push_back(std::make_unique<GaussianBlurFilter>(1.0f, 3));
+    normalized.push_back(std::make_unique<BoxBlurFilter>(1));
+    expectFusedMatchesSequence(rgb, std::move(normalized), 16, 12);
 }
 
 // ============================================================================
@@ -48,9 +169,20 @@ TEST_F(FilterPipelineTest, BasicOperations) {
 // ============================================================================
 
 TEST_F(FilterPipelineTest, ErrorHandling) {
-    // Test error conditions and edge cases
-    // TODO: Implement error handling tests
-    EXPECT_TRUE(true) << "Error handling test not implemented";
+    FilterPipeline pipeline;
+    EXPECT_THROW(pipeline.addStage(nullptr), std::invalid_argument);
+    EXPECT_THROW(pipeline.setTileSize(-1, 8), std::invalid_argument);
+    EXPECT_THROW((void)pipeline.getStage(0), std::out_of_range);
+
+    pipeline.addStage(std::make_unique<MedianFilter>(3)).addStage(std::make_unique<BoxBlurFilter>(1));
+    EXPECT_FALSE(pipeline.apply(ImageView{}));
+
+    // Stage errors are reported, not partial images
+    auto binary = ImageFactory::create(40, 40, Image::Type::Binary);
+    ASSERT_TRUE(binary);
+    pipeline.setTileSize(8, 8);
+    auto result = pipeline.apply(*binary.value());
+    EXPECT_FALSE(result);
 }
 
 // ============================================================================
@@ -58,9 +190,16 @@ TEST_F(FilterPipelineTest, ErrorHandling) {
 // ============================================================================
 
 TEST_F(FilterPipelineTest, BoundaryConditions) {
-    // Test boundary conditions and limits
-    // TODO: Implement boundary condition tests
-    EXPECT_TRUE(true) << "Boundary condition test not implemented";
+    // Tiles smaller than the halo, a single tile, and images one pixel wide
+    const auto gray = makeRandomImage<TypedImage<uint8_t, 1>>(31, 27, 6);
+    expectFusedMatchesSequence(gray, makeDenoiseChain(), 1, 1);
+    expectFusedMatchesSequence(gray, makeDenoiseChain(), 3, 50);
+    expectFusedMatchesSequence(gray, makeDenoiseChain(), 500, 500);
+
+    const auto column = makeRandomImage<TypedImage<uint8_t, 1>>(1, 40, 7);
+    expectFusedMatchesSequence(column, makeDenoiseChain(), 4, 4);
+    const auto row = makeRandomImage<TypedImage<float, 1>>(40, 1, 8);
+    expectFusedMatchesSequence(row, makeDenoiseChain(), 4, 4);
 }
 
 // ============================================================================
@@ -68,9 +207,10 @@ TEST_F(FilterPipelineTest, BoundaryConditions) {
 // ============================================================================
 
 TEST_F(FilterPipelineTest, BasicPerformance) {
-    // Basic performance validation
-    // TODO: Implement performance tests if needed
-    EXPECT_TRUE(true) << "Performance test not implemented";
+    // Large enough for the tiles to be shared among workers
+    const auto image = makeRandomImage<TypedImage<uint8_t, 3>>(700, 420, 9);
+    expectFusedMatchesSequence(image, makeDenoiseChain(), 0, 0);
+    expectFusedMatchesSequence(image, makeDenoiseChain(), 64, 32);
 }
 
 // ============================================================================
@@ -78,9 +218,27 @@ TEST_F(FilterPipelineTest, BasicPerformance) {
 // ============================================================================
 
 TEST_F(FilterPipelineTest, Integration) {
-    // Integration with other components
-    // TODO: Implement integration tests if needed
-    EXPECT_TRUE(true) << "Integration test not implemented";
+    // processAll fuses consecutive filter commands into one pipeline
+    const auto image = makeRandomImage<TypedImage<uint8_t, 1>>(120, 90, 10);
+    auto expected = applyInSequence(image, makeDenoiseChain());
+    ASSERT_NE(expected, nullptr);
+
+    std::vector<std::unique_ptr<ProcessingCommand>> commands;
+    for (auto& stage : makeDenoiseChain()) {
+        commands.push_back(std::make_unique<FilterCommand>(std::move(stage)));
+    }
+    ImageProcessor processor;
+    auto result = processor.processAll(image, commands);
+    ASSERT_TRUE(result) << result.error().toString();
+    expectSameImage(*result.value(), *expected);
+
+    // A pipeline is itself a filter, and clones with its stages
+    FilterPipeline pipeline(makeDenoiseChain());
+    pipeline.setTileSize(20, 20);
+    auto copy = pipeline.clone();
+    auto cloned = copy->apply(image);
+    ASSERT_TRUE(cloned);
+    expectSameImage(*cloned.value(), *expected);
 }
 
 // Additional test cases should be added based on specific functionality
@@ -0,0 +1,212 @@
+// tests/unit/image_allocator_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+using namespace DIPAL;
+
+// Test fixture for ImageAllocator tests; restores the default allocator afterwards
+class ImageAllocatorTest : public ::testing::Test {
+protected:
+    void SetUp() override { m_previous = ImageAllocator::getDefault(); }
+
+    void TearDown() override { ImageAllocator::setDefault(m_previous); }
+
+    std::shared_ptr<ImageAllocator> m_previous;
+};
+
+TEST_F(ImageAllocatorTest, DefaultIsHeapAllocator) {
+    ImageAllocator::setDefault(nullptr);
+    EXPECT_EQ(ImageAllocator::getDefault()->getName(), "HeapImageAllocator");
+}
+
+TEST_F(ImageAllocatorTest, HeapAllocatorSkipsClearingWhenAskedTo) {
+    HeapImageAllocator heap;
+    const ImageBufferKey key{100, 30, Image::Type::RGB, Image::RowLayout::Packed, 9000};
+    const PixelBuffer zeroed = heap.allocate(key);
+    const PixelBuffer raw = heap.allocate(key, false);
+    ASSERT_EQ(raw.size(), key.bytes);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(raw.data()) % PixelBuffer::kAlignment, 0u);
+    EXPECT_TRUE(std::all_of(zeroed.data(), zeroed.data() + zeroed.size(),
+                            [](uint8_t v) { return v == 0; }));
+
+    // Detaching a clone overwrites the unzeroed copy with the shared pixels
+    ImageAllocator::setDefault(nullptr);
+    GrayscaleImage image(64, 16);
+    ASSERT_TRUE(image.setPixel(63, 15, 7));
+    auto clone = image.clone();
+    ASSERT_TRUE(image.setPixel(0, 0, 1));
+    EXPECT_FALSE(clone->sharesDataWith(image));
+    EXPECT_EQ(static_cast<GrayscaleImage&>(*clone).getPixel(63, 15).value(), 7);
+    EXPECT_EQ(static_cast<GrayscaleImage&>(*clone).getPixel(0, 0).value(), 0);
+}
+
+TEST_F(ImageAllocatorTest, PoolReusesBuffersOfSameShape) {
+    auto pool = std::make_shared<PooledImageAllocator>();
+    ImageAllocator::setDefault(pool);
+
+    const uint8_t* first = nullptr;
+    {
+        auto image = ImageFactory::createGrayscale(64, 32);
+        ASSERT_TRUE(image);
+        ASSERT_TRUE(image.value()->setPixel(5, 5, 99));
+        first = std::as_const(*image.value()).getData();
+    }
+    EXPECT_EQ(pool->getStatistics().cachedBytes, 64u * 32u);
+
+    auto again = ImageFactory::createGrayscale(64, 32);
+    ASSERT_TRUE(again);
+    EXPECT_EQ(std::as_const(*again.value()).getData(), first);
+
+    // Recycled buffers are handed out zero-filled
+    EXPECT_EQ(again.value()->getPixel(5, 5).value(), 0);
+
+    auto stats = pool->getStatistics();
+    EXPECT_EQ(stats.threadCacheHits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.cachedBytes, 0u);
+
+    // A different shape does not reuse the buffer
+    auto other = ImageFactory::createGrayscale(32, 64);
+    ASSERT_TRUE(other);
+    EXPECT_EQ(pool->getStatistics().misses, 2u);
+}
+
+TEST_F(ImageAllocatorTest, CopyOnWriteDetachUsesPool) {
+    auto pool = std::make_shared<PooledImageAllocator>();
+    ImageAllocator::setDefault(pool);
+
+    auto image = ImageFactory::createColor(16, 16);
+    ASSERT_TRUE(image);
+    ASSERT_TRUE(image.value()->setPixel(1, 1, 10, 20, 30));
+
+    auto clone = image.value()->clone();
+    auto& color = static_cast<ColorImage&>(*clone);
+    ASSERT_TRUE(color.setPixel(1, 1, 1, 2, 3));
+    EXPECT_EQ(pool->getStatistics().misses, 2u);
+
+    uint8_t r, g, b, a;
+    ASSERT_TRUE(image.value()->getPixel(1, 1, r, g, b, a));
+    EXPECT_EQ(r, 10);
+    ASSERT_TRUE(color.getPixel(1, 1, r, g, b, a));
+    EXPECT_EQ(r, 1);
+}
+
+TEST_F(ImageAllocatorTest, MemoryCapLimitsIdleBytes) {
+    PooledImageAllocator::Config config;
+    config.memoryCap = 1000;
+    auto pool = std::make_shared<PooledImageAllocator>(config);
+    ImageAllocator::setDefault(pool);
+
+    {
+        auto small = ImageFactory::createGrayscale(20, 20);  // 400 bytes
+        auto large = ImageFactory::createGrayscale(40, 40);  // 1600 bytes, over the cap
+        ASSERT_TRUE(small);
+        ASSERT_TRUE(large);
+    }
+
+    auto stats = pool->getStatistics();
+    EXPECT_EQ(stats.cachedBytes, 400u);
+    EXPECT_EQ(stats.releasedBytes, 1600u);
+
+    pool->setMemoryCap(0);
+    pool->trim();
+    EXPECT_EQ(pool->getStatistics().cachedBytes, 0u);
+}
+
+TEST_F(ImageAllocatorTest, BuffersReleasedOnOtherThreadsReturnToPool) {
+    PooledImageAllocator::Config config;
+    config.threadCacheEntries = 0;  // Force everything through the shared pool
+    auto pool = std::make_shared<PooledImageAllocator>(config);
+    ImageAllocator::setDefault(pool);
+
+    std::thread worker([] {
+        auto image = ImageFactory::createBinary(100, 10);
+        ASSERT_TRUE(image);
+    });
+    worker.join();
+
+    EXPECT_EQ(pool->getStatistics().cachedBytes, 13u * 10u);
+
+    auto image = ImageFactory::createBinary(100, 10);
+    ASSERT_TRUE(image);
+    EXPECT_EQ(pool->getStatistics().poolHits, 1u);
+    EXPECT_EQ(image.value()->countWhitePixels(), 0u);
+}
+
+TEST_F(ImageAllocatorTest, BuffersOutliveAllocator) {
+    std::unique_ptr<Image> survivor;
+    {
+        auto pool = std::make_shared<PooledImageAllocator>();
+        ImageAllocator::setDefault(pool);
+        auto image = ImageFactory::createGrayscale(8, 8);
+        ASSERT_TRUE(image);
+        ASSERT_TRUE(image.value()->setPixel(7, 7, 200));
+        survivor = std::move(image.value());
+        ImageAllocator::setDefault(nullptr);
+    }
+
+    auto& gray = static_cast<GrayscaleImage&>(*survivor);
+    EXPECT_EQ(gray.getPixel(7, 7).value(), 200);
+    survivor.reset();
+}
+
+TEST_F(ImageAllocatorTest, LargePageBuffersAreAlignedAndZeroed) {
+    LargePageImageAllocator::Config config;
+    config.threshold = 1u << 20;
+    config.firstTouchPool = std::make_shared<ThreadPool>(3);
+    auto allocator = std::make_shared<LargePageImageAllocator>(config);
+    ImageAllocator::setDefault(allocator);
+
+    GrayscaleImage large(1500, 1001);
+    GrayscaleImage small(64, 64);
+    const auto address = reinterpret_cast<std::uintptr_t>(std::as_const(large).getData());
+    EXPECT_EQ(address % LargePageImageAllocator::kHugePageSize, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(std::as_const(small).getData()) %
+                  PixelBuffer::kAlignment,
+              0u);
+
+    const auto first = large.getRow(0);
+    const auto last = large.getRow(large.getHeight() - 1);
+    EXPECT_TRUE(std::all_of(first.begin(), first.end(), [](uint8_t v) { return v == 0; }));
+    EXPECT_TRUE(std::all_of(last.begin(), last.end(), [](uint8_t v) { return v == 0; }));
+    ASSERT_TRUE(large.setPixel(1499, 1000, 9));
+    EXPECT_EQ(large.getPixel(1499, 1000).value(), 9);
+}
+
+TEST_F(ImageAllocatorTest, LargePageAllocatorSharesPoolWithProcessor) {
+    auto pool = std::make_shared<ThreadPool>(4, ThreadBinding::NumaNode);
+    LargePageImageAllocator::Config config;
+    config.threshold = 64u << 10;
+    config.firstTouchPool = pool;
+    ImageAllocator::setDefault(std::make_shared<LargePageImageAllocator>(config));
+
+    GrayscaleImage image(640, 420);
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); x += 7) {
+            ASSERT_TRUE(image.setPixel(x, y, static_cast<uint8_t>(x + y)));
+        }
+    }
+
+    // Strips allocate their outputs on the workers; those are not pre-touched
+    ParallelProcessor processor(pool);
+    EXPECT_EQ(processor.getThreadPool(), pool);
+    GaussianBlurFilter blur(1.0f);
+    auto parallel = processor.applyFilter(image, blur);
+    ImageAllocator::setDefault(nullptr);
+    auto sequential = blur.apply(image);
+
+    ASSERT_TRUE(parallel);
+    ASSERT_TRUE(sequential);
+    for (int y = 0; y < image.getHeight(); y += 13) {
+        auto expected = std::as_const(*sequential.value()).getRow(y);
+        auto actual = std::as_const(*parallel.value()).getRow(y);
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin())) << "row " << y;
+    }
+
+    EXPECT_THROW(ParallelProcessor(std::shared_ptr<ThreadPool>{}), std::invalid_argument);
+}
@@ -208,6 +208,122 @@ TEST_F(ImageTest, ImageConversion) {
     }
 }
 
+// Test aligned row layout
+TEST_F(ImageTest, AlignedRowStride) {
+    auto result = DIPAL::ImageFactory::createGrayscale(37, 5, DIPAL::Image::RowLayout::Aligned);
+    ASSERT_TRUE(result) << "Failed to create aligned image: " << result.error().toString();
+
+    auto& image = *result.value();
+    EXPECT_EQ(image.getRowBytes(), 37u);
+    EXPECT_EQ(image.getStride() % DIPAL::Image::kRowAlignment, 0u);
+    EXPECT_GE(image.getStride(), image.getRowBytes());
+    EXPECT_FALSE(image.isContiguous());
+
+    for (int y = 0; y < image.getHeight(); ++y) {
+        auto row = image.getRow(y);
+        EXPECT_EQ(row.size(), 37u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(row.data()) % DIPAL::Image::kRowAlignment, 0u);
+    }
+
+    for (int y = 0; y < 5; ++y) {
+        for (int x = 0; x < 37; ++x) {
+            ASSERT_TRUE(image.setPixel(x, y, static_cast<uint8_t>(x * 7 + y)));
+        }
+    }
+
+    auto clone = image.clone();
+    EXPECT_EQ(clone->getRowLayout(), DIPAL::Image::RowLayout::Aligned);
+    EXPECT_EQ(clone->getStride(), image.getStride());
+
+    auto& cloned = static_cast<DIPAL::GrayscaleImage&>(*clone);
+    for (int y = 0; y < 5; ++y) {
+        auto row = cloned.getRow(y);
+        for (int x = 0; x < 37; ++x) {
+            EXPECT_EQ(row[x], static_cast<uint8_t>(x * 7 + y));
+            EXPECT_EQ(cloned.getPixel(x, y).value(), static_cast<uint8_t>(x * 7 + y));
+        }
+    }
+}
+
+// Test that packed images keep their rows contiguous
+TEST_F(ImageTest, PackedRowStride) {
+    auto result = DIPAL::ImageFactory::createColor(13, 4, true);
+    ASSERT_TRUE(result);
+
+    auto& image = *result.value();
+    EXPECT_EQ(image.getStride(), 13u * 4u);
+    EXPECT_TRUE(image.isContiguous());
+    EXPECT_EQ(image.getDataSize(), image.getStride() * 4u);
+}
+
+// Test conversions on aligned images
+TEST_F(ImageTest, AlignedColorConversion) {
+    auto result = DIPAL::ImageFactory::createColor(21, 3, false, DIPAL::Image::RowLayout::Aligned);
+    ASSERT_TRUE(result);
+
+    auto& image = *result.value();
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 21; ++x) {
+            ASSERT_TRUE(image.setPixel(x, y, static_cast<uint8_t>(x * 10), 0, 0));
+        }
+    }
+
+    auto grayResult = DIPAL::ImageFactory::toGrayscale(image);
+    ASSERT_TRUE(grayResult);
+    EXPECT_EQ(grayResult.value()->getRowLayout(), DIPAL::Image::RowLayout::Aligned);
+
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 21; ++x) {
+            EXPECT_EQ(grayResult.value()->getPixel(x, y).value(),
+                      static_cast<uint8_t>(0.299f * static_cast<float>(x * 10)));
+        }
+    }
+}
+
+// Test copy-on-write sharing of pixel buffers
+TEST_F(ImageTest, CloneSharesUntilWrite) {
+    auto result = DIPAL::ImageFactory::createGrayscale(16, 8);
+    ASSERT_TRUE(result);
+    auto& image = *result.value();
+    ASSERT_TRUE(image.setPixel(3, 4, 42));
+
+    auto clone = image.clone();
+    EXPECT_TRUE(clone->sharesDataWith(image));
+    EXPECT_TRUE(image.isShared());
+    EXPECT_EQ(std::as_const(*clone).getData(), std::as_const(image).getData());
+
+    // Writing to the clone gives it a private copy and leaves the original alone
+    auto& cloned = static_cast<DIPAL::GrayscaleImage&>(*clone);
+    ASSERT_TRUE(cloned.setPixel(3, 4, 7));
+    EXPECT_FALSE(clone->sharesDataWith(image));
+    EXPECT_FALSE(image.isShared());
+    EXPECT_EQ(cloned.getPixel(3, 4).value(), 7);
+    EXPECT_EQ(image.getPixel(3, 4).value(), 42);
+
+    // Copy construction shares as well
+    DIPAL::GrayscaleImage copy(image);
+    EXPECT_TRUE(copy.sharesDataWith(image));
+    ASSERT_TRUE(image.setPixel(0, 0, 1));
+    EXPECT_EQ(copy.getPixel(0, 0).value(), 0);
+    EXPECT_EQ(copy.getPixel(3, 4).value(), 42);
+}
+
+// Test that an image outlives the buffer it was cloned from
+TEST_F(ImageTest, CloneOutlivesOriginal) {
+    std::unique_ptr<DIPAL::Image> clone;
+    {
+        auto result = DIPAL::ImageFactory::createBinary(9, 3);
+        ASSERT_TRUE(result);
+        ASSERT_TRUE(result.value()->setPixel(8, 2, true));
+        clone = result.value()->clone();
+    }
+
+    auto& binary = static_cast<DIPAL::BinaryImage&>(*clone);
+    EXPECT_FALSE(binary.isShared());
+    EXPECT_TRUE(binary.getPixel(8, 2).value());
+    EXPECT_EQ(binary.countWhitePixels(), 1u);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,187 @@
+// tests/unit/integral_image_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+using Gray8Image = TypedImage<uint8_t, 1>;
+using RGB8Image = TypedImage<uint8_t, 3>;
+
+// Sum and sum of squares of one channel over a clipped window, computed directly
+template <typename ImageT>
+std::pair<double, double> windowMoments(const ImageT& image, int x, int y, int radius, int c,
+                                        int* area) {
+    const int x0 = std::max(0, x - radius);
+    const int x1 = std::min(image.getWidth(), x + radius + 1);
+    const int y0 = std::max(0, y - radius);
+    const int y1 = std::min(image.getHeight(), y + radius + 1);
+    double sum = 0;
+    double squares = 0;
+    for (int j = y0; j < y1; ++j) {
+        for (int i = x0; i < x1; ++i) {
+            const double v = image.at(i, j, c);
+            sum += v;
+            squares += v * v;
+        }
+    }
+    *area = (x1 - x0) * (y1 - y0);
+    return {sum, squares};
+}
+
+}  // namespace
+
+TEST(IntegralImageTest, RectangleSumsMatchDirectSums) {
+    const auto image = makeRandomImage<RGB16Image>(23, 17, 1);
+    auto table = IntegralImage<uint64_t>::compute(image.view(), true);
+    ASSERT_TRUE(table) << table.error().toString();
+    EXPECT_EQ(table.value().getChannels(), 3);
+    EXPECT_EQ(table.value().row(0).size(), 24u * 3u);
+
+    for (const Rect rect : {Rect(0, 0, 23, 17), Rect(5, 3, 1, 1), Rect(7, 2, 11, 9), Rect(3, 3, 0, 4)}) {
+        for (int c = 0; c < 3; ++c) {
+            uint64_t sum = 0;
+            uint64_t squares = 0;
+            for (int y = rect.y; y < rect.y + rect.height; ++y) {
+                for (int x = rect.x; x < rect.x + rect.width; ++x) {
+                    const uint64_t v = image.at(x, y, c);
+                    sum += v;
+                    squares += v * v;
+                }
+            }
+            EXPECT_EQ(table.value().sum(rect, c), sum);
+            EXPECT_EQ(table.value().squaredSum(rect, c), squares);
+        }
+    }
+}
+
+TEST(IntegralImageTest, WrappingThirtyTwoBitTableKeepsWindowSumsExact) {
+    // The squares of 300 x 300 white pixels add up to 5.9e9, past 2^32
+    Gray8Image image(300, 300);
+    image.fill(255);
+    auto table = IntegralImage<uint32_t>::compute(image.view(), true);
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table.value().sum(Rect(250, 250, 50, 50), 0), 2500u * 255u);
+    EXPECT_EQ(table.value().squaredSum(Rect(250, 250, 50, 50), 0), 2500u * 255u * 255u);
+}
+
+TEST(IntegralImageTest, PartitioningDoesNotChangeResult) {
+    const auto image = makeRandomImage<Gray16Image>(61, 203, 2);
+    auto serial = IntegralImage<uint64_t>::compute(image.view(), true);
+    ASSERT_TRUE(serial);
+    for (size_t threads : {2u, 5u, 300u}) {
+        ThreadPool pool(threads);
+        auto parallel = IntegralImage<uint64_t>::compute(image.view(), true, &pool);
+        ASSERT_TRUE(parallel);
+        for (int y = 0; y <= 203; ++y) {
+            ASSERT_TRUE(std::ranges::equal(parallel.value().row(y), serial.value().row(y)));
+            ASSERT_TRUE(std::ranges::equal(parallel.value().squaredRow(y), serial.value().squaredRow(y)));
+        }
+    }
+}
+
+TEST(IntegralImageTest, RejectsUnsupportedInputs) {
+    GrayFloatImage floats(4, 4);
+    auto integer = IntegralImage<uint32_t>::compute(floats.view());
+    ASSERT_FALSE(integer);
+    EXPECT_EQ(integer.error().code(), ErrorCode::UnsupportedFormat);
+    EXPECT_TRUE(IntegralImage<double>::compute(floats.view()));
+
+    BinaryImage binary(8, 8);
+    EXPECT_FALSE(IntegralImage<uint64_t>::compute(binary.view()));
+}
+
+TEST(BoxBlurFilterTest, MatchesClippedWindowMeans) {
+    for (int radius : {0, 1, 4, 40}) {
+        const auto image = makeRandomImage<RGB8Image>(31, 19, 3u + static_cast<unsigned>(radius));
+        auto blurred = BoxBlurFilter(radius).apply(image);
+        ASSERT_TRUE(blurred) << blurred.error().toString();
+        const PixelAccessor<uint8_t> result(blurred.value()->view());
+        for (int y = 0; y < 19; ++y) {
+            for (int x = 0; x < 31; ++x) {
+                for (int c = 0; c < 3; ++c) {
+                    int area = 0;
+                    const double sum = windowMoments(image, x, y, radius, c, &area).first;
+                    ASSERT_EQ(result.row(y)[x * 3 + c], static_cast<int>(std::floor(sum / area + 0.5)))
+                        << "radius " << radius << " at (" << x << ", " << y << ")";
+                }
+            }
+        }
+    }
+}
+
+TEST(BoxBlurFilterTest, FloatImagesInPlace) {
+    auto image = makeRandomImage<GrayFloatImage>(12, 9, 4);
+    const auto original = image;
+    ASSERT_TRUE(BoxBlurFilter(2).applyTo(image.view(), image.mutableView()));
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 12; ++x) {
+            int area = 0;
+            const double sum = windowMoments(original, x, y, 2, 0, &area).first;
+            ASSERT_NEAR(image.at(x, y), sum / area, 1e-6);
+        }
+    }
+
+    const BoxBlurFilter filter(6);
+    EXPECT_EQ(filter.getFootprint().right, 6);
+    EXPECT_EQ(filter.clone()->getName(), "BoxBlur");
+    EXPECT_THROW(BoxBlurFilter(-1), std::invalid_argument);
+}
+
+TEST(LocalStatisticsTest, MeanAndVarianceMatchDirectComputation) {
+    const auto image = makeRandomImage<Gray8Image>(40, 27, 5);
+    for (int radius : {0, 2, 7}) {
+        auto moments = LocalStatistics::meanAndVariance(image.view(), radius);
+        ASSERT_TRUE(moments) << moments.error().toString();
+        ASSERT_EQ(moments.value().mean->getDepth(), Image::Depth::Float32);
+        const PixelAccessor<float> mean(moments.value().mean->view());
+        const PixelAccessor<float> variance(moments.value().variance->view());
+        for (int y = 0; y < 27; ++y) {
+            for (int x = 0; x < 40; ++x) {
+                int area = 0;
+                const auto [sum, squares] = windowMoments(image, x, y, radius, 0, &area);
+                const double m = sum / area;
+                ASSERT_NEAR(mean.row(y)[x], m, 1e-3);
+                ASSERT_NEAR(variance.row(y)[x], squares / area - m * m, 1e-2);
+            }
+        }
+    }
+}
+
+TEST(LocalStatisticsTest, FloatImagesAndSingleStatistics) {
+    const auto image = makeRandomImage<RGBFloatImage>(17, 13, 6);
+    auto mean = LocalStatistics::mean(image.view(), 3);
+    auto variance = LocalStatistics::variance(image.view(), 3);
+    ASSERT_TRUE(mean && variance);
+    EXPECT_EQ(mean.value()->getType(), Image::Type::RGB);
+    const PixelAccessor<float> means(mean.value()->view());
+    const PixelAccessor<float> variances(variance.value()->view());
+    for (int y = 0; y < 13; ++y) {
+        for (int x = 0; x < 17; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                int area = 0;
+                const auto [sum, squares] = windowMoments(image, x, y, 3, c, &area);
+                const double m = sum / area;
+                ASSERT_NEAR(means.row(y)[x * 3 + c], m, 1e-6);
+                ASSERT_NEAR(variances.row(y)[x * 3 + c], squares / area - m * m, 1e-6);
+            }
+        }
+    }
+
+    Gray16Image flat(9, 9);
+    flat.fill(1000);
+    auto zero = LocalStatistics::variance(flat.view(), 2);
+    ASSERT_TRUE(zero);
+    EXPECT_EQ(PixelAccessor<float>(zero.value()->view()).row(4)[4], 0.0f);
+
+    EXPECT_EQ(LocalStatistics::mean(flat.view(), -1).error().code(), ErrorCode::InvalidParameter);
+}
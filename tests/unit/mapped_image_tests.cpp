@@ -0,0 +1,293 @@
+// tests/unit/mapped_image_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace DIPAL;
+
+namespace {
+
+class MappedImageTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (const auto& path : m_files) {
+            std::filesystem::remove(path);
+        }
+    }
+
+    std::string tempFile(const std::string& name) {
+        auto path = std::filesystem::temp_directory_path() / ("dipal_mapped_" + name);
+        m_files.push_back(path);
+        return path.string();
+    }
+
+private:
+    std::vector<std::filesystem::path> m_files;
+};
+
+ColorImage makeGradient(int width, int height) {
+    ColorImage image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            EXPECT_TRUE(image.setPixel(x, y, static_cast<uint8_t>(x * 5), static_cast<uint8_t>(y * 9),
+                                       static_cast<uint8_t>(x + y)));
+        }
+    }
+    return image;
+}
+
+bool samePixels(const Image& a, const Image& b) {
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight() ||
+        a.getRowBytes() != b.getRowBytes()) {
+        return false;
+    }
+    for (int y = 0; y < a.getHeight(); ++y) {
+        auto rowA = a.getRow(y);
+        auto rowB = b.getRow(y);
+        if (!std::equal(rowA.begin(), rowA.end(), rowB.begin())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST_F(MappedImageTest, AdoptsExternalBuffers) {
+    PixelBuffer buffer(4 * 3);
+    const uint8_t* memory = buffer.data();
+    GrayscaleImage image(4, 3, Image::RowLayout::Packed, buffer);
+    EXPECT_EQ(std::as_const(image).getData(), memory);
+
+    EXPECT_THROW(GrayscaleImage(5, 3, Image::RowLayout::Packed, PixelBuffer(12)),
+                 std::invalid_argument);
+    EXPECT_FALSE(ImageFactory::wrap(8, 8, Image::Type::RGB, Image::Depth::UInt16,
+                                    Image::RowLayout::Aligned, PixelBuffer(64)));
+
+    auto wrapped = ImageFactory::wrap(8, 2, Image::Type::RGB, Image::Depth::UInt8,
+                                      Image::RowLayout::Aligned, PixelBuffer(128));
+    ASSERT_TRUE(wrapped);
+    EXPECT_NE(dynamic_cast<ColorImage*>(wrapped.value().get()), nullptr);
+}
+
+TEST_F(MappedImageTest, MapsPpmInPlace) {
+    const std::string path = tempFile("gradient.ppm");
+    ColorImage image = makeGradient(37, 11);
+    ASSERT_TRUE(PPMImageIO::save(image, path));
+
+    auto mapped = MappedImageIO::map(path);
+    ASSERT_TRUE(mapped) << mapped.error().toString();
+    ASSERT_EQ(mapped.value()->getType(), Image::Type::RGB);
+    EXPECT_TRUE(samePixels(*mapped.value(), image));
+
+    // Read-only mappings keep writes private to the process
+    auto& color = static_cast<ColorImage&>(*mapped.value());
+    ASSERT_TRUE(color.setPixel(0, 0, 1, 2, 3));
+    auto reloaded = PPMImageIO::load(path);
+    ASSERT_TRUE(reloaded);
+    EXPECT_TRUE(samePixels(*reloaded.value(), image));
+}
+
+TEST_F(MappedImageTest, ReadWriteMappingsUpdateTheFile) {
+    const std::string path = tempFile("gray.pgm");
+    GrayscaleImage image(20, 6);
+    ASSERT_TRUE(PPMImageIO::save(image, path));
+
+    {
+        auto mapped = MappedImageIO::map(path, MappedImageIO::Access::ReadWrite);
+        ASSERT_TRUE(mapped);
+        auto& gray = static_cast<GrayscaleImage&>(*mapped.value());
+        ASSERT_TRUE(gray.setPixel(19, 5, 200));
+        EXPECT_TRUE(MappedImageIO::flush(gray));
+    }
+
+    auto reloaded = PPMImageIO::load(path);
+    ASSERT_TRUE(reloaded);
+    EXPECT_EQ(static_cast<GrayscaleImage&>(*reloaded.value()).getPixel(19, 5).value(), 200);
+}
+
+TEST_F(MappedImageTest, ClonesOfReadWriteMappingsLeaveTheFileToTheOriginal) {
+    const std::string path = tempFile("clone.pgm");
+    ASSERT_TRUE(PPMImageIO::save(GrayscaleImage(8, 4), path));
+
+    {
+        auto mapped = MappedImageIO::map(path, MappedImageIO::Access::ReadWrite);
+        ASSERT_TRUE(mapped);
+        auto& original = static_cast<GrayscaleImage&>(*mapped.value());
+        EXPECT_TRUE(original.hasExclusiveData());
+        const uint8_t* fileBytes = std::as_const(original).getData();
+
+        // The clone has its own pixels from the start
+        auto clone = original.clone();
+        EXPECT_FALSE(clone->sharesDataWith(original));
+        EXPECT_FALSE(clone->hasExclusiveData());
+
+        // Writing to the original first still reaches the file
+        ASSERT_TRUE(original.setPixel(1, 1, 40));
+        EXPECT_EQ(std::as_const(original).getData(), fileBytes);
+        ASSERT_TRUE(static_cast<GrayscaleImage&>(*clone).setPixel(2, 2, 90));
+        EXPECT_TRUE(MappedImageIO::flush(original));
+    }
+
+    auto reloaded = PPMImageIO::load(path);
+    ASSERT_TRUE(reloaded);
+    const auto& gray = static_cast<GrayscaleImage&>(*reloaded.value());
+    EXPECT_EQ(gray.getPixel(1, 1).value(), 40);
+    EXPECT_EQ(gray.getPixel(2, 2).value(), 0);
+
+    // Read-only mappings stay copy-on-write
+    auto readOnly = MappedImageIO::map(path);
+    ASSERT_TRUE(readOnly);
+    EXPECT_FALSE(readOnly.value()->hasExclusiveData());
+    EXPECT_TRUE(readOnly.value()->clone()->sharesDataWith(*readOnly.value()));
+}
+
+TEST_F(MappedImageTest, FlushRejectsPixelsOutsideAWritableMapping) {
+    const std::string path = tempFile("flush.pgm");
+    ASSERT_TRUE(PPMImageIO::save(GrayscaleImage(8, 4), path));
+
+    auto readOnly = MappedImageIO::map(path);
+    ASSERT_TRUE(readOnly);
+    auto readWrite = MappedImageIO::map(path, MappedImageIO::Access::ReadWrite);
+    ASSERT_TRUE(readWrite);
+    auto clone = readWrite.value()->clone();
+
+    for (const Image* image : {static_cast<const Image*>(readOnly.value().get()),
+                               static_cast<const Image*>(clone.get())}) {
+        auto status = MappedImageIO::flush(*image);
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().code(), ErrorCode::InvalidParameter);
+    }
+    EXPECT_FALSE(MappedImageIO::flush(GrayscaleImage(8, 4)));
+    EXPECT_TRUE(MappedImageIO::flush(*readWrite.value()));
+}
+
+TEST_F(MappedImageTest, RawFilesKeepDepthAndLayout) {
+    const std::string path = tempFile("wide.raw");
+    {
+        auto created = MappedImageIO::create(path, 9, 5, Image::Type::RGBA, Image::Depth::UInt16,
+                                             Image::RowLayout::Aligned);
+        ASSERT_TRUE(created) << created.error().toString();
+        auto& wide = static_cast<RGBA16Image&>(*created.value());
+        EXPECT_EQ(wide.at(8, 4, 3), 0);
+        wide.at(8, 4, 3) = 54321;
+        wide.at(0, 1, 0) = 7;
+    }
+
+    auto mapped = MappedImageIO::map(path);
+    ASSERT_TRUE(mapped);
+    ASSERT_EQ(mapped.value()->getDepth(), Image::Depth::UInt16);
+    ASSERT_EQ(mapped.value()->getRowLayout(), Image::RowLayout::Aligned);
+    const auto& wide = static_cast<const RGBA16Image&>(*mapped.value());
+    EXPECT_EQ(wide.at(8, 4, 3), 54321);
+    EXPECT_EQ(wide.at(0, 1, 0), 7);
+
+    // Round trip through saveRaw
+    const std::string copyPath = tempFile("copy.raw");
+    ASSERT_TRUE(MappedImageIO::saveRaw(wide, copyPath));
+    auto copy = MappedImageIO::map(copyPath);
+    ASSERT_TRUE(copy);
+    EXPECT_TRUE(samePixels(*copy.value(), wide));
+}
+
+TEST_F(MappedImageTest, FiltersRunOnMappedImages) {
+    const std::string path = tempFile("filter.ppm");
+    ColorImage image = makeGradient(48, 32);
+    ASSERT_TRUE(PPMImageIO::save(image, path));
+
+    auto mapped = MappedImageIO::map(path);
+    ASSERT_TRUE(mapped);
+
+    auto expected = GaussianBlurFilter(1.0f, 5).apply(image);
+    auto actual = GaussianBlurFilter(1.0f, 5).apply(*mapped.value());
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(actual);
+    EXPECT_TRUE(samePixels(*actual.value(), *expected.value()));
+}
+
+TEST_F(MappedImageTest, RejectsUnmappableFiles) {
+    const std::string bmpPath = tempFile("image.bmp");
+    ASSERT_TRUE(BMPImageIO::save(makeGradient(4, 4), bmpPath));
+    auto bmp = MappedImageIO::map(bmpPath);
+    ASSERT_FALSE(bmp);
+    EXPECT_EQ(bmp.error().code(), ErrorCode::UnsupportedFormat);
+
+    const std::string truncatedPath = tempFile("truncated.ppm");
+    std::ofstream(truncatedPath, std::ios::binary) << "P6\n10 10\n255\nabc";
+    EXPECT_FALSE(MappedImageIO::map(truncatedPath));
+
+    auto missing = MappedImageIO::map(tempFile("missing.ppm"));
+    ASSERT_FALSE(missing);
+    EXPECT_EQ(missing.error().code(), ErrorCode::FileNotFound);
+
+    EXPECT_FALSE(MappedImageIO::create(tempFile("binary.raw"), 8, 8, Image::Type::Binary));
+}
+
+TEST_F(MappedImageTest, RejectsMisalignedPixelData) {
+    // A raw float file whose header moves the pixels off the page boundary;
+    // the file is long enough for the moved rows, so only the offset is wrong
+    const std::string path = tempFile("misaligned.raw");
+    ASSERT_TRUE(MappedImageIO::create(path, 16, 4, Image::Type::Grayscale, Image::Depth::Float32,
+                                      Image::RowLayout::Aligned));
+    std::ofstream(path, std::ios::binary | std::ios::app) << std::string(128, '\0');
+
+    for (const uint32_t offset : {4097u, 4100u, 4160u}) {
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(12);  // data offset, after magic and version
+            file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+        auto mapped = MappedImageIO::map(path);
+        ASSERT_FALSE(mapped) << "offset " << offset;
+        EXPECT_EQ(mapped.error().code(), ErrorCode::CorruptedData);
+    }
+}
+
+TEST_F(MappedImageTest, RejectsGeometryOverflowingTheAddressSpace) {
+    // A valid 1x1 file whose header then claims a 2^30 x 2^30 RGBA float
+    // image: stride * height is 2^64 bytes, which wraps to 0 in size_t
+    const std::string path = tempFile("overflow.raw");
+    ASSERT_TRUE(MappedImageIO::create(path, 1, 1, Image::Type::RGBA, Image::Depth::Float32));
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const int32_t side = 1 << 30;
+        const uint64_t stride = uint64_t{1} << 34;
+        file.seekp(16);  // width and height follow magic, version and data offset
+        file.write(reinterpret_cast<const char*>(&side), sizeof(side));
+        file.write(reinterpret_cast<const char*>(&side), sizeof(side));
+        file.seekp(32);  // stride, after the type bytes
+        file.write(reinterpret_cast<const char*>(&stride), sizeof(stride));
+    }
+    auto mapped = MappedImageIO::map(path);
+    ASSERT_FALSE(mapped);
+    EXPECT_EQ(mapped.error().code(), ErrorCode::CorruptedData);
+
+    // The image constructor refuses the geometry whatever the buffer
+    auto wrapped = ImageFactory::wrap(1 << 30, 1 << 30, Image::Type::RGBA, Image::Depth::Float32,
+                                      Image::RowLayout::Packed, PixelBuffer(64));
+    ASSERT_FALSE(wrapped);
+    EXPECT_EQ(wrapped.error().code(), ErrorCode::CorruptedData);
+    EXPECT_THROW(RGBAFloatImage(1 << 30, 1 << 30), std::overflow_error);
+}
+
+TEST_F(MappedImageTest, MappedAllocatorBacksLargeBuffers) {
+    auto allocator = std::make_shared<MappedImageAllocator>(std::filesystem::path{}, 4096);
+    ImageAllocator::setDefault(allocator);
+
+    GrayscaleImage large(128, 128);
+    GrayscaleImage small(8, 8);
+    EXPECT_EQ(large.getPixel(127, 127).value(), 0);
+    ASSERT_TRUE(large.setPixel(127, 127, 42));
+    EXPECT_EQ(large.getPixel(127, 127).value(), 42);
+
+    auto blurred = GaussianBlurFilter(1.0f).apply(large);
+    ImageAllocator::setDefault(nullptr);
+
+    ASSERT_TRUE(blurred);
+    EXPECT_GT(static_cast<GrayscaleImage&>(*blurred.value()).getPixel(127, 127).value(), 0);
+    EXPECT_EQ(small.getPixel(0, 0).value(), 0);
+}
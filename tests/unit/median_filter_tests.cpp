@@ -5,6 +5,9 @@
 #include <gtest/gtest.h>
 #include <DIPAL/DIPAL.hpp>
 
+#include <algorithm>
+#include <random>
+#include <vector>
 
 using namespace DIPAL;
 
@@ -38,9 +41,131 @@ TEST_F(MedianFilterTest, DefaultConstruction) {
 }
 
 TEST_F(MedianFilterTest, BasicOperations) {
-    // Test basic operations
-    // TODO: Implement basic operations test
-    EXPECT_TRUE(true) << "Basic operations test not implemented";
+    // An isolated outlier is removed in every channel, alpha included
+    auto result = ImageFactory::createColor(9, 9, true, Image::RowLayout::Aligned);
+    ASSERT_TRUE(result);
+    auto& image = *result.value();
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 9; ++x) {
+            ASSERT_TRUE(image.setPixel(x, y, 10, 20, 30, 200));
+        }
+    }
+    ASSERT_TRUE(image.setPixel(4, 4, 255, 0, 255, 0));
+
+    MedianFilter filter(3);
+    auto filtered = filter.apply(image);
+    ASSERT_TRUE(filtered);
+    ASSERT_EQ(filtered.value()->getType(), Image::Type::RGBA);
+    EXPECT_EQ(filtered.value()->getRowLayout(), Image::RowLayout::Aligned);
+
+    const PixelAccessor<uint8_t> pixels(*filtered.value());
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 9; ++x) {
+            EXPECT_EQ(pixels(x, y, 0), 10);
+            EXPECT_EQ(pixels(x, y, 1), 20);
+            EXPECT_EQ(pixels(x, y, 2), 30);
+            EXPECT_EQ(pixels(x, y, 3), 200);
+        }
+    }
+}
+
+namespace {
+
+// Median of every channel over a square window with replicated borders
+template <typename T>
+std::vector<T> referenceMedian(const Image& image, int kernelSize) {
+    const PixelAccessor<T> src(image);
+    const int width = src.width();
+    const int height = src.height();
+    const int channels = src.channels();
+    const int radius = kernelSize / 2;
+    std::vector<T> result(static_cast<size_t>(width) * height * channels);
+    std::vector<T> window;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            for (int c = 0; c < channels; ++c) {
+                window.clear();
+                for (int j = -radius; j <= radius; ++j) {
+                    for (int i = -radius; i <= radius; ++i) {
+                        window.push_back(src.clampedRow(y + j)[std::clamp(x + i, 0, width - 1) * channels + c]);
+                    }
+                }
+                std::sort(window.begin(), window.end());
+                result[(static_cast<size_t>(y) * width + x) * channels + c] = window[window.size() / 2];
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T>
+void expectMatchesReference(const Image& image, int kernelSize) {
+    auto filtered = MedianFilter(kernelSize).apply(image);
+    ASSERT_TRUE(filtered) << filtered.error().toString();
+    const auto expected = referenceMedian<T>(image, kernelSize);
+    const PixelAccessor<T> actual(*filtered.value());
+    const int samples = image.getWidth() * actual.channels();
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < samples; ++x) {
+            ASSERT_EQ(actual.row(y)[x], expected[static_cast<size_t>(y) * samples + x])
+                << "kernel " << kernelSize << ", sample " << x << " of row " << y;
+        }
+    }
+}
+
+// Noise over a few levels, so that medians often fall on ties and bin edges
+template <typename T, int Channels>
+TypedImage<T, Channels> makeNoisyImage(int width, int height, int levels, unsigned seed) {
+    TypedImage<T, Channels> image(width, height);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> level(0, levels - 1);
+    const double step = static_cast<double>(SampleTraits<T>::maxValue) / (levels - 1);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width * Channels; ++x) {
+            image.row(y)[x] = static_cast<T>(level(rng) * step);
+        }
+    }
+    return image;
+}
+
+}  // namespace
+
+TEST_F(MedianFilterTest, HistogramMedianMatchesSorting) {
+    for (int kernelSize : {7, 9, 15, 31}) {
+        expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 1>(37, 29, 256, 1), kernelSize);
+        expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 1>(20, 11, 18, 2), kernelSize);
+        expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 3>(13, 17, 256, 3), kernelSize);
+    }
+    // Kernels wider than the image
+    expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 1>(1, 9, 256, 4), 7);
+    expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 4>(5, 2, 256, 5), 21);
+}
+
+TEST_F(MedianFilterTest, SelectionNetworksMatchSorting) {
+    for (int kernelSize : {3, 5}) {
+        // Widths below, at and past the vector width, with ragged tails
+        for (int width : {1, 2, 3, 4, 5, 6, 17, 40, 71}) {
+            const auto seed = static_cast<unsigned>(width * 10 + kernelSize);
+            expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 1>(width, 9, 256, seed), kernelSize);
+            expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 3>(width, 7, 12, seed + 1), kernelSize);
+            expectMatchesReference<uint16_t>(makeNoisyImage<uint16_t, 1>(width, 8, 65536, seed + 2),
+                                             kernelSize);
+            expectMatchesReference<uint16_t>(makeNoisyImage<uint16_t, 4>(width, 6, 300, seed + 3),
+                                             kernelSize);
+            expectMatchesReference<float>(makeNoisyImage<float, 3>(width, 5, 1000, seed + 4), kernelSize);
+        }
+    }
+    // Fewer rows than the kernel
+    expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 4>(50, 1, 256, 10), 5);
+    expectMatchesReference<float>(makeNoisyImage<float, 1>(50, 2, 256, 11), 5);
+}
+
+TEST_F(MedianFilterTest, ParallelStripsMatchSorting) {
+    // Large enough to be split into strips
+    expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 1>(300, 260, 256, 6), 9);
+    expectMatchesReference<uint8_t>(makeNoisyImage<uint8_t, 3>(260, 257, 40, 7), 7);
+    expectMatchesReference<uint16_t>(makeNoisyImage<uint16_t, 1>(290, 240, 1000, 8), 5);
+    expectMatchesReference<float>(makeNoisyImage<float, 1>(270, 250, 100, 9), 7);
 }
 
 // ============================================================================
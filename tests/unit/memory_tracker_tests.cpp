@@ -0,0 +1,139 @@
+// tests/unit/memory_tracker_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace DIPAL;
+
+namespace {
+
+std::size_t currentBytes(MemoryCategory category) {
+    return MemoryTracker::getUsage(category).current;
+}
+
+}  // namespace
+
+TEST(MemoryTrackerTest, ImagesAreCountedUntilReleased) {
+    const std::size_t before = currentBytes(MemoryCategory::Images);
+    const std::size_t totalBefore = Core::getMemoryUsage();
+
+    {
+        GrayscaleImage image(100, 50, Image::RowLayout::Packed);
+        EXPECT_EQ(currentBytes(MemoryCategory::Images), before + 5000);
+        EXPECT_EQ(Core::getMemoryUsage(), totalBefore + 5000);
+        EXPECT_GE(Core::getPeakMemoryUsage(), totalBefore + 5000);
+
+        // Copies share the buffer until one of them is written
+        GrayscaleImage copy = image;
+        EXPECT_EQ(currentBytes(MemoryCategory::Images), before + 5000);
+        ASSERT_TRUE(copy.setPixel(0, 0, 1));
+        EXPECT_EQ(currentBytes(MemoryCategory::Images), before + 10000);
+    }
+
+    EXPECT_EQ(currentBytes(MemoryCategory::Images), before);
+    EXPECT_EQ(Core::getMemoryUsage(), totalBefore);
+    EXPECT_GE(MemoryTracker::getUsage(MemoryCategory::Images).peak, before + 10000);
+
+    Core::resetPeakMemoryUsage();
+    EXPECT_EQ(Core::getPeakMemoryUsage(), Core::getMemoryUsage());
+    EXPECT_EQ(MemoryTracker::getUsage(MemoryCategory::Images).peak, before);
+}
+
+TEST(MemoryTrackerTest, ScopesAttributeAndNest) {
+    EXPECT_EQ(MemoryTracker::currentCategory(), MemoryCategory::Images);
+    const std::size_t images = currentBytes(MemoryCategory::Images);
+    const std::size_t temporaries = currentBytes(MemoryCategory::FilterTemporaries);
+
+    {
+        MemoryTracker::Scope scratch(MemoryCategory::FilterTemporaries);
+        GrayscaleImage temp(64, 4, Image::RowLayout::Packed);
+        EXPECT_EQ(currentBytes(MemoryCategory::FilterTemporaries), temporaries + 256);
+        EXPECT_EQ(currentBytes(MemoryCategory::Images), images);
+
+        {
+            MemoryTracker::Scope io(MemoryCategory::IOBuffers);
+            EXPECT_EQ(MemoryTracker::currentCategory(), MemoryCategory::IOBuffers);
+        }
+        EXPECT_EQ(MemoryTracker::currentCategory(), MemoryCategory::FilterTemporaries);
+    }
+
+    EXPECT_EQ(MemoryTracker::currentCategory(), MemoryCategory::Images);
+    EXPECT_EQ(currentBytes(MemoryCategory::FilterTemporaries), temporaries);
+}
+
+TEST(MemoryTrackerTest, TrackedVectorsUseTheirCategory) {
+    const std::size_t temporaries = currentBytes(MemoryCategory::FilterTemporaries);
+    const std::size_t io = currentBytes(MemoryCategory::IOBuffers);
+
+    {
+        TemporaryBuffer<float> sums(1000);
+        IOBuffer<uint8_t> row(300);
+        EXPECT_EQ(currentBytes(MemoryCategory::FilterTemporaries), temporaries + 4000);
+        EXPECT_EQ(currentBytes(MemoryCategory::IOBuffers), io + 300);
+    }
+
+    EXPECT_EQ(currentBytes(MemoryCategory::FilterTemporaries), temporaries);
+    EXPECT_EQ(currentBytes(MemoryCategory::IOBuffers), io);
+    EXPECT_EQ(MemoryTracker::categoryName(MemoryCategory::IOBuffers), "IOBuffers");
+}
+
+TEST(MemoryTrackerTest, PoolCacheFollowsIdleBuffers) {
+    const std::size_t cached = currentBytes(MemoryCategory::PoolCache);
+    auto pool = std::make_shared<PooledImageAllocator>();
+    ImageAllocator::setDefault(pool);
+
+    {
+        GrayscaleImage image(256, 16, Image::RowLayout::Packed);
+        EXPECT_EQ(currentBytes(MemoryCategory::PoolCache), cached);
+    }
+    const std::size_t idle = pool->getStatistics().cachedBytes;
+    EXPECT_GT(idle, 0u);
+    EXPECT_EQ(currentBytes(MemoryCategory::PoolCache), cached + idle);
+
+    {
+        // Reusing the cached buffer moves it back to Images
+        GrayscaleImage reused(256, 16, Image::RowLayout::Packed);
+        EXPECT_EQ(currentBytes(MemoryCategory::PoolCache), cached);
+    }
+
+    pool->trim();
+    EXPECT_EQ(currentBytes(MemoryCategory::PoolCache), cached);
+    ImageAllocator::setDefault(nullptr);
+}
+
+TEST(MemoryTrackerTest, FilterTemporariesAreReleased) {
+    ColorImage image(64, 48);
+    const std::size_t temporaries = currentBytes(MemoryCategory::FilterTemporaries);
+    const std::size_t images = currentBytes(MemoryCategory::Images);
+    Core::resetPeakMemoryUsage();
+
+    auto blurred = GaussianBlurFilter(1.5f, 5).apply(image);
+    ASSERT_TRUE(blurred);
+
+    EXPECT_GT(MemoryTracker::getUsage(MemoryCategory::FilterTemporaries).peak, temporaries);
+    EXPECT_EQ(currentBytes(MemoryCategory::FilterTemporaries), temporaries);
+    EXPECT_EQ(currentBytes(MemoryCategory::Images), images + blurred.value()->getDataSize());
+}
+
+TEST(MemoryTrackerTest, ConcurrentAllocationsBalance) {
+    const std::size_t before = Core::getMemoryUsage();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 200; ++i) {
+                GrayscaleImage image(32 + i % 7, 16);
+                TemporaryBuffer<int> scratch(64);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(Core::getMemoryUsage(), before);
+}
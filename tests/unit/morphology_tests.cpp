@@ -0,0 +1,219 @@
+// tests/unit/morphology_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+// Reference: a pixel outside the image reads as `outside`
+bool pixelOr(const BinaryImage& image, int x, int y, bool outside) {
+    if (x < 0 || y < 0 || x >= image.getWidth() || y >= image.getHeight()) {
+        return outside;
+    }
+    return image.getPixel(x, y).value();
+}
+
+bool referenceErode(const BinaryImage& image, const StructuringElement& se, int x, int y) {
+    const Point anchor = se.getAnchor();
+    for (int j = 0; j < se.getHeight(); ++j) {
+        for (int i = 0; i < se.getWidth(); ++i) {
+            if (se.contains(i, j) && !pixelOr(image, x + i - anchor.x, y + j - anchor.y, true)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool referenceDilate(const BinaryImage& image, const StructuringElement& se, int x, int y) {
+    const Point anchor = se.getAnchor();
+    for (int j = 0; j < se.getHeight(); ++j) {
+        for (int i = 0; i < se.getWidth(); ++i) {
+            if (se.contains(i, j) && pixelOr(image, x - (i - anchor.x), y - (j - anchor.y), false)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void expectSameImages(const BinaryImage& actual, const BinaryImage& expected, const char* what) {
+    ASSERT_EQ(actual.getWidth(), expected.getWidth());
+    ASSERT_EQ(actual.getHeight(), expected.getHeight());
+    for (int y = 0; y < expected.getHeight(); ++y) {
+        for (int x = 0; x < expected.getWidth(); ++x) {
+            ASSERT_EQ(actual.getPixel(x, y).value(), expected.getPixel(x, y).value())
+                << what << " at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+}  // namespace
+
+TEST(MorphologyTest, StructuringElementShapes) {
+    auto square = StructuringElement::rectangle(3, 3);
+    EXPECT_TRUE(square.isRectangle());
+    EXPECT_EQ(square.getMemberCount(), 9);
+    EXPECT_EQ(square.getAnchor(), Point(1, 1));
+
+    auto cross = StructuringElement::cross(5);
+    EXPECT_FALSE(cross.isRectangle());
+    EXPECT_EQ(cross.getMemberCount(), 9);
+    EXPECT_EQ(cross.getRuns().size(), 5u);
+
+    auto diamond = StructuringElement::diamond(2);
+    EXPECT_EQ(diamond.getMemberCount(), 13);
+    EXPECT_TRUE(StructuringElement::ellipse(7, 5).contains(3, 2));
+    EXPECT_FALSE(StructuringElement::ellipse(7, 5).contains(0, 0));
+
+    StructuringElement corner(2, 2, {1, 1, 0, 1}, Point(0, 0));
+    auto mirrored = corner.reflected();
+    EXPECT_EQ(mirrored.getAnchor(), Point(1, 1));
+    EXPECT_TRUE(mirrored.contains(0, 0));
+    EXPECT_FALSE(mirrored.contains(1, 0));
+
+    EXPECT_THROW(StructuringElement(2, 2, {0, 0, 0, 0}), std::invalid_argument);
+    EXPECT_THROW(StructuringElement(2, 2, {1, 1, 1}), std::invalid_argument);
+    EXPECT_THROW(StructuringElement(2, 2, {1, 1, 1, 1}, Point(2, 0)), std::invalid_argument);
+    EXPECT_THROW(StructuringElement::rectangle(0, 3), std::invalid_argument);
+}
+
+TEST(MorphologyTest, ErodeAndDilateMatchReference) {
+    const std::vector<StructuringElement> elements = {
+        StructuringElement::rectangle(3, 3),
+        StructuringElement::rectangle(9, 2),
+        StructuringElement::cross(5),
+        StructuringElement::ellipse(7, 5),
+        StructuringElement(3, 2, {1, 0, 1, 0, 1, 1}, Point(2, 1)),  // anchor off the members
+        StructuringElement(1, 1, {1}),
+    };
+
+    unsigned seed = 1;
+    for (int width : {1, 13, 63, 64, 65, 130}) {
+        const BinaryImage image = makeRandomImage(width, 11, 0.6, seed++);
+        for (const auto& se : elements) {
+            auto eroded = Morphology::erode(image, se);
+            auto dilated = Morphology::dilate(image, se);
+            ASSERT_TRUE(eroded);
+            ASSERT_TRUE(dilated);
+            for (int y = 0; y < image.getHeight(); ++y) {
+                for (int x = 0; x < width; ++x) {
+                    ASSERT_EQ(eroded.value()->getPixel(x, y).value(),
+                              referenceErode(image, se, x, y))
+                        << "erode width " << width << " at (" << x << ", " << y << ")";
+                    ASSERT_EQ(dilated.value()->getPixel(x, y).value(),
+                              referenceDilate(image, se, x, y))
+                        << "dilate width " << width << " at (" << x << ", " << y << ")";
+                }
+            }
+        }
+    }
+}
+
+TEST(MorphologyTest, LargeRectanglesMatchPointwiseDefinition) {
+    // Wider than a word and taller than the image: exercises the decomposition
+    const BinaryImage image = makeRandomImage(200, 40, 0.97, 7, Image::RowLayout::Aligned);
+    const auto se = StructuringElement::rectangle(75, 45);
+    auto eroded = Morphology::erode(image, se);
+    auto dilated = Morphology::dilate(makeRandomImage(200, 40, 0.001, 8), se);
+    ASSERT_TRUE(eroded);
+    ASSERT_TRUE(dilated);
+    EXPECT_EQ(eroded.value()->getRowLayout(), Image::RowLayout::Aligned);
+
+    for (int y = 0; y < 40; y += 3) {
+        for (int x = 0; x < 200; ++x) {
+            ASSERT_EQ(eroded.value()->getPixel(x, y).value(), referenceErode(image, se, x, y))
+                << "at (" << x << ", " << y << ")";
+        }
+    }
+    const BinaryImage sparse = makeRandomImage(200, 40, 0.001, 8);
+    for (int y = 0; y < 40; y += 3) {
+        for (int x = 0; x < 200; ++x) {
+            ASSERT_EQ(dilated.value()->getPixel(x, y).value(), referenceDilate(sparse, se, x, y))
+                << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+TEST(MorphologyTest, OpeningAndClosingAreComposites) {
+    const BinaryImage image = makeRandomImage(97, 23, 0.5, 3);
+    const auto se = StructuringElement::ellipse(5, 5);
+
+    auto eroded = Morphology::erode(image, se);
+    ASSERT_TRUE(eroded);
+    auto expectedOpen = Morphology::dilate(*eroded.value(), se);
+    auto dilated = Morphology::dilate(image, se);
+    ASSERT_TRUE(dilated);
+    auto expectedClose = Morphology::erode(*dilated.value(), se);
+    ASSERT_TRUE(expectedOpen);
+    ASSERT_TRUE(expectedClose);
+
+    auto opened = Morphology::open(image, se);
+    auto closed = Morphology::close(image, se);
+    ASSERT_TRUE(opened);
+    ASSERT_TRUE(closed);
+    expectSameImages(*opened.value(), *expectedOpen.value(), "open");
+    expectSameImages(*closed.value(), *expectedClose.value(), "close");
+
+    // Opening is anti-extensive, closing extensive; the top-hats are the differences
+    auto topHat = Morphology::topHat(image, se);
+    auto blackTopHat = Morphology::blackTopHat(image, se);
+    ASSERT_TRUE(topHat);
+    ASSERT_TRUE(blackTopHat);
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            const bool original = image.getPixel(x, y).value();
+            const bool open = opened.value()->getPixel(x, y).value();
+            const bool close = closed.value()->getPixel(x, y).value();
+            EXPECT_TRUE(!open || original);
+            EXPECT_TRUE(!original || close);
+            ASSERT_EQ(topHat.value()->getPixel(x, y).value(), original && !open);
+            ASSERT_EQ(blackTopHat.value()->getPixel(x, y).value(), close && !original);
+        }
+    }
+}
+
+TEST(MorphologyTest, HitOrMissFindsIsolatedPixels) {
+    BinaryImage image(70, 5);
+    ASSERT_TRUE(image.setPixel(10, 2, true));  // isolated
+    ASSERT_TRUE(image.setPixel(66, 2, true));  // isolated, in the second word
+    ASSERT_TRUE(image.setPixel(30, 2, true));  // has a neighbour
+    ASSERT_TRUE(image.setPixel(31, 2, true));
+    ASSERT_TRUE(image.setPixel(0, 0, true));   // isolated at the corner; outside is background
+
+    const StructuringElement centre(3, 3, {0, 0, 0, 0, 1, 0, 0, 0, 0});
+    const StructuringElement ring(3, 3, {1, 1, 1, 1, 0, 1, 1, 1, 1});
+    auto matches = Morphology::hitOrMiss(image, centre, ring);
+    ASSERT_TRUE(matches);
+
+    EXPECT_EQ(matches.value()->countWhitePixels(), 3u);
+    EXPECT_TRUE(matches.value()->getPixel(10, 2).value());
+    EXPECT_TRUE(matches.value()->getPixel(66, 2).value());
+    EXPECT_TRUE(matches.value()->getPixel(0, 0).value());
+    EXPECT_FALSE(matches.value()->getPixel(30, 2).value());
+}
+
+TEST(MorphologyTest, BordersDoNotErodeOrLeakBits) {
+    BinaryImage full(67, 4);
+    ASSERT_TRUE(full.fill(true));
+    auto eroded = Morphology::erode(full, StructuringElement::rectangle(5, 5));
+    ASSERT_TRUE(eroded);
+    EXPECT_EQ(eroded.value()->countWhitePixels(), 67u * 4u);
+
+    BinaryImage empty(67, 4);
+    auto dilated = Morphology::dilate(empty, StructuringElement::rectangle(5, 5));
+    ASSERT_TRUE(dilated);
+    EXPECT_EQ(dilated.value()->countWhitePixels(), 0u);
+
+    // Bits past the width stay clear
+    auto closed = Morphology::close(full, StructuringElement::cross(3));
+    ASSERT_TRUE(closed);
+    EXPECT_EQ(closed.value()->getRow(3).back() & 0xF8, 0);
+}
@@ -38,9 +38,33 @@ TEST_F(ParallelProcessorTest, DefaultConstruction) {
 }
 
 TEST_F(ParallelProcessorTest, BasicOperations) {
-    // Test basic operations
-    // TODO: Implement basic operations test
-    EXPECT_TRUE(true) << "Basic operations test not implemented";
+    // Large enough to be split into strips (at least kParallelPixels)
+    auto result = ImageFactory::createColor(640, 420, false, Image::RowLayout::Aligned);
+    ASSERT_TRUE(result);
+    auto& image = *result.value();
+    for (int y = 0; y < image.getHeight(); ++y) {
+        auto row = image.getRow(y);
+        std::fill(row.begin(), row.end(), uint8_t{90});
+    }
+
+    ParallelProcessor processor(4);
+
+    auto blurred = processor.applyFilter(image, GaussianBlurFilter(1.0f));
+    ASSERT_TRUE(blurred) << blurred.error().toString();
+    ASSERT_EQ(blurred.value()->getType(), Image::Type::RGB);
+    EXPECT_EQ(blurred.value()->getRowLayout(), Image::RowLayout::Aligned);
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (uint8_t v : blurred.value()->getRow(y)) {
+            ASSERT_NEAR(v, 90, 1) << "row " << y;
+        }
+    }
+
+    // Filters that change the pixel type are stitched into an image of the new type
+    auto edges = processor.applyFilter(image, SobelFilter());
+    ASSERT_TRUE(edges) << edges.error().toString();
+    EXPECT_EQ(edges.value()->getType(), Image::Type::Grayscale);
+    EXPECT_EQ(edges.value()->getWidth(), 640);
+    EXPECT_EQ(edges.value()->getHeight(), 420);
 }
 
 // ============================================================================
@@ -48,9 +72,13 @@ TEST_F(ParallelProcessorTest, BasicOperations) {
 // ============================================================================
 
 TEST_F(ParallelProcessorTest, ErrorHandling) {
-    // Test error conditions and edge cases
-    // TODO: Implement error handling tests
-    EXPECT_TRUE(true) << "Error handling test not implemented";
+    // An empty (moved-from) image is rejected before any strip is planned
+    GrayscaleImage image(640, 420);
+    const GrayscaleImage moved(std::move(image));
+    ParallelProcessor processor(4);
+    auto result = processor.applyFilter(image, GaussianBlurFilter(1.0f));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), ErrorCode::InvalidParameter);
 }
 
 // ============================================================================
@@ -0,0 +1,151 @@
+// tests/unit/planar_image_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace DIPAL;
+
+namespace {
+
+uint8_t pattern(int x, int y, int c) {
+    return static_cast<uint8_t>(x * 7 + y * 13 + c * 61);
+}
+
+ColorImage makePatternImage(int width, int height, bool hasAlpha, Image::RowLayout layout) {
+    ColorImage image(width, height, hasAlpha, layout);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            EXPECT_TRUE(image.setPixel(x, y, pattern(x, y, 0), pattern(x, y, 1), pattern(x, y, 2),
+                                       pattern(x, y, 3)));
+        }
+    }
+    return image;
+}
+
+}  // namespace
+
+TEST(PlanarImageTest, RowKernelsMatchScalarLayout) {
+    // Lengths around the 16-pixel vector blocks exercise the scalar tails
+    for (int channels : {3, 4}) {
+        for (std::size_t pixels : {1u, 15u, 16u, 17u, 48u, 61u}) {
+            std::vector<uint8_t> interleaved(pixels * channels);
+            for (std::size_t i = 0; i < interleaved.size(); ++i) {
+                interleaved[i] = static_cast<uint8_t>(i * 37 + 5);
+            }
+
+            std::vector<std::vector<uint8_t>> planes(channels, std::vector<uint8_t>(pixels));
+            uint8_t* planePtrs[4] = {};
+            for (int c = 0; c < channels; ++c) {
+                planePtrs[c] = planes[c].data();
+            }
+            PlanarImage::deinterleaveRow(interleaved.data(), planePtrs, channels, pixels);
+
+            for (std::size_t x = 0; x < pixels; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    ASSERT_EQ(planes[c][x], interleaved[x * channels + c])
+                        << channels << " channels, " << pixels << " pixels, x=" << x;
+                }
+            }
+
+            std::vector<uint8_t> merged(interleaved.size(), 0);
+            const uint8_t* constPlanes[4] = {planePtrs[0], planePtrs[1], planePtrs[2], planePtrs[3]};
+            PlanarImage::interleaveRow(constPlanes, merged.data(), channels, pixels);
+            EXPECT_EQ(merged, interleaved) << channels << " channels, " << pixels << " pixels";
+        }
+    }
+}
+
+TEST(PlanarImageTest, RoundTripKeepsPixels) {
+    for (bool hasAlpha : {false, true}) {
+        for (auto layout : {Image::RowLayout::Packed, Image::RowLayout::Aligned}) {
+            ColorImage image = makePatternImage(37, 5, hasAlpha, layout);
+
+            auto planar = image.toPlanar();
+            ASSERT_TRUE(planar);
+            ASSERT_EQ(planar.value()->getChannels(), hasAlpha ? 4 : 3);
+            EXPECT_EQ(planar.value()->getType(), image.getType());
+            EXPECT_EQ(planar.value()->getPlane(0).getRowLayout(), Image::RowLayout::Aligned);
+            EXPECT_EQ(planar.value()->getPlane(2).getPixel(36, 4).value(), pattern(36, 4, 2));
+
+            auto restored = planar.value()->toColorImage(layout);
+            ASSERT_TRUE(restored);
+            for (int y = 0; y < image.getHeight(); ++y) {
+                auto expected = image.getRow(y);
+                auto actual = std::as_const(*restored.value()).getRow(y);
+                ASSERT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()))
+                    << "row " << y;
+            }
+        }
+    }
+}
+
+TEST(PlanarImageTest, SplitsCroppedViews) {
+    ColorImage image = makePatternImage(40, 10, false, Image::RowLayout::Packed);
+    auto roi = image.view().crop(Rect(5, 3, 20, 4));
+    ASSERT_TRUE(roi);
+
+    auto planar = PlanarImage::fromInterleaved(*roi);
+    ASSERT_TRUE(planar);
+    EXPECT_EQ(planar.value()->getWidth(), 20);
+    EXPECT_EQ(planar.value()->getHeight(), 4);
+    EXPECT_EQ(planar.value()->getPlane(1).getPixel(0, 0).value(), pattern(5, 3, 1));
+    EXPECT_EQ(planar.value()->getPlane(0).getPixel(19, 3).value(), pattern(24, 6, 0));
+}
+
+TEST(PlanarImageTest, RejectsMismatchedImages) {
+    GrayscaleImage gray(4, 4);
+    EXPECT_FALSE(PlanarImage::fromInterleaved(gray.view()));
+
+    RGB16Image wide(4, 4);
+    EXPECT_FALSE(PlanarImage::fromInterleaved(wide.view()));
+
+    PlanarImage planar(4, 4);
+    ColorImage larger(5, 4);
+    EXPECT_FALSE(planar.toInterleaved(larger.mutableView()));
+    ColorImage withAlpha(4, 4, true);
+    EXPECT_FALSE(planar.toInterleaved(withAlpha.mutableView()));
+
+    EXPECT_THROW(PlanarImage(0, 4), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(planar.getPlane(3)), std::out_of_range);
+}
+
+TEST(PlanarImageTest, ColorFiltersMatchPerChannelGrayscale) {
+    ColorImage image = makePatternImage(29, 23, true, Image::RowLayout::Aligned);
+
+    auto blurred = GaussianBlurFilter(1.5f, 5).apply(image);
+    auto median = MedianFilter(3).apply(image);
+    ASSERT_TRUE(blurred);
+    ASSERT_TRUE(median);
+    EXPECT_EQ(blurred.value()->getRowLayout(), Image::RowLayout::Aligned);
+
+    const auto& blurredColor = static_cast<const ColorImage&>(*blurred.value());
+    const auto& medianColor = static_cast<const ColorImage&>(*median.value());
+
+    for (int c = 0; c < 4; ++c) {
+        auto channel = image.getChannel(c);
+        ASSERT_TRUE(channel);
+        auto channelBlurred = GaussianBlurFilter(1.5f, 5).apply(*channel.value());
+        auto channelMedian = MedianFilter(3).apply(*channel.value());
+        ASSERT_TRUE(channelBlurred);
+        ASSERT_TRUE(channelMedian);
+
+        auto expectedBlur = blurredColor.getChannel(c);
+        auto expectedMedian = medianColor.getChannel(c);
+        ASSERT_TRUE(expectedBlur);
+        ASSERT_TRUE(expectedMedian);
+
+        for (int y = 0; y < image.getHeight(); ++y) {
+            for (int x = 0; x < image.getWidth(); ++x) {
+                const auto& blurGray = static_cast<const GrayscaleImage&>(*channelBlurred.value());
+                const auto& medianGray = static_cast<const GrayscaleImage&>(*channelMedian.value());
+                ASSERT_EQ(expectedBlur.value()->getPixel(x, y).value(),
+                          blurGray.getPixel(x, y).value());
+                ASSERT_EQ(expectedMedian.value()->getPixel(x, y).value(),
+                          medianGray.getPixel(x, y).value());
+            }
+        }
+    }
+}
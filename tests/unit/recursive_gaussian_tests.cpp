@@ -0,0 +1,209 @@
+// tests/unit/recursive_gaussian_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace DIPAL;
+
+namespace {
+
+using Gray8Image = TypedImage<uint8_t, 1>;
+using RGB8Image = TypedImage<uint8_t, 3>;
+
+// Uniform noise with a saturated band on the left: both the worst case for
+// the recursive approximation and a strong edge near a border
+template <typename ImageT>
+ImageT makeTestImage(int width, int height, unsigned seed) {
+    using T = typename ImageT::Sample;
+    constexpr auto kMax = static_cast<float>(SampleTraits<T>::maxValue);
+    ImageT image(width, height);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> value(0.0f, kMax);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width * ImageT::kChannels; ++x) {
+            image.row(y)[x] = static_cast<T>(x < width / 4 * ImageT::kChannels ? kMax : value(rng));
+        }
+    }
+    return image;
+}
+
+// Largest difference from the FIR blur over +-4 sigma, as a fraction of the full range
+template <typename ImageT>
+double maxRelativeError(float sigma, int width, int height) {
+    const ImageT image = makeTestImage<ImageT>(width, height, 11u);
+    const int size = 2 * static_cast<int>(std::ceil(4.0f * sigma)) + 1;
+    auto fir = GaussianBlurFilter(sigma, size, GaussianBlurFilter::Method::FIR).apply(image);
+    auto iir = RecursiveGaussian(sigma).apply(image);
+    EXPECT_TRUE(fir && iir);
+    const PixelAccessor<typename ImageT::Sample> expected(fir.value()->view());
+    const PixelAccessor<typename ImageT::Sample> actual(iir.value()->view());
+
+    double worst = 0;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width * ImageT::kChannels; ++x) {
+            worst = std::max(worst, std::abs(static_cast<double>(expected.row(y)[x]) -
+                                             static_cast<double>(actual.row(y)[x])));
+        }
+    }
+    return worst / SampleTraits<typename ImageT::Sample>::maxValue;
+}
+
+// Largest difference between a tile in the middle of the image, blurred
+// with getRadius() pixels of context, and the same pixels of a whole-image blur
+template <typename ImageT>
+double maxTileDifference(const RecursiveGaussian& gaussian, int width, int height) {
+    using T = typename ImageT::Sample;
+    constexpr int kChannels = ImageT::kChannels;
+    const ImageT image = makeTestImage<ImageT>(width, height, 9u);
+    auto whole = gaussian.apply(image);
+    EXPECT_TRUE(whole);
+
+    const int radius = gaussian.getRadius();
+    const Rect tile(radius + 20, radius + 10, width - 2 * radius - 40, height - 2 * radius - 20);
+    auto source = image.view().crop(Rect(tile.x - radius, tile.y - radius,
+                                         tile.width + 2 * radius, tile.height + 2 * radius));
+    EXPECT_TRUE(source);
+    ImageT blurred(tile.width, tile.height);
+    EXPECT_TRUE(gaussian.apply(source.value(), Rect(radius, radius, tile.width, tile.height),
+                               blurred.mutableView()));
+
+    const PixelAccessor<T> expected(whole.value()->view());
+    double worst = 0;
+    for (int y = 0; y < tile.height; ++y) {
+        for (int x = 0; x < tile.width * kChannels; ++x) {
+            worst = std::max(worst, std::abs(static_cast<double>(blurred.row(y)[x]) -
+                                             expected.row(tile.y + y)[tile.x * kChannels + x]));
+        }
+    }
+    return worst;
+}
+
+}  // namespace
+
+TEST(RecursiveGaussianTest, StaysWithinDocumentedBoundOfFir) {
+    for (float sigma : {4.0f, 6.0f, 10.0f, 25.0f}) {
+        const double bound = sigma >= 6.0f ? 0.01 : 0.015;
+        EXPECT_LE(maxRelativeError<Gray8Image>(sigma, 131, 97), bound) << "sigma " << sigma;
+        EXPECT_LE(maxRelativeError<RGB16Image>(sigma, 90, 120), bound) << "sigma " << sigma;
+        EXPECT_LE(maxRelativeError<GrayFloatImage>(sigma, 160, 20), bound) << "sigma " << sigma;
+    }
+}
+
+TEST(RecursiveGaussianTest, PreservesFlatImagesAndMass) {
+    for (int size : {1, 2, 3, 40}) {
+        RGBA16Image flat(size, size + 1);
+        flat.fill(40000);
+        auto blurred = RecursiveGaussian(7.5f).apply(flat);
+        ASSERT_TRUE(blurred) << blurred.error().toString();
+        const PixelAccessor<uint16_t> result(blurred.value()->view());
+        for (int y = 0; y < size + 1; ++y) {
+            for (int x = 0; x < size * 4; ++x) {
+                ASSERT_EQ(result.row(y)[x], 40000) << "image size " << size;
+            }
+        }
+    }
+
+    // Far from the borders the impulse response must integrate to 1
+    GrayFloatImage impulse(201, 201);
+    impulse.at(100, 100) = 1.0f;
+    auto spread = RecursiveGaussian(8.0f).apply(impulse);
+    ASSERT_TRUE(spread);
+    const PixelAccessor<float> result(spread.value()->view());
+    double total = 0;
+    for (int y = 0; y < 201; ++y) {
+        for (int x = 0; x < 201; ++x) {
+            total += result.row(y)[x];
+        }
+    }
+    EXPECT_NEAR(total, 1.0, 1e-3);
+}
+
+TEST(RecursiveGaussianTest, ThreadCountAndInPlaceDoNotChangeResult) {
+    auto image = makeTestImage<RGBAFloatImage>(75, 53, 3);
+    const RecursiveGaussian gaussian(12.0f);
+    auto serial = gaussian.apply(image);
+    ASSERT_TRUE(serial);
+    const PixelAccessor<float> expected(serial.value()->view());
+
+    for (size_t threads : {2u, 3u, 16u}) {
+        ThreadPool pool(threads);
+        auto parallel = gaussian.apply(image, &pool);
+        ASSERT_TRUE(parallel);
+        const PixelAccessor<float> actual(parallel.value()->view());
+        for (int y = 0; y < 53; ++y) {
+            for (int x = 0; x < 75 * 4; ++x) {
+                ASSERT_EQ(actual.row(y)[x], expected.row(y)[x]);
+            }
+        }
+    }
+
+    ASSERT_TRUE(gaussian.apply(image.view(), image.mutableView()));
+    for (int y = 0; y < 53; ++y) {
+        for (int x = 0; x < 75 * 4; ++x) {
+            ASSERT_EQ(image.row(y)[x], expected.row(y)[x]);
+        }
+    }
+}
+
+TEST(RecursiveGaussianTest, GaussianBlurSelectsMethod) {
+    EXPECT_FALSE(GaussianBlurFilter(2.0f, 13).isRecursive());
+    EXPECT_FALSE(GaussianBlurFilter(8.0f, 9).isRecursive());  // deliberately truncated kernel
+    EXPECT_TRUE(GaussianBlurFilter(8.0f, 49).isRecursive());
+    EXPECT_TRUE(GaussianBlurFilter(2.0f, 13, GaussianBlurFilter::Method::Recursive).isRecursive());
+    EXPECT_FALSE(GaussianBlurFilter(8.0f, 49, GaussianBlurFilter::Method::FIR).isRecursive());
+
+    const GaussianBlurFilter filter(8.0f, 49);
+    const auto clone = filter.clone();
+    EXPECT_TRUE(static_cast<const GaussianBlurFilter&>(*clone).isRecursive());
+    const FilterFootprint footprint = filter.getFootprint();
+    EXPECT_EQ(footprint.left, RecursiveGaussian(8.0f).getRadius());
+    EXPECT_EQ(footprint.bottom, RecursiveGaussian(8.0f).getRadius());
+
+    const auto image = makeTestImage<Gray8Image>(64, 48, 5);
+    auto viaFilter = filter.apply(image);
+    auto direct = RecursiveGaussian(8.0f).apply(image);
+    ASSERT_TRUE(viaFilter && direct);
+    const PixelAccessor<uint8_t> filtered(viaFilter.value()->view());
+    const PixelAccessor<uint8_t> expected(direct.value()->view());
+    for (int y = 0; y < 48; ++y) {
+        for (int x = 0; x < 64; ++x) {
+            ASSERT_EQ(filtered.row(y)[x], expected.row(y)[x]);
+        }
+    }
+}
+
+TEST(RecursiveGaussianTest, TileWithRadiusOfContextMatchesWholeImage) {
+    const RecursiveGaussian gaussian(4.0f);
+    const int radius = gaussian.getRadius();
+    EXPECT_GT(radius, 16);
+
+    EXPECT_EQ(maxTileDifference<RGB8Image>(gaussian, 400, 300), 0.0);
+    EXPECT_EQ(maxTileDifference<RGB16Image>(gaussian, 400, 300), 0.0);
+}
+
+TEST(RecursiveGaussianTest, RejectsInvalidArguments) {
+    EXPECT_THROW(RecursiveGaussian(0.25f), std::invalid_argument);
+    EXPECT_THROW(RecursiveGaussian(std::nanf("")), std::invalid_argument);
+    EXPECT_THROW(GaussianBlurFilter(0.3f, 3, GaussianBlurFilter::Method::Recursive),
+                 std::invalid_argument);
+
+    const RecursiveGaussian gaussian(5.0f);
+    GrayscaleImage gray(8, 8);
+    Gray16Image wide(8, 8);
+    EXPECT_EQ(gaussian.apply(gray.view(), wide.mutableView()).error().code(),
+              ErrorCode::InvalidParameter);
+    GrayscaleImage corner(4, 4);
+    EXPECT_EQ(gaussian.apply(gray.view(), Rect(6, 0, 4, 4), corner.mutableView()).error().code(),
+              ErrorCode::InvalidParameter);
+    EXPECT_EQ(gaussian.apply(gray.view(), Rect(0, 0, 4, 3), corner.mutableView()).error().code(),
+              ErrorCode::InvalidParameter);
+
+    BinaryImage binary(8, 8);
+    auto result = gaussian.apply(binary);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), ErrorCode::UnsupportedFormat);
+}
@@ -0,0 +1,171 @@
+// tests/unit/rle_binary_image_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+void expectPixelsEqual(const BinaryImage& actual, const BinaryImage& expected) {
+    ASSERT_EQ(actual.getWidth(), expected.getWidth());
+    ASSERT_EQ(actual.getHeight(), expected.getHeight());
+    for (int y = 0; y < expected.getHeight(); ++y) {
+        for (int x = 0; x < expected.getWidth(); ++x) {
+            ASSERT_EQ(actual.getPixel(x, y).value(), expected.getPixel(x, y).value())
+                << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+}  // namespace
+
+TEST(RLEBinaryImageTest, RoundTripsThroughBinaryImage) {
+    unsigned seed = 3;
+    for (int width : {1, 7, 63, 64, 65, 130}) {
+        for (double density : {0.05, 0.5, 0.95}) {
+            const BinaryImage image = makeRandomImage(width, 9, density, seed++);
+            auto encoded = RLEBinaryImage::fromBinaryImage(image);
+            ASSERT_TRUE(encoded) << encoded.error().toString();
+            EXPECT_EQ(encoded.value().area(), image.countWhitePixels());
+
+            auto decoded = encoded.value().toBinaryImage(Image::RowLayout::Aligned);
+            ASSERT_TRUE(decoded);
+            expectPixelsEqual(*decoded.value(), image);
+
+            for (int y = 0; y < 9; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    ASSERT_EQ(encoded.value().getPixel(x, y).value(),
+                              image.getPixel(x, y).value());
+                }
+            }
+        }
+    }
+}
+
+TEST(RLEBinaryImageTest, BooleanOperationsMatchPixelwise) {
+    using Op = std::function<bool(bool, bool)>;
+    const std::vector<std::pair<decltype(&RLEBinaryImage::logicalAnd), Op>> cases = {
+        {&RLEBinaryImage::logicalAnd, [](bool a, bool b) { return a && b; }},
+        {&RLEBinaryImage::logicalOr, [](bool a, bool b) { return a || b; }},
+        {&RLEBinaryImage::logicalXor, [](bool a, bool b) { return a != b; }},
+        {&RLEBinaryImage::difference, [](bool a, bool b) { return a && !b; }},
+    };
+
+    const BinaryImage a = makeRandomImage(131, 17, 0.4, 21);
+    const BinaryImage b = makeRandomImage(131, 17, 0.6, 22);
+    const auto encodedA = RLEBinaryImage::fromBinaryImage(a).value();
+    const auto encodedB = RLEBinaryImage::fromBinaryImage(b).value();
+
+    for (const auto& [operation, reference] : cases) {
+        auto result = operation(encodedA, encodedB);
+        ASSERT_TRUE(result) << result.error().toString();
+
+        BinaryImage expected(131, 17);
+        for (int y = 0; y < 17; ++y) {
+            for (int x = 0; x < 131; ++x) {
+                ASSERT_TRUE(expected.setPixel(
+                    x, y, reference(a.getPixel(x, y).value(), b.getPixel(x, y).value())));
+            }
+        }
+        // Output runs must be maximal, i.e. identical to encoding the reference
+        EXPECT_EQ(result.value(), RLEBinaryImage::fromBinaryImage(expected).value());
+    }
+}
+
+TEST(RLEBinaryImageTest, MergesTouchingRunsAcrossOperands) {
+    RLEBinaryImage a(20, 1);
+    RLEBinaryImage b(20, 1);
+    const std::vector<RLEBinaryImage::Run> runsA = {{2, 5}, {10, 12}};
+    const std::vector<RLEBinaryImage::Run> runsB = {{5, 8}, {12, 15}};
+    ASSERT_TRUE(a.setRow(0, runsA));
+    ASSERT_TRUE(b.setRow(0, runsB));
+
+    auto combined = RLEBinaryImage::logicalOr(a, b);
+    ASSERT_TRUE(combined);
+    const auto row = combined.value().getRow(0);
+    ASSERT_EQ(row.size(), 2u);
+    EXPECT_EQ(row[0], (RLEBinaryImage::Run{2, 8}));
+    EXPECT_EQ(row[1], (RLEBinaryImage::Run{10, 15}));
+}
+
+TEST(RLEBinaryImageTest, DoesNotMergeRunsAcrossRows) {
+    // Row 1 starts where row 0 ends; the runs belong to different rows
+    RLEBinaryImage mask(20, 2);
+    ASSERT_TRUE(mask.setRow(0, std::vector<RLEBinaryImage::Run>{{0, 10}}));
+    ASSERT_TRUE(mask.setRow(1, std::vector<RLEBinaryImage::Run>{{10, 15}}));
+    const RLEBinaryImage empty(20, 2);
+
+    for (auto operation : {&RLEBinaryImage::logicalOr, &RLEBinaryImage::logicalXor}) {
+        auto combined = operation(mask, empty);
+        ASSERT_TRUE(combined);
+        EXPECT_EQ(combined.value(), mask);
+        ASSERT_EQ(combined.value().getRow(0).size(), 1u);
+        EXPECT_EQ(combined.value().getRow(0)[0], (RLEBinaryImage::Run{0, 10}));
+        ASSERT_EQ(combined.value().getRow(1).size(), 1u);
+        EXPECT_EQ(combined.value().getRow(1)[0], (RLEBinaryImage::Run{10, 15}));
+        EXPECT_EQ(combined.value().area(), 15u);
+        EXPECT_EQ(combined.value().boundingBox(), Rect(0, 0, 15, 2));
+    }
+}
+
+TEST(RLEBinaryImageTest, AreaAndBoundingBox) {
+    RLEBinaryImage image(200, 50);
+    EXPECT_EQ(image.area(), 0u);
+    EXPECT_FALSE(image.boundingBox().has_value());
+
+    const std::vector<RLEBinaryImage::Run> upper = {{60, 70}};
+    const std::vector<RLEBinaryImage::Run> lower = {{5, 6}, {100, 140}};
+    ASSERT_TRUE(image.setRow(10, upper));
+    ASSERT_TRUE(image.setRow(30, lower));
+
+    EXPECT_EQ(image.area(), 51u);
+    EXPECT_EQ(image.getRunCount(), 3u);
+    EXPECT_EQ(image.boundingBox(), Rect(5, 10, 135, 21));
+    EXPECT_TRUE(image.getPixel(139, 30).value());
+    EXPECT_FALSE(image.getPixel(140, 30).value());
+
+    // Replacing a row shifts the rows after it
+    ASSERT_TRUE(image.setRow(10, std::vector<RLEBinaryImage::Run>{}));
+    EXPECT_EQ(image.getRow(30).size(), 2u);
+    EXPECT_EQ(image.boundingBox(), Rect(5, 30, 135, 1));
+}
+
+TEST(RLEBinaryImageTest, RejectsInvalidInput) {
+    RLEBinaryImage image(10, 2);
+    const std::vector<RLEBinaryImage::Run> outside = {{8, 11}};
+    const std::vector<RLEBinaryImage::Run> overlapping = {{1, 4}, {3, 6}};
+    const std::vector<RLEBinaryImage::Run> empty = {{4, 4}};
+    EXPECT_FALSE(image.setRow(0, outside));
+    EXPECT_FALSE(image.setRow(0, overlapping));
+    EXPECT_FALSE(image.setRow(0, empty));
+    EXPECT_FALSE(image.setRow(2, {}));
+    EXPECT_FALSE(image.getPixel(10, 0));
+
+    RLEBinaryImage other(11, 2);
+    auto result = RLEBinaryImage::logicalAnd(image, other);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), ErrorCode::InvalidParameter);
+
+    EXPECT_THROW(RLEBinaryImage(-1, 1), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(image.getRow(-1)), std::out_of_range);
+}
+
+TEST(RLEBinaryImageTest, SparseMaskIsSmallerThanBitPacked) {
+    BinaryImage image(4096, 4096);
+    for (int y = 0; y < 4096; y += 512) {
+        for (int x = 100; x < 300; ++x) {
+            ASSERT_TRUE(image.setPixel(x, y, true));
+        }
+    }
+    auto encoded = RLEBinaryImage::fromBinaryImage(image);
+    ASSERT_TRUE(encoded);
+    EXPECT_EQ(encoded.value().getRunCount(), 8u);
+    EXPECT_LT(encoded.value().getDataSize(), image.getDataSize() / 4);
+}
@@ -0,0 +1,198 @@
+// tests/unit/separable_convolution_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
+
+namespace {
+
+using Gray8Image = TypedImage<uint8_t, 1>;
+using RGB8Image = TypedImage<uint8_t, 3>;
+
+// Direct 2D evaluation with replicated borders, in double precision
+template <typename ImageT>
+std::vector<double> reference(const ImageT& image,
+                              const std::vector<float>& horizontal,
+                              const std::vector<float>& vertical) {
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+    const int channels = ImageT::kChannels;
+    const int rx = static_cast<int>(horizontal.size()) / 2;
+    const int ry = static_cast<int>(vertical.size()) / 2;
+    std::vector<double> result(static_cast<size_t>(width) * height * channels);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            for (int c = 0; c < channels; ++c) {
+                double sum = 0;
+                for (int j = -ry; j <= ry; ++j) {
+                    for (int i = -rx; i <= rx; ++i) {
+                        const int sx = std::clamp(x + i, 0, width - 1);
+                        const int sy = std::clamp(y + j, 0, height - 1);
+                        sum += static_cast<double>(horizontal[i + rx]) * vertical[j + ry] *
+                               image.at(sx, sy, c);
+                    }
+                }
+                result[(static_cast<size_t>(y) * width + x) * channels + c] = sum;
+            }
+        }
+    }
+    return result;
+}
+
+template <typename ImageT>
+void expectMatchesReference(int width, int height, const std::vector<float>& horizontal,
+                            const std::vector<float>& vertical, double tolerance) {
+    const ImageT image = makeRandomImage<ImageT>(width, height, 7u + static_cast<unsigned>(width));
+    const auto expected = reference(image, horizontal, vertical);
+
+    auto result = SeparableConvolution(horizontal, vertical).apply(image);
+    ASSERT_TRUE(result) << result.error().toString();
+    const auto& actual = static_cast<const ImageT&>(*result.value());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width * ImageT::kChannels; ++x) {
+            double value = expected[static_cast<size_t>(y) * width * ImageT::kChannels + x];
+            if constexpr (!std::is_floating_point_v<typename ImageT::Sample>) {
+                value = std::clamp(value, 0.0, double{SampleTraits<typename ImageT::Sample>::maxValue});
+            }
+            ASSERT_NEAR(actual.row(y)[x], value, tolerance) << "sample " << x << " of row " << y;
+        }
+    }
+}
+
+const std::vector<float> kSmooth = {0.25f, 0.5f, 0.25f};
+const std::vector<float> kAsymmetric = {-0.5f, 0.1f, 0.3f, 0.6f, 0.5f};
+
+}  // namespace
+
+TEST(SeparableConvolutionTest, MatchesDirectConvolutionForAllChannelCounts) {
+    for (int width : {1, 3, 8, 13, 37}) {
+        expectMatchesReference<Gray8Image>(width, 9, kAsymmetric, kSmooth, 0.51);
+        expectMatchesReference<RGB16Image>(width, 6, kSmooth, kAsymmetric, 0.51);
+        expectMatchesReference<RGBAFloatImage>(width, 5, kAsymmetric, kAsymmetric, 1e-4);
+    }
+}
+
+TEST(SeparableConvolutionTest, KernelLongerThanImage) {
+    const std::vector<float> wide = GaussianBlurFilter::createKernel(3.0f, 15);
+    expectMatchesReference<GrayFloatImage>(4, 3, wide, wide, 1e-4);
+    expectMatchesReference<RGB8Image>(2, 2, wide, {1.0f}, 0.51);
+}
+
+TEST(SeparableConvolutionTest, InPlaceMatchesOutOfPlace) {
+    auto image = makeRandomImage<RGBAFloatImage>(29, 17, 3);
+    const SeparableConvolution convolution(kAsymmetric, GaussianBlurFilter::createKernel(2.0f, 7));
+
+    auto expected = convolution.apply(image);
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(convolution.apply(image.view(), image.mutableView()));
+    const auto& outOfPlace = static_cast<const RGBAFloatImage&>(*expected.value());
+    for (int y = 0; y < 17; ++y) {
+        for (int x = 0; x < 29 * 4; ++x) {
+            ASSERT_EQ(image.row(y)[x], outOfPlace.row(y)[x]);
+        }
+    }
+}
+
+TEST(SeparableConvolutionTest, InterleavedChannelsMatchSeparateChannels) {
+    // The flat-sample loops must not mix channels
+    const auto color = makeRandomImage<RGB8Image>(21, 11, 5);
+    const SeparableConvolution convolution(GaussianBlurFilter::createKernel(1.5f, 5));
+    auto blurred = convolution.apply(color);
+    ASSERT_TRUE(blurred);
+    const auto& blurredColor = static_cast<const RGB8Image&>(*blurred.value());
+
+    for (int c = 0; c < 3; ++c) {
+        Gray8Image plane(21, 11);
+        for (int y = 0; y < 11; ++y) {
+            for (int x = 0; x < 21; ++x) {
+                plane.at(x, y) = color.at(x, y, c);
+            }
+        }
+        auto blurredPlane = convolution.apply(plane);
+        ASSERT_TRUE(blurredPlane);
+        const auto& gray = static_cast<const Gray8Image&>(*blurredPlane.value());
+        for (int y = 0; y < 11; ++y) {
+            for (int x = 0; x < 21; ++x) {
+                ASSERT_EQ(gray.at(x, y), blurredColor.at(x, y, c));
+            }
+        }
+    }
+}
+
+TEST(SeparableConvolutionTest, GaussianBlurPreservesFlatImagesAndMass) {
+    Gray16Image flat(40, 30);
+    flat.fill(12345);
+    auto blurred = GaussianBlurFilter(2.0f, 9).apply(flat);
+    ASSERT_TRUE(blurred);
+    const auto& result = static_cast<const Gray16Image&>(*blurred.value());
+    for (int y = 0; y < 30; ++y) {
+        for (int x = 0; x < 40; ++x) {
+            ASSERT_EQ(result.at(x, y), 12345);
+        }
+    }
+
+    GrayFloatImage impulse(31, 31);
+    impulse.at(15, 15) = 1.0f;
+    auto spread = GaussianBlurFilter(1.5f, 7).apply(impulse);
+    ASSERT_TRUE(spread);
+    double total = 0;
+    for (int y = 0; y < 31; ++y) {
+        for (int x = 0; x < 31; ++x) {
+            total += static_cast<const GrayFloatImage&>(*spread.value()).at(x, y);
+        }
+    }
+    EXPECT_NEAR(total, 1.0, 1e-5);
+}
+
+TEST(SeparableConvolutionTest, StreamedRowsMatchStoredRows) {
+    const auto image = makeRandomImage<RGBAFloatImage>(23, 19, 9);
+    const SeparableConvolution convolution(kAsymmetric, GaussianBlurFilter::createKernel(2.0f, 9));
+    auto expected = convolution.apply(image);
+    ASSERT_TRUE(expected);
+    const auto& stored = static_cast<const RGBAFloatImage&>(*expected.value());
+
+    // A range in the middle only reads the rows it depends on
+    int nextRow = 6;
+    ASSERT_TRUE(convolution.stream(image.view(), 6, 15, [&](int y, std::span<const float> row) {
+        ASSERT_EQ(y, nextRow++);
+        ASSERT_EQ(row.size(), 23u * 4u);
+        for (size_t x = 0; x < row.size(); ++x) {
+            ASSERT_EQ(row[x], stored.row(y)[x]);
+        }
+    }));
+    EXPECT_EQ(nextRow, 15);
+
+    EXPECT_EQ(convolution.stream(image.view(), 4, 20, [](int, std::span<const float>) {})
+                  .error()
+                  .code(),
+              ErrorCode::InvalidParameter);
+}
+
+TEST(SeparableConvolutionTest, RejectsInvalidArguments) {
+    EXPECT_THROW(SeparableConvolution(std::vector<float>{}), std::invalid_argument);
+    EXPECT_THROW(SeparableConvolution({0.5f, 0.5f}, {1.0f}), std::invalid_argument);
+
+    const SeparableConvolution convolution(kSmooth);
+    GrayscaleImage gray(8, 8);
+    Gray16Image wide(8, 8);
+    GrayscaleImage smaller(7, 8);
+    EXPECT_EQ(convolution.apply(gray.view(), wide.mutableView()).error().code(),
+              ErrorCode::InvalidParameter);
+    EXPECT_EQ(convolution.apply(gray.view(), smaller.mutableView()).error().code(),
+              ErrorCode::InvalidParameter);
+
+    BinaryImage binary(8, 8);
+    auto result = convolution.apply(binary);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), ErrorCode::UnsupportedFormat);
+}
@@ -0,0 +1,222 @@
+// tests/unit/typed_image_tests.cpp
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+using namespace DIPAL;
+
+static_assert(std::is_base_of_v<GrayscaleImage, TypedImage<uint8_t, 1>>);
+static_assert(std::is_base_of_v<ColorImage, TypedImage<uint8_t, 4>>);
+static_assert(!std::is_base_of_v<GrayscaleImage, Gray16Image>);
+
+TEST(TypedImageTest, GeometryFollowsSampleType) {
+    Gray16Image gray(5, 3);
+    EXPECT_EQ(gray.getType(), Image::Type::Grayscale);
+    EXPECT_EQ(gray.getDepth(), Image::Depth::UInt16);
+    EXPECT_EQ(gray.getBytesPerSample(), 2);
+    EXPECT_EQ(gray.getBytesPerPixel(), 2);
+    EXPECT_EQ(gray.getRowBytes(), 10u);
+
+    RGBAFloatImage color(7, 2, Image::RowLayout::Aligned);
+    EXPECT_EQ(color.getType(), Image::Type::RGBA);
+    EXPECT_EQ(color.getDepth(), Image::Depth::Float32);
+    EXPECT_EQ(color.getBytesPerPixel(), 16);
+    EXPECT_EQ(color.getRowBytes(), 112u);
+    EXPECT_EQ(color.getStride(), 128u);
+
+    TypedImage<uint8_t, 3> classic(4, 4);
+    EXPECT_EQ(classic.getDepth(), Image::Depth::UInt8);
+    EXPECT_EQ(classic.getType(), Image::Type::RGB);
+
+    EXPECT_THROW(Image(4, 4, Image::Type::Binary, Image::Depth::UInt16), std::invalid_argument);
+}
+
+TEST(TypedImageTest, SampleAccess) {
+    RGB16Image image(4, 3);
+    ASSERT_TRUE(image.setSample(2, 1, 2, 40000));
+    EXPECT_EQ(image.getSample(2, 1, 2).value(), 40000);
+    EXPECT_EQ(image.at(2, 1, 2), 40000);
+    EXPECT_EQ(image.row(1)[2 * 3 + 2], 40000);
+
+    EXPECT_FALSE(image.getSample(4, 0));
+    EXPECT_FALSE(image.setSample(0, 0, 3, 1));
+
+    // Clones share pixels until written, like the 8-bit classes
+    image.fill(7);
+    auto copy = image.clone();
+    auto& typedCopy = static_cast<RGB16Image&>(*copy);
+    EXPECT_TRUE(typedCopy.sharesDataWith(image));
+    typedCopy.at(0, 0) = 9;
+    EXPECT_EQ(image.at(0, 0), 7);
+    EXPECT_EQ(typedCopy.at(0, 0), 9);
+}
+
+TEST(TypedImageTest, FactoryCreatesTypedImages) {
+    auto created = ImageFactory::create(6, 4, Image::Type::RGB, Image::Depth::Float32);
+    ASSERT_TRUE(created);
+    EXPECT_NE(dynamic_cast<RGBFloatImage*>(created.value().get()), nullptr);
+
+    // 8-bit depth keeps returning the classic classes
+    auto classic = ImageFactory::create(6, 4, Image::Type::Grayscale, Image::Depth::UInt8);
+    ASSERT_TRUE(classic);
+    EXPECT_NE(dynamic_cast<GrayscaleImage*>(classic.value().get()), nullptr);
+
+    EXPECT_FALSE(ImageFactory::create(6, 4, Image::Type::Binary, Image::Depth::UInt16));
+    EXPECT_FALSE((ImageFactory::createTyped<uint16_t, 1>(0, 4)));
+
+    auto typed = ImageFactory::createTyped<uint16_t, 4>(3, 3, Image::RowLayout::Aligned);
+    ASSERT_TRUE(typed);
+    EXPECT_EQ(typed.value()->getRowLayout(), Image::RowLayout::Aligned);
+}
+
+TEST(TypedImageTest, ConvertDepthRescales) {
+    auto source = ImageFactory::createGrayscale(3, 1);
+    ASSERT_TRUE(source);
+    ASSERT_TRUE(source.value()->setPixel(0, 0, 0));
+    ASSERT_TRUE(source.value()->setPixel(1, 0, 128));
+    ASSERT_TRUE(source.value()->setPixel(2, 0, 255));
+
+    auto wide = ImageFactory::convertDepth(*source.value(), Image::Depth::UInt16);
+    ASSERT_TRUE(wide);
+    const auto& wide16 = static_cast<const Gray16Image&>(*wide.value());
+    EXPECT_EQ(wide16.at(1, 0), 128 * 257);
+    EXPECT_EQ(wide16.at(2, 0), 65535);
+
+    auto real = ImageFactory::convertDepth(wide16, Image::Depth::Float32);
+    ASSERT_TRUE(real);
+    const auto& realF = static_cast<const GrayFloatImage&>(*real.value());
+    EXPECT_FLOAT_EQ(realF.at(0, 0), 0.0f);
+    EXPECT_NEAR(realF.at(1, 0), 128.0f / 255.0f, 1e-6f);
+    EXPECT_FLOAT_EQ(realF.at(2, 0), 1.0f);
+
+    auto back = ImageFactory::convertDepth(realF, Image::Depth::UInt8);
+    ASSERT_TRUE(back);
+    const auto& back8 = static_cast<const GrayscaleImage&>(*back.value());
+    EXPECT_EQ(back8.getPixel(1, 0).value(), 128);
+    EXPECT_EQ(back8.getPixel(2, 0).value(), 255);
+}
+
+TEST(TypedImageTest, RoundToSampleTiesToEven) {
+    EXPECT_EQ(roundToSample<uint8_t>(2.5f), 2);
+    EXPECT_EQ(roundToSample<uint8_t>(3.5f), 4);
+    EXPECT_EQ(roundToSample<uint8_t>(3.49f), 3);
+    EXPECT_EQ(roundToSample<uint8_t>(-7.0f), 0);
+    EXPECT_EQ(roundToSample<uint8_t>(300.0f), 255);
+    EXPECT_EQ(roundToSample<uint16_t>(1000.5f), 1000);
+    EXPECT_EQ(roundToSample<uint16_t>(70000.0f), 65535);
+    EXPECT_FLOAT_EQ(roundToSample<float>(1.25f), 1.25f);
+
+    // saturateSample() rounds ties away from zero instead
+    EXPECT_EQ(saturateSample<uint8_t>(2.5f), 3);
+}
+
+TEST(TypedImageTest, ViewsUseSampleWidth) {
+    Gray16Image image(8, 4);
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            image.at(x, y) = static_cast<uint16_t>(1000 * y + x);
+        }
+    }
+
+    auto roi = image.view().crop(Rect(3, 2, 4, 2));
+    ASSERT_TRUE(roi);
+    EXPECT_EQ(roi->getDepth(), Image::Depth::UInt16);
+    EXPECT_EQ(roi->getRowBytes(), 8u);
+    EXPECT_EQ(PixelAccessor<uint16_t>(*roi)(0, 0), 2003);
+
+    auto copy = roi->toImage();
+    ASSERT_TRUE(copy);
+    ASSERT_EQ(copy.value()->getDepth(), Image::Depth::UInt16);
+    EXPECT_EQ(static_cast<Gray16Image&>(*copy.value()).at(3, 1), 3006);
+}
+
+TEST(TypedImageTest, FiltersKeepDepth) {
+    // A float impulse blurs into fractional values instead of truncating to zero
+    GrayFloatImage impulse(9, 9);
+    impulse.at(4, 4) = 1.0f;
+    auto blurred = GaussianBlurFilter(1.0f, 5).apply(impulse);
+    ASSERT_TRUE(blurred);
+    ASSERT_EQ(blurred.value()->getDepth(), Image::Depth::Float32);
+    const auto& blurredF = static_cast<const GrayFloatImage&>(*blurred.value());
+    EXPECT_GT(blurredF.at(4, 4), 0.1f);
+    EXPECT_GT(blurredF.at(2, 4), 0.0f);
+    EXPECT_LT(blurredF.at(2, 4), 0.1f);
+
+    // A 16-bit outlier is removed by the median
+    RGB16Image noisy(5, 5);
+    noisy.fill(30000);
+    noisy.at(2, 2, 1) = 65535;
+    auto median = MedianFilter(3).apply(noisy);
+    ASSERT_TRUE(median);
+    EXPECT_EQ(static_cast<const RGB16Image&>(*median.value()).at(2, 2, 1), 30000);
+
+    // Sobel of a 16-bit color step is a 16-bit grayscale edge map
+    RGB16Image step(6, 4);
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 3; x < 6; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                step.at(x, y, c) = 50000;
+            }
+        }
+    }
+    auto edges = SobelFilter().apply(step);
+    ASSERT_TRUE(edges);
+    ASSERT_EQ(edges.value()->getType(), Image::Type::Grayscale);
+    ASSERT_EQ(edges.value()->getDepth(), Image::Depth::UInt16);
+    const auto& edges16 = static_cast<const Gray16Image&>(*edges.value());
+    EXPECT_EQ(edges16.at(2, 1), 65535);
+    EXPECT_EQ(edges16.at(0, 1), 0);
+
+    // Unsharp mask keeps the depth and leaves flat regions alone
+    auto sharpened = UnsharpMaskFilter(1.0f, 1.0f).apply(noisy);
+    ASSERT_TRUE(sharpened);
+    EXPECT_EQ(sharpened.value()->getDepth(), Image::Depth::UInt16);
+    EXPECT_EQ(static_cast<const RGB16Image&>(*sharpened.value()).at(0, 0, 0), 30000);
+}
+
+TEST(TypedImageTest, TransformsKeepDepth) {
+    Gray16Image image(4, 4);
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            image.at(x, y) = static_cast<uint16_t>(10000 * x + y);
+        }
+    }
+
+    auto resized = ResizeTransform(8, 8, InterpolationMethod::NearestNeighbor).apply(image);
+    ASSERT_TRUE(resized);
+    ASSERT_EQ(resized.value()->getDepth(), Image::Depth::UInt16);
+    const auto& resized16 = static_cast<const Gray16Image&>(*resized.value());
+    EXPECT_EQ(resized16.at(7, 7), 30003);
+    EXPECT_EQ(resized16.at(2, 0), 10000);
+
+    auto rotated =
+        RotateTransform(0.0f, RotationCenter::Center, InterpolationMethod::Bilinear, false)
+            .apply(image);
+    ASSERT_TRUE(rotated);
+    ASSERT_EQ(rotated.value()->getDepth(), Image::Depth::UInt16);
+    EXPECT_EQ(static_cast<const Gray16Image&>(*rotated.value()).at(1, 2), 10002);
+}
+
+TEST(TypedImageTest, ParallelProcessorStitchesTypedStrips) {
+    GrayFloatImage image(640, 420);
+    image.fill(0.25f);
+
+    ParallelProcessor processor(4);
+    auto blurred = processor.applyFilter(image, GaussianBlurFilter(1.0f));
+    ASSERT_TRUE(blurred) << blurred.error().toString();
+    ASSERT_EQ(blurred.value()->getDepth(), Image::Depth::Float32);
+
+    const auto& result = static_cast<const GrayFloatImage&>(*blurred.value());
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            ASSERT_NEAR(result.at(x, y), 0.25f, 1e-5f) << "(" << x << ", " << y << ")";
+        }
+    }
+}
+
+TEST(TypedImageTest, EightBitFormatsRejectWideSamples) {
+    Gray16Image image(4, 4);
+    EXPECT_FALSE(PPMImageIO::save(image, "typed_image_test.pgm"));
+}
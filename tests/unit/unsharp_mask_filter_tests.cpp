@@ -4,9 +4,15 @@
 
 #include <gtest/gtest.h>
 #include <DIPAL/DIPAL.hpp>
+#include "random_images.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
 
 using namespace DIPAL;
+using ImageTestUtils::makeRandomImage;
 
 /**
  * @brief Test fixture for UnsharpMaskFilter
@@ -37,10 +43,68 @@ TEST_F(UnsharpMaskFilterTest, DefaultConstruction) {
     EXPECT_TRUE(true) << "Default construction test not implemented";
 }
 
+namespace {
+
+// Sharpens against a stored blurred image, the way the filter is defined
+template <typename T, int Channels>
+void expectMatchesStoredBlur(const TypedImage<T, Channels>& image, float amount, float radius,
+                             uint8_t threshold8) {
+    using Value = std::conditional_t<std::is_floating_point_v<T>, float, int>;
+    const SeparableConvolution blur(
+        GaussianBlurFilter::createKernel(radius, static_cast<int>(radius * 3.0f) | 1));
+    auto blurredImage = blur.apply(image);
+    ASSERT_TRUE(blurredImage);
+    const PixelAccessor<T> blurred(blurredImage.value()->view());
+
+    auto result = UnsharpMaskFilter(amount, radius, threshold8).apply(image);
+    ASSERT_TRUE(result) << result.error().toString();
+    const PixelAccessor<T> actual(result.value()->view());
+
+    const Value threshold = static_cast<Value>(threshold8 * (SampleTraits<T>::maxValue / 255.0f));
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            for (int c = 0; c < Channels; ++c) {
+                const Value src = image.at(x, y, c);
+                Value expected = src;
+                if (Channels != 4 || c < 3) {
+                    Value diff = src - static_cast<Value>(blurred(x, y, c));
+                    if (std::abs(diff) < threshold) {
+                        diff = 0;
+                    }
+                    expected = src + static_cast<Value>(amount * diff);
+                    if constexpr (!std::is_floating_point_v<T>) {
+                        expected = std::clamp<Value>(expected, 0, SampleTraits<T>::maxValue);
+                    }
+                }
+                // Float results may differ in the last bits where the
+                // compiler fuses the multiply and add
+                if constexpr (std::is_floating_point_v<T>) {
+                    ASSERT_NEAR(actual(x, y, c), expected, 1e-5)
+                        << "at (" << x << ", " << y << ", " << c << ")";
+                } else {
+                    ASSERT_EQ(actual(x, y, c), static_cast<T>(expected))
+                        << "at (" << x << ", " << y << ", " << c << ")";
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
 TEST_F(UnsharpMaskFilterTest, BasicOperations) {
-    // Test basic operations
-    // TODO: Implement basic operations test
-    EXPECT_TRUE(true) << "Basic operations test not implemented";
+    // Streaming the blur gives exactly the result of sharpening against a
+    // stored blurred image
+    expectMatchesStoredBlur(makeRandomImage<TypedImage<uint8_t, 1>>(31, 23, 1), 1.5f, 1.0f, 0);
+    expectMatchesStoredBlur(makeRandomImage<TypedImage<uint8_t, 3>>(17, 29, 2), 0.7f, 2.5f, 12);
+    expectMatchesStoredBlur(makeRandomImage<TypedImage<uint8_t, 4>>(13, 11, 3), 2.0f, 1.2f, 4);
+    expectMatchesStoredBlur(makeRandomImage<TypedImage<uint16_t, 3>>(19, 9, 4), 1.0f, 1.7f, 3);
+    expectMatchesStoredBlur(makeRandomImage<TypedImage<float, 4>>(9, 14, 5), 1.3f, 0.8f, 10);
+}
+
+TEST_F(UnsharpMaskFilterTest, ParallelStripsMatchStoredBlur) {
+    // Large enough to be split into strips
+    expectMatchesStoredBlur(makeRandomImage<TypedImage<uint8_t, 3>>(600, 500, 6), 1.0f, 2.0f, 5);
 }
 
 // ============================================================================
@@ -0,0 +1,53 @@
+// tests/utils/random_images.hpp
+// Seeded random test images for DIPAL Library
+
+#pragma once
+
+#include <DIPAL/DIPAL.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace DIPAL {
+namespace ImageTestUtils {
+
+/**
+ * @brief Create a typed image of uniformly random samples over the depth's range
+ * @tparam ImageT A TypedImage, e.g. TypedImage<uint16_t, 3>
+ */
+template <typename ImageT>
+ImageT makeRandomImage(int width, int height, unsigned seed) {
+    using T = typename ImageT::Sample;
+    ImageT image(width, height);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> value(0.0, static_cast<double>(SampleTraits<T>::maxValue));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width * ImageT::kChannels; ++x) {
+            image.row(y)[x] = static_cast<T>(value(rng));
+        }
+    }
+    return image;
+}
+
+/**
+ * @brief Create a binary image whose pixels are white with the given probability
+ */
+inline BinaryImage makeRandomImage(int width,
+                                   int height,
+                                   double density,
+                                   unsigned seed,
+                                   Image::RowLayout layout = Image::RowLayout::Packed) {
+    BinaryImage image(width, height, layout);
+    std::mt19937 rng(seed);
+    std::bernoulli_distribution white(density);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            EXPECT_TRUE(image.setPixel(x, y, white(rng)));
+        }
+    }
+    return image;
+}
+
+} // namespace ImageTestUtils
+} // namespace DIPAL